@@ -62,6 +62,43 @@
 #define BMI160_I2C_ADDR           0x68  // BMI160 gyroscope/accelerometer
 #define TOF_I2C_ADDR              0x29  // VL53L0X time-of-flight sensor
 
+// Frame profiling (render vs. show cost per frame, printed over Serial)
+#define FRAME_PROFILE_INTERVAL    0    // Milliseconds between frame cost reports (0 = off, e.g. 1000 for benchmarking)
+#define EFFECT_RANDOM_SEED        0    // Seed for effect randomness (0 = different every boot, any other value = repeatable frames)
+
+// Adaptive quality (particle effects shed trails/drops when rendering gets too slow)
+#define QUALITY_RENDER_BUDGET_US  4000 // Average render time per frame before detail is reduced (microseconds, 0 = always full detail)
+#define QUALITY_CHECK_INTERVAL    250  // Milliseconds between quality adjustments
+
+// Crossfades
+#define EFFECT_TRANSITION_MS        1000  // Crossfade length when the effect or mode changes (0 = hard cut)
+#define TRANSITION_FRAME_BUDGET_US  12000 // Longest transition frame before the fade is shortened (microseconds, 0 = no limit)
+#define PARALLEL_TRANSITIONS        1     // Draw the two effects of a crossfade on both cores (0 = one after the other on core 1)
+#define PARALLEL_STRIPS             1     // Let effects that draw strip by strip share the strips with core 0 (0 = core 1 only)
+#define WORKER_SPIN_US              2000  // Wait for core 0 by spinning this long, then let other tasks run (microseconds)
+#define WORKER_LATE_US              50000 // Warn over serial when core 0 takes this much longer (microseconds)
+#define STRIP_GUARD_LEDS            0     // Debug: canary LEDs after every strip buffer, checked after the strip jobs (0 = off, e.g. 8)
+#define PARTY_FADE_OUTGOING_DIVIDER 2  // Draw the outgoing effect every Nth transition frame (1 = every frame)
+
+// Effect memory - effects are built the first time they are selected
+#define EFFECT_MIN_FREE_HEAP        32768 // Free heap below which effects that are not running are deleted (bytes, 0 = never)
+#define EFFECT_MEMORY_CHECK_INTERVAL 1000 // How often free heap is checked (ms)
+
+// Baked loops - periodic effects record one period into PSRAM and play it back (see Effect::setBaked)
+#define BAKE_PERIODIC_EFFECTS       0     // 1 = bake every effect that has a loop period (needs PSRAM, about 1KB per stored frame)
+#define BAKE_FRAME_MS               40    // Default time between stored frames - playback blends between them
+#define BAKE_SEAM_MS                1000  // Crossfade at the loop point, for effects whose cycles don't line up exactly
+#define BAKE_PSRAM_BUDGET           1572864 // Most PSRAM all baked loops may hold together (bytes, 0 = no limit) - idle loops are freed to make room
+
+// Warm starts - effects that build up over time (fire, drops, trails) fast-forward on reset (see Effect::warmUp)
+#define WARM_UP_STEP_MS             100   // Simulation step while fast-forwarding (coarser than a frame)
+#define WARM_UP_BUDGET_US           4000  // Most CPU time one warm-up may take (microseconds, 0 = no limit)
+
+// Pre-rendered animations - recorded frames played from flash (see tools/animation)
+#define ANIMATION_PARTITION         "anim" // Flash partition holding the animation (partitions.csv)
+#define CAPTURE_SHOW_FRAMES         0     // 1 = send every shown frame over Serial for the animation encoder (slows the frame rate)
+#define CAPTURE_VERIFY_FRAMES       0     // Debug: 1 = decode every captured record before sending it (slows capturing further)
+
 // Color definitions with names
 #define COLOR_RED     0xFF0000  // Pure Red
 #define COLOR_GREEN   0x00FF00  // Pure Green
@@ -0,0 +1,15 @@
+// src/LanternMode.h
+
+#ifndef LANTERN_MODE_H
+#define LANTERN_MODE_H
+
+// Define modes
+enum LanternMode {
+  MODE_OFF = 0,
+  MODE_AMBIENT = 1,
+  MODE_GRADIENT = 2,
+  MODE_ANIMATED = 3,
+  MODE_PARTY = 4
+};
+
+#endif // LANTERN_MODE_H
@@ -2,30 +2,14 @@
 
 #include "SmartLantern.h"
 
-#include "leds/effects/RainbowEffect.h"
-#include "leds/effects/FireEffect.h"
-#include "leds/effects/MatrixEffect.h"
-#include "leds/effects/GradientEffect.h"
-#include "leds/effects/WaterfallEffect.h"
-#include "leds/effects/CodeRedEffect.h"
-#include "leds/effects/RegalEffect.h"
-#include "leds/effects/RainbowTranceEffect.h"
-#include "leds/effects/PartyFireEffect.h"
-#include "leds/effects/TemperatureColorEffect.h"
-#include "leds/effects/CandleFlickerEffect.h"
-#include "leds/effects/AuraEffect.h"
-#include "leds/effects/FutureEffect.h"
-#include "leds/effects/FutureRainbowEffect.h"
-#include "leds/effects/RgbPatternEffect.h"
-#include "leds/effects/EmeraldCityEffect.h"
-#include "leds/effects/SuspendedFireEffect.h"
-#include "leds/effects/SuspendedPartyFireEffect.h"
-#include "leds/effects/LustEffect.h"
+#include "leds/effects/EffectCatalog.h"
 #include "leds/effects/PartyCycleEffect.h"
-#include "leds/effects/DarkEnergyEffect.h"
+#include "leds/FlashAnimation.h"
+#include "leds/HSVKernel.h"
 
 SmartLantern::SmartLantern() :
     buttonFeedback(leds),
+    fireEffectId(-1),
     isPowerOn(false),
     isAutoOn(false),
     currentMode(MODE_AMBIENT),
@@ -47,195 +31,235 @@ SmartLantern::SmartLantern() :
     tempButtonToggled(false),
     lightButtonToggled(false),
     modeButtonToggled(false),
-    effectButtonToggled(false)
+    effectButtonToggled(false),
+    // Initialize frame profiling
+    profileRenderTotal(0),
+    profileRenderMax(0),
+    profileShowTotal(0),
+    profileFrames(0),
+    lastProfileReport(0),
+    // Start at full detail
+    renderQuality(1.0f),
+    qualityRenderTotal(0),
+    qualityFrames(0),
+    lastQualityCheck(0),
+    staticFrameOwner(nullptr),
+    shownEffect(nullptr),
+    shownDescriptor(nullptr),
+    transitionLightsRing(true),
+    effectSeedBase(0),
+    ringFeedbackActive(false),
+    lastMemoryCheck(0)
 {
     // Initialize the effects vector structure
     effects.resize(5); // One vector for each mode (0-4)
 
-    // Create special effects that need direct access
-    fireEffectPtr = new FireEffect(leds);
-
-    // Call helper to initialize all effects
+    // Call helper to register all effects (none are built yet)
     initializeEffects();
 }
 
 SmartLantern::~SmartLantern() {
-    // Clean up all effects
-    for (auto &modeEffects: effects) {
-        for (auto effect: modeEffects) {
-            delete effect;
+    // The effect registry deletes every effect it built
+}
+
+void SmartLantern::initializeEffects() {
+    // Register every catalog entry - each one is built the first time it is
+    // selected. Entries are added in catalog order, so a registry id is the
+    // entry's catalog index.
+    std::vector<int> partyEffectIds;
+    for (int i = 0; i < EffectCatalog::count(); i++) {
+        if (EffectCatalog::get(i).flags & EFFECT_IN_PARTY_CYCLE) {
+            partyEffectIds.push_back(i);
         }
     }
-    // The fireEffectPtr is just a reference, it's already deleted in the loop above
+
+    // An empty animation partition would only show a dark lantern, so the
+    // effect that plays it is left out of its mode until one is written
+    bool animationStored = FlashAnimation::isStored(ANIMATION_PARTITION);
+
+    for (int i = 0; i < EffectCatalog::count(); i++) {
+        const EffectDescriptor& descriptor = EffectCatalog::get(i);
+
+        int id;
+        if (descriptor.flags & EFFECT_PARTY_CYCLE) {
+            // The party cycle builds each party effect when it first comes up
+            id = effectRegistry.add([this, partyEffectIds]() -> Effect* {
+                auto effect = new PartyCycleEffect(leds, effectRegistry, partyEffectIds);
+
+                // Its transitions can use core 0 as well
+                if (PARALLEL_TRANSITIONS) {
+                    effect->setRenderWorker(&renderWorker);
+                }
+                return effect;
+            }, &descriptor);
+        } else {
+            id = effectRegistry.add([this, &descriptor]() -> Effect* {
+                return descriptor.create(leds);
+            }, &descriptor);
+        }
+
+        bool listed = animationStored || !(descriptor.flags & EFFECT_NEEDS_ANIMATION);
+        if (descriptor.mode != MODE_OFF && listed) {
+            effects[descriptor.mode].push_back(id);
+        }
+        if (descriptor.flags & EFFECT_FIRE_OVERRIDE) {
+            fireEffectId = id;  // Remember the fire effect for temperature override
+        }
+    }
+
+    Serial.println("Registered " + String(effectRegistry.size()) + " effects, " +
+                   String(partyEffectIds.size()) + " of them in the party cycle");
 }
 
-void SmartLantern::initializeEffects() {
-    // Create the effect instances
-    // Create two rainbow effects with different parameters
-    // First one: all strips enabled (for party mode)
-    auto rainbowEffect = new RainbowEffect(leds);
-
-    // Second one: core and ring disabled (for animated mode)
-    auto rainbowEffectNoCore = new RainbowEffect(leds,
-        false,  // core disabled
-        true,   // inner enabled
-        true,   // outer enabled
-        false   // ring disabled
-    );
-    auto splitRainbowGradient = new GradientEffect(
-    leds,
-    Gradient(),                                      // Core off
-    GradientEffect::createFirstHalfRainbowGradient(), // Inner: Red to Cyan
-    GradientEffect::createSecondHalfRainbowGradient(), // Outer: Cyan to Red
-    Gradient()                                       // Ring off
-);
-    auto fireEffect = new FireEffect(leds);
-    auto darkenergyEffect = new DarkEnergyEffect(leds);
-    auto suspendedFireEffect = new SuspendedFireEffect(leds);
-    auto matrixEffect = new MatrixEffect(leds);
-    auto waterfallEffect = new WaterfallEffect(leds);
-    auto coreGrowEffect = new CodeRedEffect(leds);
-    auto technoOrangeEffect = new RegalEffect(leds);
-    auto rainbowTranceEffect = new RainbowTranceEffect(leds);
-    auto partyFireEffect = new PartyFireEffect(leds);
-    auto rgbPatternEffect = new RgbPatternEffect(leds);
-    auto suspendedPartyFireEffect = new SuspendedPartyFireEffect(leds);
-    auto lustEffect = new LustEffect(leds);
-    auto partyRippleEffect = new AuraEffect(leds,
-        false,   // Core on
-        true,   // Inner on
-        true,   // Outer on
-        false    // Ring of
-    );
-    auto futureEffect = new FutureEffect(leds);
-    auto futureRainbowEffect = new FutureRainbowEffect(leds);
-    // Create the Emerald City effect
-    auto emeraldCityEffect = new EmeraldCityEffect(leds);
-
-    // Store a reference to the fire effect for temperature override
-    fireEffectPtr = fireEffect;
-
-    // Solid color effects for ambient mode
-    auto candleEffect = new CandleFlickerEffect(leds);
-
-    auto incandescent = new TemperatureColorEffect(
-        leds,
-        2700,   // Warm incandescent
-        false,  // Core off
-        true,   // Inner on
-        true,   // Outer on (with fade)
-        false   // Ring off
-    );
-
-    auto daylight = new TemperatureColorEffect(
-        leds,
-        5500,   // Natural daylight
-        false,  // Core off
-        true,   // Inner on
-        true,   // Outer on (with fade)
-        false   // Ring off
-    );
-
-    effects[MODE_AMBIENT].push_back(incandescent);
-    effects[MODE_AMBIENT].push_back(daylight);
-    effects[MODE_AMBIENT].push_back(candleEffect);
-
-    // Gradient effects for gradient mode
-    // 1. Purple-Blue opposing gradients (inner purple→blue, outer blue→purple, others off)
-    auto purpleBlueOpposingGradient = new GradientEffect(
-        leds,
-        Gradient(), // Core off
-        GradientEffect::createPurpleToBlueGradient(),
-        GradientEffect::createBlueToPurpleGradient(),
-        Gradient() // Ring off
-    );
-
-    // 2. Rainbow but flipped directions for inner and outer
-    auto rainbowGradient = GradientEffect::createRainbowGradient();
-    auto reversedRainbowGradient = GradientEffect::reverseGradient(rainbowGradient);
-    auto opposingRainbowGradient = new GradientEffect(
-        leds,
-        Gradient(),
-        rainbowGradient,
-        reversedRainbowGradient,
-        Gradient() // Ring off
-    );
-
-    // 3. Sunset gradient on all strips
-    auto sunsetGradient = new GradientEffect(
-        leds,
-        Gradient(),
-        GradientEffect::createSunsetGradient(),
-        GradientEffect::reverseGradient(GradientEffect::createSunsetGradient()),
-        Gradient()
-    );
-
-    // 4. Easter gradient on all strips
-    auto bavariaGradient = new GradientEffect(
-        leds,
-        Gradient(),
-        GradientEffect::createBlueToWhiteGradient(),
-        GradientEffect::reverseGradient(GradientEffect::createBlueToWhiteGradient()),
-        Gradient()
-    );
-
-    // 5. Christmas gradient on all strips
-    auto christmasGradient = new GradientEffect(
-        leds,
-        GradientEffect::createCoreChristmasGradient(),
-        GradientEffect::reverseGradient(GradientEffect::createOuterChristmasGradient()),
-        GradientEffect::createOuterChristmasGradient(),
-        Gradient()
-    );
-
-    effects[MODE_GRADIENT].push_back(sunsetGradient);
-    effects[MODE_GRADIENT].push_back(purpleBlueOpposingGradient);
-    effects[MODE_GRADIENT].push_back(splitRainbowGradient);
-    effects[MODE_GRADIENT].push_back(christmasGradient);
-
-    // MODE_ANIMATED
-    effects[MODE_ANIMATED].push_back(darkenergyEffect); // Full rainbow effect
-    effects[MODE_ANIMATED].push_back(suspendedFireEffect);
-    effects[MODE_ANIMATED].push_back(waterfallEffect); // Waterfall effect
-    effects[MODE_ANIMATED].push_back(rainbowEffectNoCore); // Rainbow effect
-    effects[MODE_ANIMATED].push_back(partyRippleEffect);
-
-    // MODE_PARTY - Create party cycle effect and individual effects
-    Serial.println("=== CREATING PARTY EFFECTS ===");
-
-    // MODE_PARTY - Create party cycle effect and individual effects
-    Serial.println("=== CREATING PARTY EFFECTS ===");
-
-    // Create vector of individual party effects for cycling
-    std::vector<Effect*> partyEffectsForCycling;
-    partyEffectsForCycling.push_back(coreGrowEffect);
-    partyEffectsForCycling.push_back(lustEffect);
-    partyEffectsForCycling.push_back(emeraldCityEffect);
-    partyEffectsForCycling.push_back(rainbowTranceEffect);
-    partyEffectsForCycling.push_back(rgbPatternEffect);
-    partyEffectsForCycling.push_back(futureEffect);
-    partyEffectsForCycling.push_back(rainbowEffect);
-    partyEffectsForCycling.push_back(technoOrangeEffect);
-    partyEffectsForCycling.push_back(futureRainbowEffect);
-    partyEffectsForCycling.push_back(matrixEffect);
-    //partyEffectsForCycling.push_back(partyFireEffect);
-    partyEffectsForCycling.push_back(suspendedPartyFireEffect);
-
-
-    Serial.println("Created " + String(partyEffectsForCycling.size()) + " individual party effects");
-
-    // Create the party cycle effect
-    auto partyCycleEffect = new PartyCycleEffect(leds, partyEffectsForCycling);
-
-    // Add party cycle effect as the FIRST option in party mode
-    effects[MODE_PARTY].push_back(partyCycleEffect);
-
-    // Add all individual party effects after the cycle effect
-    for (Effect* effect : partyEffectsForCycling) {
-        effects[MODE_PARTY].push_back(effect);
-    }
-
-    Serial.println("Party mode has " + String(effects[MODE_PARTY].size()) + " total effects (cycle + individuals)");
+void SmartLantern::seedEffects() {
+    // A fixed seed makes every effect draw the same frames on every boot,
+    // which is what benchmark and comparison runs need
+    effectSeedBase = EFFECT_RANDOM_SEED;
+    if (effectSeedBase == 0) {
+        effectSeedBase = esp_random();
+    }
+
+    // Effects are built on demand, so they are set up as they are built.
+    // Derive one seed per effect from its registry id, so each effect gets its
+    // own sequence and adding randomness to one effect never changes another.
+    // A rebuilt effect gets the same seed again.
+    effectRegistry.setCreateHook([this](Effect* effect, int id) {
+        const EffectDescriptor* descriptor = effectRegistry.describe(id);
+        effect->seedRandom(effectSeedBase + (uint32_t)id * 0x9E3779B9u);
+        effect->setSkipRing(ringFeedbackActive);
+        effect->setQuality(renderQuality);
+
+        // The main loop caches frames by the catalog's static flag - keep it honest
+        if (descriptor != nullptr && descriptor->isStatic != effect->isStatic()) {
+            Serial.print("WARNING: catalog entry '");
+            Serial.print(descriptor->name);
+            Serial.println("' has the wrong static flag");
+        }
+
+        // Periodic effects can play from a loop in PSRAM instead of drawing every
+        // frame - a static effect draws once anyway, so it never needs one
+        bool isStatic = (descriptor != nullptr) ? descriptor->isStatic : effect->isStatic();
+        if (BAKE_PERIODIC_EFFECTS && !isStatic && effect->loopPeriodMs() > 0) {
+            if (BAKE_PSRAM_BUDGET > 0 && Effect::getBakedBytes() + effect->bakedLoopBytes() > BAKE_PSRAM_BUDGET) {
+                releaseIdleLoops(effect);  // The new effect is about to run - idle ones make room
+            }
+            effect->setBaked(true);
+        }
+    });
+}
+
+Effect* SmartLantern::effectAt(LanternMode mode, unsigned int index) {
+    if (mode >= (int)effects.size() || index >= effects[mode].size()) {
+        return nullptr;
+    }
+    return effectRegistry.get(effects[mode][index]);
+}
+
+const EffectDescriptor* SmartLantern::describeEffect(LanternMode mode, unsigned int index) const {
+    if (mode >= (int)effects.size() || index >= effects[mode].size()) {
+        return nullptr;
+    }
+    return effectRegistry.describe(effects[mode][index]);
+}
+
+void SmartLantern::setRingSkipped(bool skip) {
+    ringFeedbackActive = skip;
+
+    // Only built effects need telling - the rest pick it up when they are built.
+    // Effects that keep the ring black don't have to draw their frame again.
+    for (int id = 0; id < effectRegistry.size(); id++) {
+        Effect* effect = effectRegistry.peek(id);
+        if (effect != nullptr) {
+            effect->setSkipRing(skip, lightsRing(effectRegistry.describe(id)));
+        }
+    }
+}
+
+void SmartLantern::releaseIdleEffects() {
+    if (EFFECT_MIN_FREE_HEAP == 0) {
+        return;
+    }
+
+    unsigned long currentTime = millis();
+    if (currentTime - lastMemoryCheck < EFFECT_MEMORY_CHECK_INTERVAL) {
+        return;
+    }
+    lastMemoryCheck = currentTime;
+
+    if (ESP.getFreeHeap() >= EFFECT_MIN_FREE_HEAP) {
+        return;
+    }
+
+    // Keep whatever is on the strips, both sides of a fade and the effect
+    // about to run
+    Effect* selected = selectEffect();
+    Effect* owner = staticFrameOwner;
+
+    effectRegistry.releaseUnused([&](const Effect* effect) {
+        if (isEffectRunning(effect, selected)) {
+            return true;
+        }
+        if (effect == owner) {
+            owner = nullptr;  // The cached frame belongs to an effect that is gone
+        }
+        return false;
+    });
+
+    staticFrameOwner = owner;
+
+    Serial.print("Free heap after releasing idle effects: ");
+    Serial.print(ESP.getFreeHeap());
+    Serial.println(" bytes");
+}
+
+bool SmartLantern::isEffectRunning(const Effect* effect, const Effect* selected) const {
+    // containsEffect also finds the party cycle's children
+    const Effect* outgoing = transition.isActive() ? transition.getOutgoing() : nullptr;
+    const Effect* incoming = transition.isActive() ? transition.getIncoming() : nullptr;
+    const Effect* running[] = {selected, shownEffect, outgoing, incoming};
+    for (const Effect* candidate : running) {
+        if (candidate != nullptr && candidate->containsEffect(effect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SmartLantern::releaseIdleLoops(const Effect* needed) {
+    size_t before = Effect::getBakedBytes();
+
+    // Only built effects can hold a loop - peek() never builds one
+    for (int id = 0; id < effectRegistry.size(); id++) {
+        Effect* effect = effectRegistry.peek(id);
+        if (effect == nullptr || effect == needed || !effect->isBaked() || isEffectRunning(effect, needed)) {
+            continue;
+        }
+        effect->setBaked(false);  // Draws live if it is shown again
+    }
+
+    Serial.print("Released ");
+    Serial.print(before - Effect::getBakedBytes());
+    Serial.println(" bytes of idle baked loops");
+}
+
+void SmartLantern::reportEffectMemory() {
+    // Build every effect once to see what building them all at boot used to cost
+    int builtBefore = effectRegistry.builtCount();
+    for (int id = 0; id < effectRegistry.size(); id++) {
+        effectRegistry.get(id);
+    }
+
+    Serial.print("All ");
+    Serial.print(effectRegistry.size());
+    Serial.print(" effects: ");
+    Serial.print(effectRegistry.builtBytes());
+    Serial.print(" bytes RAM, ");
+    Serial.print(effectRegistry.builtPsramBytes());
+    Serial.print(" bytes PSRAM, ");
+    Serial.print(effectRegistry.builtMicros() / 1000);
+    Serial.print("ms to build. Built at boot: ");
+    Serial.print(builtBefore);
+    Serial.println(" - the rest are built when first selected");
 }
 
 void SmartLantern::begin() {
@@ -247,6 +271,36 @@ void SmartLantern::begin() {
     // Initialize LED controller
     leds.begin();
 
+    // Seed effect randomness before the first frame is drawn
+    seedEffects();
+
+    // Core 0 helps with drawing: both effects of a crossfade, and the strips
+    // of effects that draw strip by strip
+    if ((PARALLEL_TRANSITIONS || PARALLEL_STRIPS) && renderWorker.begin()) {
+        if (PARALLEL_TRANSITIONS) {
+            transition.setRenderWorker(&renderWorker);
+        }
+        if (PARALLEL_STRIPS) {
+            Effect::setStripWorker(&renderWorker);
+        }
+    }
+
+    // When benchmarking, report what building effects on demand saves and
+    // compare one core against two for the strip-split effects - then free
+    // them all again, so the lantern runs like it does without profiling
+    if (FRAME_PROFILE_INTERVAL > 0) {
+        reportEffectMemory();
+        for (int id = 0; id < effectRegistry.size(); id++) {
+            effectRegistry.get(id)->benchmarkStrips(200);
+        }
+        effectRegistry.releaseUnused([](const Effect*) { return false; });
+    }
+
+    // When benchmarking, report the HSV conversion speed once at startup
+    if (FRAME_PROFILE_INTERVAL > 0) {
+        HSVKernel::benchmark();
+    }
+
     // Initialize sensors
     if (!sensors.begin()) {
         Serial.println("WARNING: Some sensors failed to initialize");
@@ -274,7 +328,7 @@ void SmartLantern::begin() {
         currentMode = MODE_AMBIENT; // Default to Ambient
     }
 
-    if (savedEffect >= 0 && savedEffect <= 4) {
+    if (savedEffect >= 0 && savedEffect < (int)effects[currentMode].size()) {
         currentEffect = savedEffect;
     } else {
         currentEffect = 0; // Default to first effect (white for Ambient mode)
@@ -306,47 +360,119 @@ void SmartLantern::update() {
     bool feedbackActive = buttonFeedback.isFeedbackActive();
 
     // Tell ALL effects to skip ring updates when button feedback is showing
-    if (feedbackActive) {
-        // Set skipRing flag on ALL effects in ALL modes to prevent ring conflicts
-        for (auto &modeEffects : effects) {
-            for (auto effect : modeEffects) {
-                if (effect != nullptr) {
-                    effect->setSkipRing(true);
-                }
-            }
-        }
-        // Also set it on the fire effect pointer used for temperature override
-        if (fireEffectPtr != nullptr) {
-            fireEffectPtr->setSkipRing(true);
-        }
-    } else {
-        // Clear skipRing flag on ALL effects when no button feedback
-        for (auto &modeEffects : effects) {
-            for (auto effect : modeEffects) {
-                if (effect != nullptr) {
-                    effect->setSkipRing(false);
-                }
-            }
-        }
-        // Also clear it on the fire effect pointer
-        if (fireEffectPtr != nullptr) {
-            fireEffectPtr->setSkipRing(false);
-        }
-    }
+    // (prevents ring conflicts - effects built later pick the flag up too)
+    setRingSkipped(feedbackActive);
+
+    // Free effects that are not running if memory is getting low
+    releaseIdleEffects();
 
     // If we're in wind-down mode, handle that instead of normal effects
+    unsigned long frameStart = micros();
     if (isWindingDown) {
+        staticFrameOwner = nullptr;  // Wind-down draws over the cached frame
+        shownEffect = nullptr;       // ...and nothing fades in or out of it
+        shownDescriptor = nullptr;
+        transition.cancel();
         updateWindDown();
     } else {
         // Update the current effect normally
         updateEffects();
     }
+    recordFrameTime(micros() - frameStart);
 
     // Update button feedback AFTER effects are drawn
     // This ensures button feedback timing is managed correctly
     buttonFeedback.update();
 }
 
+void SmartLantern::recordFrameTime(unsigned long frameMicros) {
+    // Frame time includes the showAll() after a drawn frame - split it out
+    unsigned long showMicros = leds.takeShowTime();
+    unsigned long renderMicros = (frameMicros > showMicros) ? frameMicros - showMicros : 0;
+
+    // Only frames that were actually drawn and shown say anything about render cost
+    // (transition frames draw two effects and have their own budget)
+    if (showMicros > 0 && !transition.isActive()) {
+        updateQuality(renderMicros);
+    }
+
+    if (FRAME_PROFILE_INTERVAL == 0) {
+        return;
+    }
+
+    profileRenderTotal += renderMicros;
+    profileShowTotal += showMicros;
+    profileRenderMax = max(profileRenderMax, renderMicros);
+    profileFrames++;
+
+    unsigned long currentTime = millis();
+    if (currentTime - lastProfileReport >= FRAME_PROFILE_INTERVAL) {
+        if (profileFrames > 0) {
+            const char* effectName = "Off";
+            const EffectDescriptor* descriptor = describeEffect(currentMode, currentEffect);
+            if (descriptor != nullptr) {
+                effectName = descriptor->name;
+            }
+
+            Serial.print("Frame cost [");
+            Serial.print(effectName);
+            Serial.print("] render avg: ");
+            Serial.print(profileRenderTotal / profileFrames);
+            Serial.print("us, render max: ");
+            Serial.print(profileRenderMax);
+            Serial.print("us, show avg: ");
+            Serial.print(profileShowTotal / profileFrames);
+            Serial.print("us over ");
+            Serial.print(profileFrames);
+            Serial.println(" frames");
+        }
+
+        profileRenderTotal = 0;
+        profileRenderMax = 0;
+        profileShowTotal = 0;
+        profileFrames = 0;
+        lastProfileReport = currentTime;
+    }
+}
+
+void SmartLantern::updateQuality(unsigned long renderMicros) {
+    if (QUALITY_RENDER_BUDGET_US == 0) {
+        return;
+    }
+
+    qualityRenderTotal += renderMicros;
+    qualityFrames++;
+
+    unsigned long currentTime = millis();
+    if (currentTime - lastQualityCheck < QUALITY_CHECK_INTERVAL) {
+        return;
+    }
+    lastQualityCheck = currentTime;
+
+    unsigned long averageRender = qualityRenderTotal / qualityFrames;
+    qualityRenderTotal = 0;
+    qualityFrames = 0;
+
+    float previousQuality = renderQuality;
+
+    if (averageRender > QUALITY_RENDER_BUDGET_US) {
+        // Over budget - shed detail in proportion to the overrun (at most half per check)
+        float shrink = max(0.5f, (float)QUALITY_RENDER_BUDGET_US / averageRender);
+        renderQuality = max(Effect::MIN_QUALITY, renderQuality * shrink);
+    } else if (averageRender < QUALITY_RENDER_BUDGET_US * 3 / 4) {
+        // Clear headroom - win detail back slowly so it doesn't bounce up and down
+        renderQuality = min(1.0f, renderQuality + QUALITY_RECOVER_STEP);
+    }
+
+    if (renderQuality != previousQuality) {
+        Serial.print("Render quality ");
+        Serial.print(renderQuality, 2);
+        Serial.print(" (average render ");
+        Serial.print(averageRender);
+        Serial.println("us)");
+    }
+}
+
 void SmartLantern::setMode(LanternMode mode) {
     if (mode != currentMode) {
         currentMode = mode;
@@ -370,7 +496,9 @@ void SmartLantern::nextEffect() {
     // Save effect to persistent storage
     preferences.putUChar("effect", currentEffect);
 
-    Serial.println("Effect changed to: " + effects[currentMode][currentEffect]->getName());
+    const EffectDescriptor* descriptor = describeEffect(currentMode, currentEffect);
+    Serial.print("Effect changed to: ");
+    Serial.println(descriptor != nullptr ? descriptor->name : "none");
 }
 
 void SmartLantern::nextMode() {
@@ -386,8 +514,9 @@ void SmartLantern::nextMode() {
     Serial.println("Mode changed to: " + modeNames[currentMode]);
 
     // Reset the new effect to its initial state
-    if (!effects[currentMode].empty() && currentEffect < effects[currentMode].size()) {
-        effects[currentMode][currentEffect]->reset();
+    Effect* effect = effectAt(currentMode, currentEffect);
+    if (effect != nullptr) {
+        effect->reset();
     }
 }
 
@@ -420,12 +549,15 @@ void SmartLantern::updateBrightnessFromTOF() {
             // Linear mapping: closer distance = higher brightness
             brightness = map(distance, 500, 100, 51, 255);
         }
-        leds.setBrightness(brightness);
+        if (brightness != leds.getBrightness()) {
+            leds.setBrightness(brightness);
+            staticFrameOwner = nullptr;  // New brightness only reaches the LEDs on the next show
+        }
     }
     // If distance is -1 (no reading), don't change brightness
 }
 
-void SmartLantern::updateEffects() {
+Effect* SmartLantern::selectEffect() {
     // Check for temperature override
     if (tempButtonState > 0) {
         float temperature = sensors.getTemperature();
@@ -445,16 +577,85 @@ void SmartLantern::updateEffects() {
 
         if (shouldShowFire) {
             // Override current effect with fire effect
-            fireEffectPtr->update();
-            return;
+            return effectRegistry.get(fireEffectId);
+        }
+    }
+
+    // Normal effect
+    if (currentMode != MODE_OFF) {
+        return effectAt(currentMode, currentEffect);
+    }
+
+    return nullptr;
+}
+
+void SmartLantern::updateEffects() {
+    Effect* effect = selectEffect();
+
+    if (effect == nullptr) {
+        // Nothing drawn this frame
+        staticFrameOwner = nullptr;
+        shownEffect = nullptr;
+        shownDescriptor = nullptr;
+        transition.cancel();
+        return;
+    }
+
+    if (effect != shownEffect) {
+        // A different effect than last frame (new mode, next effect, temperature
+        // override) - fade over to it from whatever is on the strips
+        const EffectDescriptor* descriptor = effectRegistry.describe(effect);
+        if (shownEffect != nullptr && EFFECT_TRANSITION_MS > 0) {
+            if (effect->getQuality() != renderQuality) {
+                effect->setQuality(renderQuality);
+            }
+            transition.start(shownEffect, effect, leds.getScreen(), EFFECT_TRANSITION_MS);
+
+            // The ring stays black through a fade between two effects that keep it black
+            transitionLightsRing = lightsRing(shownDescriptor) || lightsRing(descriptor);
         }
+        shownEffect = effect;
+        shownDescriptor = descriptor;
     }
 
-    // Normal effect update
-    if (currentMode != MODE_OFF && !effects[currentMode].empty()) {
-        if (currentEffect < effects[currentMode].size()) {
-            effects[currentMode][currentEffect]->update();
+    if (transition.isActive()) {
+        staticFrameOwner = nullptr;  // The blend is not any effect's cached frame
+        // Both effects keep their ring off while button feedback shows, so the blend must too
+        bool drawRing = transitionLightsRing && !ringFeedbackActive;
+        if (transition.render(leds.getScreen(), TRANSITION_FRAME_BUDGET_US, drawRing)) {
+            leds.showAll();
         }
+        return;
+    }
+
+    renderEffect(effect);
+}
+
+void SmartLantern::renderEffect(Effect* effect) {
+    // A static effect whose frame is still on the strips has nothing new to show
+    if (effect == staticFrameOwner && !effect->isFrameDirty()) {
+        return;
+    }
+
+    // Hand over the current detail level (effects that were not running pick it up here)
+    if (effect->getQuality() != renderQuality) {
+        effect->setQuality(renderQuality);
+    }
+
+    // The effect draws into the screen target - show it only if it drew a new frame
+    if (!effect->update(leds.getScreen())) {
+        staticFrameOwner = nullptr;
+        return;
+    }
+    leds.showAll();
+
+    // The catalog says whether the frame can be cached (effects outside it are asked)
+    bool isStatic = (effect == shownEffect && shownDescriptor != nullptr) ? shownDescriptor->isStatic : effect->isStatic();
+    if (isStatic) {
+        effect->markFrameDrawn();
+        staticFrameOwner = effect;
+    } else {
+        staticFrameOwner = nullptr;
     }
 }
 
@@ -592,8 +793,9 @@ void SmartLantern::processTouchInputs() {
 
                 // Show effect feedback using showEffectSelectionSmart
                 int numEffects = effects[currentMode].size();
-                bool isPartyMode = (currentMode == MODE_PARTY);
-                buttonFeedback.showEffectSelectionSmart(currentEffect, numEffects, isPartyMode);
+                const EffectDescriptor* descriptor = describeEffect(currentMode, currentEffect);
+                bool isPartyCycle = descriptor != nullptr && (descriptor->flags & EFFECT_PARTY_CYCLE);
+                buttonFeedback.showEffectSelectionSmart(currentEffect, numEffects, isPartyCycle);
             }
         }
     } else {
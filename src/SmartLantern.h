@@ -9,17 +9,11 @@
 #include "leds/LEDController.h"
 #include "sensors/SensorController.h"
 #include "leds/effects/Effect.h"
-#include "leds/effects/FireEffect.h"
+#include "leds/effects/EffectRegistry.h"
 #include "leds/MPR121LEDHandler.h"
-
-// Define modes
-enum LanternMode {
-  MODE_OFF = 0,
-  MODE_AMBIENT = 1,
-  MODE_GRADIENT = 2,
-  MODE_ANIMATED = 3,
-  MODE_PARTY = 4
-};
+#include "leds/EffectTransition.h"
+#include "leds/RenderWorker.h"
+#include "LanternMode.h"
 
 class SmartLantern {
 public:
@@ -51,12 +45,15 @@ private:
 
   MPR121LEDHandler buttonFeedback;
 
-  // Vector to store all effects for each mode
+  // Every effect, built the first time it is selected (see EffectRegistry)
+  EffectRegistry effectRegistry;
+
+  // Registry ids of the effects for each mode
   // effects[mode][effect_index]
-  std::vector<std::vector<Effect*>> effects;
+  std::vector<std::vector<int>> effects;
 
   // Special effects that need direct access
-  FireEffect* fireEffectPtr;       // Used for temperature override
+  int fireEffectId;                // Registry id of the fire effect used for temperature override
 
   // State variables
   bool isPowerOn;
@@ -90,14 +87,59 @@ private:
 
   static const unsigned long BUTTON_HOLD_TIME = 100;
 
+  // Frame profiling (see FRAME_PROFILE_INTERVAL in Config.h)
+  unsigned long profileRenderTotal;  // Summed render time this interval (microseconds)
+  unsigned long profileRenderMax;    // Slowest render this interval (microseconds)
+  unsigned long profileShowTotal;    // Summed showAll() time this interval (microseconds)
+  unsigned long profileFrames;       // Frames measured this interval
+  unsigned long lastProfileReport;   // Last time a report was printed
+
+  // Adaptive quality (see QUALITY_RENDER_BUDGET_US in Config.h)
+  float renderQuality;                // Detail level handed to the running effect (MIN_QUALITY to 1.0)
+  unsigned long qualityRenderTotal;   // Summed render time of drawn frames this interval (microseconds)
+  unsigned long qualityFrames;        // Drawn frames this interval
+  unsigned long lastQualityCheck;     // Last time the quality was adjusted
+  static constexpr float QUALITY_RECOVER_STEP = 0.05f; // Quality won back per check when there is headroom
+
+  // Static effect whose finished frame is on the strips right now (nullptr = none)
+  // While it stays valid the main loop skips update() and showAll() entirely
+  Effect* staticFrameOwner;
+
+  // Crossfade between effects (see EFFECT_TRANSITION_MS in Config.h)
+  EffectTransition transition;     // Runs while the old and new effect are blended
+  RenderWorker renderWorker;       // Drawing jobs on core 0 (see PARALLEL_TRANSITIONS and PARALLEL_STRIPS)
+  Effect* shownEffect;             // Effect drawn last frame (nullptr = none) - a different one starts a fade
+  const EffectDescriptor* shownDescriptor; // Its catalog entry (nullptr = none)
+  bool transitionLightsRing;       // One side of the running fade lights the ring (see EffectDescriptor::strips)
+
+  // Lazy effects (see EFFECT_MIN_FREE_HEAP in Config.h)
+  uint32_t effectSeedBase;         // Seeds are derived from this and the registry id
+  bool ringFeedbackActive;         // Button feedback owns the ring - new effects must skip it too
+  unsigned long lastMemoryCheck;   // Last time free heap was checked
+
   // Private helper functions
   void updateBrightnessFromTOF();  // Updates LED brightness based on TOF sensor
   void processTouchInputs();
   void handleAutoLighting();
   void updateEffects();
+  Effect* selectEffect();            // The effect that should be running right now (nullptr = none)
+  void renderEffect(Effect* effect); // Update an effect, skipping static effects whose frame is unchanged
   void initializeEffects(); // Helper method to initialize all effects
+  void seedEffects();        // Give every effect its own random seed (see EFFECT_RANDOM_SEED)
+  Effect* effectAt(LanternMode mode, unsigned int index); // Build (if needed) and return an effect of a mode
+  const EffectDescriptor* describeEffect(LanternMode mode, unsigned int index) const; // Catalog entry, without building
+  void setRingSkipped(bool skip);    // Tell every built effect whether button feedback owns the ring
+  void releaseIdleEffects();       // Delete effects that are not running when free heap runs low
+  static bool lightsRing(const EffectDescriptor* descriptor) { // Unknown effects are assumed to light it
+    return descriptor == nullptr || (descriptor->strips & STRIPS_RING);
+  }
+  bool isEffectRunning(const Effect* effect, const Effect* selected) const; // Shown, fading or about to run
+  void releaseIdleLoops(const Effect* needed); // Free the baked loops of effects that are not running (see BAKE_PSRAM_BUDGET)
+  void reportEffectMemory();       // Print what building effects on demand saved at boot
   void updateWindDown();     // Handle the wind-down animation
   void startWindDown();      // Start the wind-down sequence
+  void recordFrameTime(unsigned long frameMicros); // Split frame time into render/show and report
+  void updateQuality(unsigned long renderMicros);  // Shed or restore effect detail from measured render time
 };
 
 #endif // SMART_LANTERN_H
\ No newline at end of file
@@ -0,0 +1,281 @@
+// src/leds/AnimationCodec.cpp
+#include "AnimationCodec.h"
+#include <string.h>
+
+namespace AnimationCodec {
+
+static const size_t HEADER_SIZE = 20;
+
+// Little-endian helpers, so files are the same on the host and on the ESP32
+static uint32_t read32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void write32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back((value >> 8) & 0xFF);
+    out.push_back((value >> 16) & 0xFF);
+    out.push_back((value >> 24) & 0xFF);
+}
+
+static void write16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back((value >> 8) & 0xFF);
+}
+
+bool readHeader(const uint8_t* file, size_t size, Header& header) {
+    if (file == nullptr || size < HEADER_SIZE) {
+        return false;
+    }
+
+    header.magic = read32(file);
+    header.version = read16(file + 4);
+    header.ledCount = read16(file + 6);
+    header.frameMs = read16(file + 8);
+    header.flags = read16(file + 10);
+    header.frameCount = read32(file + 12);
+    header.indexOffset = read32(file + 16);
+
+    if (header.magic != MAGIC || header.version != VERSION ||
+        header.ledCount == 0 || header.frameCount == 0 || header.frameMs == 0) {
+        return false;
+    }
+
+    // The index must fit, and every record must sit between the header and the index
+    if (header.indexOffset < HEADER_SIZE || header.indexOffset > size ||
+        (size - header.indexOffset) / 4 < header.frameCount) {
+        return false;
+    }
+    uint32_t previous = HEADER_SIZE;
+    for (uint32_t i = 0; i < header.frameCount; i++) {
+        uint32_t offset = read32(file + header.indexOffset + i * 4);
+        if (offset < previous || offset >= header.indexOffset) {
+            return false;
+        }
+        previous = offset + 1;  // Every record has at least its type byte
+    }
+
+    // Playback starts at frame 0, so it has to decode on its own
+    return file[read32(file + header.indexOffset)] == FRAME_KEY;
+}
+
+const uint8_t* frameRecord(const uint8_t* file, const Header& header, uint32_t index, size_t& recordSize) {
+    const uint8_t* index32 = file + header.indexOffset + index * 4;
+    uint32_t start = read32(index32);
+    uint32_t end = (index + 1 < header.frameCount) ? read32(index32 + 4) : header.indexOffset;
+    recordSize = end - start;
+    return file + start;
+}
+
+bool isKeyFrame(const uint8_t* file, const Header& header, uint32_t index) {
+    size_t recordSize;
+    return frameRecord(file, header, index, recordSize)[0] == FRAME_KEY;
+}
+
+/**
+ * Walks through the spans while a frame is decoded
+ */
+struct SpanWriter {
+    const Span* spans;
+    int spanCount;
+    int span;    // Current span
+    int offset;  // LED inside the current span
+
+    /**
+     * Write the next LEDs
+     * @param count Number of LEDs
+     * @param rgb Source colors (nullptr = black)
+     * @param stride Bytes between source colors (0 = the same color for all, 3 = one each)
+     * @param keep True to leave the LEDs as they are (delta frame skip)
+     * @return False if the frame is longer than the spans
+     */
+    bool write(int count, const uint8_t* rgb, int stride, bool keep) {
+        static const uint8_t BLACK[3] = {0, 0, 0};
+        if (rgb == nullptr) {
+            rgb = BLACK;
+            stride = 0;
+        }
+
+        while (count > 0) {
+            if (span >= spanCount) {
+                return false;
+            }
+
+            int n = spans[span].count - offset;
+            if (n > count) n = count;
+
+            uint8_t* out = spans[span].rgb;
+            if (out != nullptr && !keep) {
+                out += offset * 3;
+                if (stride == 3) {
+                    memcpy(out, rgb, n * 3);
+                } else {
+                    for (int i = 0; i < n; i++, out += 3) {
+                        out[0] = rgb[0];
+                        out[1] = rgb[1];
+                        out[2] = rgb[2];
+                    }
+                }
+            }
+
+            rgb += n * stride;
+            count -= n;
+            offset += n;
+            if (offset == spans[span].count) {
+                span++;
+                offset = 0;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Check whether every LED has been written
+     */
+    bool done() const {
+        return span >= spanCount;
+    }
+};
+
+bool decodeFrame(const uint8_t* record, size_t recordSize, const Span* spans, int spanCount) {
+    if (recordSize < 1) {
+        return false;
+    }
+
+    bool keyFrame = (record[0] == FRAME_KEY);
+    SpanWriter writer = {spans, spanCount, 0, 0};
+
+    // Skip past spans that hold no LEDs
+    while (writer.span < spanCount && spans[writer.span].count == 0) writer.span++;
+
+    const uint8_t* p = record + 1;
+    const uint8_t* end = record + recordSize;
+    while (p < end) {
+        uint8_t op = *p & 0xC0;
+        int length = (*p & 0x3F) + 1;
+        p++;
+
+        bool ok;
+        if (op == OP_SKIP || op == OP_LONG_SKIP) {
+            if (op == OP_LONG_SKIP) {
+                if (p >= end) return false;
+                length = (((length - 1) << 8) | *p++) + 1;
+            }
+            // Key frames start from black, delta frames from the frame before
+            ok = writer.write(length, nullptr, 0, !keyFrame);
+        } else if (op == OP_RUN) {
+            if (end - p < 3) return false;
+            ok = writer.write(length, p, 0, false);
+            p += 3;
+        } else {
+            if (end - p < length * 3) return false;
+            ok = writer.write(length, p, 3, false);
+            p += length * 3;
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    // LEDs the record never reached: black in a key frame, unchanged in a delta frame
+    if (keyFrame && !writer.done()) {
+        int rest = 0;
+        for (int i = writer.span; i < spanCount; i++) rest += spans[i].count;
+        writer.write(rest - writer.offset, nullptr, 0, false);
+    }
+    return true;
+}
+
+size_t encodeFrame(const uint8_t* rgb, const uint8_t* previous, int ledCount, std::vector<uint8_t>& out) {
+    static const uint8_t BLACK[3] = {0, 0, 0};
+    size_t start = out.size();
+    out.push_back(previous == nullptr ? FRAME_KEY : FRAME_DELTA);
+
+    // An LED is "unchanged" if it matches the frame before (or black, in a key frame)
+    auto unchanged = [&](int i) {
+        const uint8_t* base = (previous != nullptr) ? previous + i * 3 : BLACK;
+        return memcmp(rgb + i * 3, base, 3) == 0;
+    };
+    auto sameColor = [&](int a, int b) {
+        return memcmp(rgb + a * 3, rgb + b * 3, 3) == 0;
+    };
+
+    // Trailing unchanged LEDs need no instructions at all
+    int count = ledCount;
+    while (count > 0 && unchanged(count - 1)) count--;
+
+    int i = 0;
+    while (i < count) {
+        if (unchanged(i)) {
+            int length = 1;
+            while (i + length < count && length < LONG_LENGTH && unchanged(i + length)) length++;
+            if (length > SHORT_LENGTH) {
+                out.push_back(OP_LONG_SKIP | ((length - 1) >> 8));
+                out.push_back((length - 1) & 0xFF);
+            } else {
+                out.push_back(OP_SKIP | (length - 1));
+            }
+            i += length;
+            continue;
+        }
+
+        // Two or more of the same color are cheaper as a run (4 bytes) than as pixels (6+)
+        int run = 1;
+        while (i + run < count && run < SHORT_LENGTH && sameColor(i, i + run)) run++;
+        if (run >= 2) {
+            out.push_back(OP_RUN | (run - 1));
+            out.insert(out.end(), rgb + i * 3, rgb + i * 3 + 3);
+            i += run;
+            continue;
+        }
+
+        // Single pixels until something cheaper starts
+        int length = 1;
+        while (i + length < count && length < SHORT_LENGTH && !unchanged(i + length) &&
+               !(i + length + 1 < count && sameColor(i + length, i + length + 1))) {
+            length++;
+        }
+        out.push_back(OP_LITERAL | (length - 1));
+        out.insert(out.end(), rgb + i * 3, rgb + (i + length) * 3);
+        i += length;
+    }
+
+    return out.size() - start;
+}
+
+void encodeFile(const uint8_t* frames, uint32_t frameCount, int ledCount, uint16_t frameMs,
+                uint16_t flags, uint32_t keyInterval, std::vector<uint8_t>& out) {
+    out.clear();
+    write32(out, MAGIC);
+    write16(out, VERSION);
+    write16(out, (uint16_t)ledCount);
+    write16(out, frameMs);
+    write16(out, flags);
+    write32(out, frameCount);
+    write32(out, 0);  // Index offset, filled in at the end
+
+    std::vector<uint32_t> offsets;
+    size_t frameBytes = (size_t)ledCount * 3;
+    for (uint32_t f = 0; f < frameCount; f++) {
+        offsets.push_back(out.size());
+        bool key = (f == 0) || (keyInterval > 0 && f % keyInterval == 0);
+        const uint8_t* frame = frames + f * frameBytes;
+        encodeFrame(frame, key ? nullptr : frame - frameBytes, ledCount, out);
+    }
+
+    uint32_t indexOffset = out.size();
+    for (uint32_t offset : offsets) {
+        write32(out, offset);
+    }
+    out[16] = indexOffset & 0xFF;
+    out[17] = (indexOffset >> 8) & 0xFF;
+    out[18] = (indexOffset >> 16) & 0xFF;
+    out[19] = (indexOffset >> 24) & 0xFF;
+}
+
+}
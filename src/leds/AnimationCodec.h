@@ -0,0 +1,146 @@
+// src/leds/AnimationCodec.h
+#ifndef ANIMATION_CODEC_H
+#define ANIMATION_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+/**
+ * AnimationCodec - Pre-rendered animation files for the lantern's LEDs
+ *
+ * An animation is a list of frames, each holding every LED of the lantern
+ * as RGB bytes in the order core, inner, outer, ring (the same layout as
+ * BakedLoop). Frames are stored as small instructions instead of raw
+ * pixels, so a 360 LED frame that would take 1080 bytes usually shrinks
+ * to a few dozen:
+ *
+ *   SKIP n        next n LEDs keep the color they had in the previous frame
+ *                 (in a key frame: they are black)
+ *   RUN n, rgb    next n LEDs are all the same color
+ *   LITERAL n, …  next n LEDs, one RGB triple each
+ *
+ * Key frames only refer to black, so playback can start (or loop back) at
+ * any of them. Delta frames refer to the frame before them.
+ *
+ * File layout (all numbers little-endian):
+ *
+ *   Header                     20 bytes, see below
+ *   frame data                 one record per frame: type byte, then instructions
+ *   frame index                frameCount uint32 offsets of the records (from the start of the file)
+ *
+ * The index lets the player find any frame without reading the ones
+ * before it, which is what makes playing straight out of memory-mapped
+ * flash possible.
+ *
+ * This file only uses the C++ standard library, so the host tools in
+ * tools/animation build it as it is.
+ */
+namespace AnimationCodec {
+
+    // "LANM" read as a little-endian number
+    static const uint32_t MAGIC = 0x4D4E414C;
+    static const uint16_t VERSION = 1;
+
+    // Header::flags
+    static const uint16_t FLAG_LOOP = 0x0001;  // Start over after the last frame (otherwise hold it)
+
+    // First byte of every frame record
+    static const uint8_t FRAME_KEY = 0;    // Decodes on its own
+    static const uint8_t FRAME_DELTA = 1;  // Changes to the frame before it
+
+    // Instruction byte: top two bits are the opcode, the low six bits the length - 1 (1-64 LEDs)
+    static const uint8_t OP_SKIP = 0x00;
+    static const uint8_t OP_RUN = 0x40;
+    static const uint8_t OP_LITERAL = 0x80;
+    static const uint8_t OP_LONG_SKIP = 0xC0;  // Low six bits and the next byte: 14-bit length - 1
+    static const int SHORT_LENGTH = 64;
+    static const int LONG_LENGTH = 16384;
+
+    /**
+     * The start of every animation file
+     */
+    struct Header {
+        uint32_t magic;        // MAGIC
+        uint16_t version;      // VERSION
+        uint16_t ledCount;     // LEDs per frame
+        uint16_t frameMs;      // Time between frames
+        uint16_t flags;        // FLAG_ values
+        uint32_t frameCount;   // Number of frames
+        uint32_t indexOffset;  // Where the frame index starts
+    };
+
+    /**
+     * Where decoded LEDs go
+     * A frame is written across several spans back to back, so it can be
+     * decoded straight into the separate strip buffers of a render target.
+     */
+    struct Span {
+        uint8_t* rgb;  // RGB bytes of the first LED (nullptr = decode but don't write)
+        int count;     // Number of LEDs
+    };
+
+    /**
+     * Check an animation file and read its header
+     * @param file Start of the file
+     * @param size Bytes available
+     * @param header Filled in when the file is valid
+     * @return True if the header, index and frame offsets all fit inside the file
+     */
+    bool readHeader(const uint8_t* file, size_t size, Header& header);
+
+    /**
+     * Find one frame record
+     * @param file Start of a file that passed readHeader()
+     * @param header Its header
+     * @param index Frame number (0 to frameCount - 1)
+     * @param recordSize Filled in with the size of the record in bytes
+     * @return Start of the record
+     */
+    const uint8_t* frameRecord(const uint8_t* file, const Header& header, uint32_t index, size_t& recordSize);
+
+    /**
+     * Check whether a frame decodes on its own
+     * @param file Start of a file that passed readHeader()
+     * @param header Its header
+     * @param index Frame number
+     */
+    bool isKeyFrame(const uint8_t* file, const Header& header, uint32_t index);
+
+    /**
+     * Decode one frame record in place
+     * Delta frames only write the LEDs that changed, so the spans must still
+     * hold the frame before this one.
+     * @param record Start of the record
+     * @param recordSize Size of the record
+     * @param spans Where the LEDs go, in frame order
+     * @param spanCount Number of spans (their counts must add up to the header's ledCount)
+     * @return False if the record is damaged (LEDs decoded before the damage keep their new colors)
+     */
+    bool decodeFrame(const uint8_t* record, size_t recordSize, const Span* spans, int spanCount);
+
+    /**
+     * Encode one frame and append the record
+     * @param rgb The frame, ledCount RGB triples
+     * @param previous The frame before it, or nullptr to write a key frame
+     * @param ledCount LEDs per frame
+     * @param out Record is appended here
+     * @return Size of the record in bytes
+     */
+    size_t encodeFrame(const uint8_t* rgb, const uint8_t* previous, int ledCount, std::vector<uint8_t>& out);
+
+    /**
+     * Encode a whole animation file
+     * @param frames Frames back to back, ledCount RGB triples each
+     * @param frameCount Number of frames
+     * @param ledCount LEDs per frame
+     * @param frameMs Time between frames
+     * @param flags FLAG_ values
+     * @param keyInterval Frames between key frames (frame 0 is always one, 0 = only frame 0)
+     * @param out Replaced with the file
+     */
+    void encodeFile(const uint8_t* frames, uint32_t frameCount, int ledCount, uint16_t frameMs,
+                    uint16_t flags, uint32_t keyInterval, std::vector<uint8_t>& out);
+}
+
+#endif // ANIMATION_CODEC_H
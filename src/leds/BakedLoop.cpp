@@ -0,0 +1,99 @@
+// src/leds/BakedLoop.cpp
+#include "BakedLoop.h"
+#include "Colors.h"
+
+// Where each strip starts inside a stored frame
+static const int CORE_OFFSET = 0;
+static const int INNER_OFFSET = CORE_OFFSET + LED_STRIP_CORE_COUNT;
+static const int OUTER_OFFSET = INNER_OFFSET + LED_STRIP_INNER_COUNT;
+static const int RING_OFFSET = OUTER_OFFSET + LED_STRIP_OUTER_COUNT;
+
+BakedLoop::BakedLoop() :
+    frames(nullptr),
+    loopFrames(0),
+    seamFrames(0),
+    recordedFrames(0),
+    frameMs(1)
+{
+}
+
+BakedLoop::~BakedLoop() {
+    free(frames);
+}
+
+bool BakedLoop::begin(unsigned long periodMs, unsigned long frameMs, unsigned long seamMs) {
+    free(frames);
+    frames = nullptr;
+
+    this->frameMs = max(1UL, frameMs);
+    loopFrames = framesFor(periodMs, this->frameMs);
+    seamFrames = min((unsigned long)loopFrames / 2, seamMs / this->frameMs);
+    recordedFrames = 0;
+
+    // The frames are only read once or twice per shown frame, so slower
+    // PSRAM is fine - and internal RAM could never hold a loop this size
+    frames = (CRGB*)ps_malloc(getBytes());
+    if (frames == nullptr) {
+        loopFrames = 0;
+        seamFrames = 0;
+        return false;
+    }
+    return true;
+}
+
+void BakedLoop::recordFrame(RenderTarget& frame) {
+    if (frames == nullptr || isComplete()) {
+        return;
+    }
+
+    if (recordedFrames < loopFrames) {
+        // Inside the period - store the frame as it is
+        CRGB* stored = frameAt(recordedFrames);
+        memcpy(stored + CORE_OFFSET, frame.getCore(), LED_STRIP_CORE_COUNT * sizeof(CRGB));
+        memcpy(stored + INNER_OFFSET, frame.getInner(), LED_STRIP_INNER_COUNT * sizeof(CRGB));
+        memcpy(stored + OUTER_OFFSET, frame.getOuter(), LED_STRIP_OUTER_COUNT * sizeof(CRGB));
+        memcpy(stored + RING_OFFSET, frame.getRing(), LED_STRIP_RING_COUNT * sizeof(CRGB));
+    } else {
+        // Past the period: this is where the effect really was one period
+        // after frame i. Frame i starts out close to it and eases over to
+        // what was recorded, so wrapping from the last frame to the first
+        // continues the motion.
+        int i = recordedFrames - loopFrames;
+        uint8_t amount = (uint8_t)((i + 1) * 255 / (seamFrames + 1));
+        CRGB* stored = frameAt(i);
+        Colors::mixSpan(frame.getCore(), stored + CORE_OFFSET, stored + CORE_OFFSET, LED_STRIP_CORE_COUNT, amount);
+        Colors::mixSpan(frame.getInner(), stored + INNER_OFFSET, stored + INNER_OFFSET, LED_STRIP_INNER_COUNT, amount);
+        Colors::mixSpan(frame.getOuter(), stored + OUTER_OFFSET, stored + OUTER_OFFSET, LED_STRIP_OUTER_COUNT, amount);
+        Colors::mixSpan(frame.getRing(), stored + RING_OFFSET, stored + RING_OFFSET, LED_STRIP_RING_COUNT, amount);
+    }
+    recordedFrames++;
+}
+
+void BakedLoop::draw(RenderTarget& out, unsigned long loopTimeMs, bool drawRing) {
+    if (recordedFrames == 0) {
+        return;
+    }
+
+    unsigned long frameNumber = loopTimeMs / frameMs;
+    uint8_t amount = (uint8_t)((loopTimeMs % frameMs) * 255 / frameMs);
+
+    if (!isComplete() && frameNumber + 1 >= (unsigned long)recordedFrames) {
+        // Recording has fallen behind - nothing to blend towards past the newest frame
+        CRGB* newest = frameAt((recordedFrames - 1) % loopFrames);
+        mixFrames(newest, newest, out, 0, drawRing);
+        return;
+    }
+
+    int index = frameNumber % loopFrames;
+    int next = (index + 1 == loopFrames) ? 0 : index + 1;
+    mixFrames(frameAt(index), frameAt(next), out, amount, drawRing);
+}
+
+void BakedLoop::mixFrames(const CRGB* from, const CRGB* to, RenderTarget& out, uint8_t amount, bool drawRing) {
+    Colors::mixSpan(from + CORE_OFFSET, to + CORE_OFFSET, out.getCore(), LED_STRIP_CORE_COUNT, amount);
+    Colors::mixSpan(from + INNER_OFFSET, to + INNER_OFFSET, out.getInner(), LED_STRIP_INNER_COUNT, amount);
+    Colors::mixSpan(from + OUTER_OFFSET, to + OUTER_OFFSET, out.getOuter(), LED_STRIP_OUTER_COUNT, amount);
+    if (drawRing) {
+        Colors::mixSpan(from + RING_OFFSET, to + RING_OFFSET, out.getRing(), LED_STRIP_RING_COUNT, amount);
+    }
+}
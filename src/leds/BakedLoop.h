@@ -0,0 +1,148 @@
+// src/leds/BakedLoop.h
+#ifndef BAKED_LOOP_H
+#define BAKED_LOOP_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "RenderTarget.h"
+
+/**
+ * BakedLoop - One period of a periodic effect, stored in PSRAM and played back
+ *
+ * The loop is recorded while the effect runs: each stored frame is a full
+ * set of strips at a fixed time step (frame interval). Playback blends the
+ * two stored frames around the current time (Colors::mixSpan), so the loop
+ * stays smooth at any frame rate while storing a fraction of the frames
+ * the effect would draw live - a 25fps loop replaces up to 125 live frames
+ * a second.
+ *
+ * Effects whose cycles don't line up exactly at the end of the period
+ * record a little past it. Those frames are crossfaded into the first
+ * frames of the loop as they arrive, so the wrap point is a short
+ * dissolve instead of a jump - and no extra memory is needed for them.
+ *
+ * Memory: about 1KB per stored frame (LED_FRAME_LEDS LEDs), allocated with
+ * ps_malloc() - without PSRAM begin() fails and the effect stays live. A
+ * Rainbow loop is about 690KB, so Effect::setBaked() keeps all loops
+ * together inside BAKE_PSRAM_BUDGET. The frames are stored raw: the baked
+ * effects change every LED a little on every frame, which leaves the
+ * lossless codecs (AnimationCodec, FrameCodec) nothing to squeeze.
+ */
+class BakedLoop {
+public:
+    // LEDs in one stored frame: core, inner, outer and ring, back to back
+    static const int LED_FRAME_LEDS = LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT +
+                                      LED_STRIP_OUTER_COUNT + LED_STRIP_RING_COUNT;
+
+    /**
+     * Constructor - nothing is allocated until begin()
+     */
+    BakedLoop();
+
+    /**
+     * Destructor - frees the frames
+     */
+    ~BakedLoop();
+
+    /**
+     * Allocate an empty loop in PSRAM
+     * @param periodMs Length of the loop
+     * @param frameMs Time between stored frames
+     * @param seamMs Extra time recorded past the period and crossfaded into its start (0 = exact loop)
+     * @return True if the frames were allocated
+     */
+    bool begin(unsigned long periodMs, unsigned long frameMs, unsigned long seamMs);
+
+    /**
+     * Throw the recorded frames away and start recording again (keeps the memory)
+     */
+    void restart() { recordedFrames = 0; }
+
+    /**
+     * Time between stored frames (ms)
+     */
+    unsigned long getFrameMs() const { return frameMs; }
+
+    /**
+     * Number of frames recorded so far (including the seam frames)
+     */
+    int getRecordedFrames() const { return recordedFrames; }
+
+    /**
+     * Number of frames that still have to be recorded
+     * @return 0 once the loop is complete
+     */
+    int framesToRecord() const { return loopFrames + seamFrames - recordedFrames; }
+
+    /**
+     * Check whether the loop is ready for playback
+     */
+    bool isComplete() const { return framesToRecord() == 0; }
+
+    /**
+     * Bytes of PSRAM held by the frames
+     */
+    size_t getBytes() const { return (size_t)loopFrames * LED_FRAME_LEDS * sizeof(CRGB); }
+
+    /**
+     * Bytes of PSRAM begin() would allocate for a loop
+     * @param periodMs Length of the loop
+     * @param frameMs Time between stored frames
+     */
+    static size_t bytesFor(unsigned long periodMs, unsigned long frameMs) {
+        return (size_t)framesFor(periodMs, frameMs) * LED_FRAME_LEDS * sizeof(CRGB);
+    }
+
+    /**
+     * Store the next frame
+     * Frames past the period are crossfaded into the start of the loop
+     * @param frame Frame to copy
+     */
+    void recordFrame(RenderTarget& frame);
+
+    /**
+     * Draw the loop at a point in time
+     * While recording, times past the newest recorded frame show that frame
+     * (record one frame ahead of the time shown to avoid that).
+     * @param out Where to draw
+     * @param loopTimeMs Time since the start of the recording
+     * @param drawRing False to leave the ring alone (button feedback owns it)
+     */
+    void draw(RenderTarget& out, unsigned long loopTimeMs, bool drawRing);
+
+private:
+    CRGB* frames;            // loopFrames frames of LED_FRAME_LEDS in PSRAM
+    int loopFrames;          // Frames in one period
+    int seamFrames;          // Frames recorded past the period for the seam crossfade
+    int recordedFrames;      // Frames recorded so far
+    unsigned long frameMs;   // Time between frames
+
+    /**
+     * Frames stored for one period
+     */
+    static int framesFor(unsigned long periodMs, unsigned long frameMs) {
+        return max(2UL, periodMs / max(1UL, frameMs));
+    }
+
+    /**
+     * Get a stored frame
+     * @param index Frame number
+     */
+    CRGB* frameAt(int index) const { return frames + (size_t)index * LED_FRAME_LEDS; }
+
+    /**
+     * Blend two stored frames into a target
+     * @param from Frame at amount 0
+     * @param to Frame at amount 255
+     * @param out Where to draw
+     * @param amount How far to move from 'from' towards 'to' (0-255)
+     * @param drawRing False to leave the ring alone
+     */
+    static void mixFrames(const CRGB* from, const CRGB* to, RenderTarget& out, uint8_t amount, bool drawRing);
+
+    // One loop per effect - copying would share the frames
+    BakedLoop(const BakedLoop&) = delete;
+    BakedLoop& operator=(const BakedLoop&) = delete;
+};
+
+#endif // BAKED_LOOP_H
@@ -0,0 +1,126 @@
+// src/leds/Colors.h
+#ifndef COLORS_H
+#define COLORS_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * Colors - CRGB helpers shared by the effects
+ *
+ * Effects used to keep their colors as packed 0xRRGGBB numbers and unpack
+ * them through LEDController every time they were drawn, often once for
+ * every pixel. Everything here is inline, so unpacking a constant color
+ * folds away at compile time and effects can hold CRGB values from the start.
+ *
+ * Color constants stay as constexpr 0xRRGGBB codes (FastLED 3.5's CRGB can
+ * not be constexpr) and are turned into CRGB once with fromHex().
+ */
+namespace Colors {
+
+    /**
+     * Unpack a 0xRRGGBB color code
+     * @param hex Color code, for example 0xFF8000 for orange
+     * @return The same color as CRGB
+     */
+    inline CRGB fromHex(uint32_t hex) {
+        return CRGB((hex >> 16) & 0xFF, (hex >> 8) & 0xFF, hex & 0xFF);
+    }
+
+    /**
+     * Pack a CRGB into a 0xRRGGBB color code (for printing and settings)
+     * @param color Color to pack
+     * @return Color code with red in bits 16-23
+     */
+    inline uint32_t toHex(const CRGB& color) {
+        return ((uint32_t)color.r << 16) | ((uint32_t)color.g << 8) | color.b;
+    }
+
+    /**
+     * Turn a 0.0-1.0 brightness into a FastLED scale factor
+     * @param brightness Brightness from 0.0 (off) to 1.0 (full), clamped
+     * @return Scale from 0 to 255
+     */
+    inline uint8_t toScale(float brightness) {
+        if (brightness <= 0.0f) return 0;
+        if (brightness >= 1.0f) return 255;
+        return (uint8_t)(brightness * 255.0f + 0.5f);
+    }
+
+    /**
+     * Dimmed copy of a color
+     * @param color Color to dim
+     * @param scale 0 = black, 255 = unchanged
+     * @return The dimmed color
+     */
+    inline CRGB scaled(CRGB color, uint8_t scale) {
+        color.nscale8(scale);
+        return color;
+    }
+
+    /**
+     * Dimmed copy of a color, with the brightness as a fraction
+     * @param color Color to dim
+     * @param brightness 0.0 = black, 1.0 = unchanged
+     * @return The dimmed color
+     */
+    inline CRGB scaled(CRGB color, float brightness) {
+        return scaled(color, toScale(brightness));
+    }
+
+    /**
+     * Mix two colors
+     * @param from Color at ratio 0.0
+     * @param to Color at ratio 1.0
+     * @param ratio How far to move from 'from' towards 'to' (clamped to 0.0-1.0)
+     * @return The mixed color
+     */
+    inline CRGB mix(const CRGB& from, const CRGB& to, float ratio) {
+        return blend(from, to, toScale(ratio));
+    }
+
+    /**
+     * Mix two whole runs of LEDs into a third, in one pass
+     *
+     * Works on the raw bytes, four at a time: each 32-bit word is split into
+     * two pairs of 16-bit lanes (even and odd bytes) so one multiply mixes
+     * two color channels. That is about four times fewer multiplies than
+     * blending channel by channel, and needs no copies of either input.
+     * 'out' may be the same buffer as 'from' or 'to'.
+     *
+     * @param from Colors at amount 0
+     * @param to Colors at amount 255
+     * @param out Where to write the mixed colors
+     * @param count Number of LEDs
+     * @param amount How far to move from 'from' towards 'to' (0-255)
+     */
+    inline void mixSpan(const CRGB* from, const CRGB* to, CRGB* out, int count, uint8_t amount) {
+        // Weights out of 256 so 255 really gives 'to' and the divide is a shift
+        uint32_t toWeight = amount + (amount >> 7);
+        uint32_t fromWeight = 256 - toWeight;
+
+        const uint8_t* a = (const uint8_t*)from;
+        const uint8_t* b = (const uint8_t*)to;
+        uint8_t* o = (uint8_t*)out;
+        int bytes = count * 3;
+        int i = 0;
+
+        for (; i + 4 <= bytes; i += 4) {
+            uint32_t wa, wb;
+            memcpy(&wa, a + i, 4);  // CRGB arrays are not word aligned
+            memcpy(&wb, b + i, 4);
+
+            uint32_t even = ((wa & 0x00FF00FF) * fromWeight + (wb & 0x00FF00FF) * toWeight) >> 8;
+            uint32_t odd = ((wa >> 8) & 0x00FF00FF) * fromWeight + ((wb >> 8) & 0x00FF00FF) * toWeight;
+            uint32_t mixed = (even & 0x00FF00FF) | (odd & 0xFF00FF00);
+            memcpy(o + i, &mixed, 4);
+        }
+
+        // Leftover bytes one at a time
+        for (; i < bytes; i++) {
+            o[i] = (a[i] * fromWeight + b[i] * toWeight) >> 8;
+        }
+    }
+}
+
+#endif // COLORS_H
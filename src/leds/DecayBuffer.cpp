@@ -0,0 +1,84 @@
+// src/leds/DecayBuffer.cpp
+#include "DecayBuffer.h"
+
+DecayBuffer::DecayBuffer(int length) :
+    length(length),
+    channels(nullptr),
+    decay(65535)
+{
+    channels = new uint16_t[length * 3];
+    clear();
+}
+
+DecayBuffer::~DecayBuffer() {
+    delete[] channels;
+}
+
+void DecayBuffer::clear() {
+    memset(channels, 0, length * 3 * sizeof(uint16_t));
+}
+
+void DecayBuffer::fade(float frames) {
+    // A longer frame fades more: keep^frames (only worked out when the step is not exactly one frame)
+    uint32_t keep = decay;
+    if (frames != 1.0f) {
+        keep = (uint32_t)constrain(powf(decay / 65535.0f, frames) * 65535.0f, 0.0f, 65535.0f);
+    }
+
+    // One multiply per channel - this is the whole per-frame cost of the tails
+    for (int i = 0; i < length * 3; i++) {
+        channels[i] = (uint16_t)((channels[i] * keep) >> 16);
+    }
+}
+
+void DecayBuffer::stamp(int index, const CRGB& color) {
+    if (index < 0 || index >= length) return;
+
+    uint16_t* pixel = &channels[index * 3];
+    uint16_t r = (uint16_t)color.r << 8;
+    uint16_t g = (uint16_t)color.g << 8;
+    uint16_t b = (uint16_t)color.b << 8;
+
+    if (r > pixel[0]) pixel[0] = r;
+    if (g > pixel[1]) pixel[1] = g;
+    if (b > pixel[2]) pixel[2] = b;
+}
+
+void DecayBuffer::stampFaded(int index, const CRGB& color, float framesAgo) {
+    if (index < 0 || index >= length) return;
+
+    // Same fade the LED would have had from fade() since the head was there
+    uint32_t keep = (uint32_t)constrain(powf(decay / 65535.0f, framesAgo) * 65536.0f, 0.0f, 65536.0f);
+    uint16_t* pixel = &channels[index * 3];
+    uint16_t r = (uint16_t)(((uint32_t)color.r << 8) * keep >> 16);
+    uint16_t g = (uint16_t)(((uint32_t)color.g << 8) * keep >> 16);
+    uint16_t b = (uint16_t)(((uint32_t)color.b << 8) * keep >> 16);
+
+    if (r > pixel[0]) pixel[0] = r;
+    if (g > pixel[1]) pixel[1] = g;
+    if (b > pixel[2]) pixel[2] = b;
+}
+
+void DecayBuffer::render(CRGB* out, uint8_t scale) const {
+    // (8.8 value * 8-bit scale) >> 16 gives the final 8-bit channel
+    uint32_t s = (uint32_t)scale + 1;
+    for (int i = 0; i < length; i++) {
+        const uint16_t* pixel = &channels[i * 3];
+        out[i].r = (pixel[0] * s) >> 16;
+        out[i].g = (pixel[1] * s) >> 16;
+        out[i].b = (pixel[2] * s) >> 16;
+    }
+}
+
+uint16_t DecayBuffer::decayForTrail(float pixelsPerFrame, float halfLifePixels) {
+    if (pixelsPerFrame <= 0.0f || halfLifePixels <= 0.0f) {
+        return 0;
+    }
+
+    // The head needs halfLifePixels / pixelsPerFrame frames to move one half-life,
+    // so the per-frame factor is 0.5 raised to the inverse of that frame count
+    float framesPerHalfLife = halfLifePixels / pixelsPerFrame;
+    float keep = powf(0.5f, 1.0f / framesPerHalfLife);
+
+    return (uint16_t)constrain(keep * 65535.0f, 0.0f, 65535.0f);
+}
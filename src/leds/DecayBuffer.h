@@ -0,0 +1,102 @@
+// src/leds/DecayBuffer.h
+#ifndef DECAY_BUFFER_H
+#define DECAY_BUFFER_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * DecayBuffer - Persistence buffer for long-trail effects
+ *
+ * Instead of redrawing every LED of every trail each frame, an effect keeps
+ * one DecayBuffer per strip. Each frame the whole buffer is faded by the
+ * strip's decay factor and only the trail heads are stamped in. The tail
+ * then appears on its own as the older head positions fade away.
+ *
+ * Cost per frame is one pass over the strip plus one write per trail head,
+ * instead of (number of trails x trail length).
+ *
+ * Channels are stored as 8.8 fixed point so slow decay factors (long tails)
+ * keep fading smoothly instead of getting stuck on low 8-bit values.
+ */
+class DecayBuffer {
+public:
+    /**
+     * Constructor
+     * @param length Number of LEDs in the strip this buffer mirrors
+     */
+    DecayBuffer(int length);
+
+    /**
+     * Destructor - free the channel storage
+     */
+    ~DecayBuffer();
+
+    /**
+     * Clear the buffer to black
+     */
+    void clear();
+
+    /**
+     * Set how much of each pixel survives one frame
+     * @param decay Fraction kept per frame in 0.16 fixed point (65535 = no fade)
+     */
+    void setDecay(uint16_t decay) { this->decay = decay; }
+
+    /**
+     * Fade every pixel by the decay factor - call once per frame before stamping
+     * @param frames How many frames' worth of decay to apply (the effect's frameStep),
+     *               so tails keep the same length in time at any frame rate
+     */
+    void fade(float frames = 1.0f);
+
+    /**
+     * Stamp a trail head into the buffer
+     * Uses the per-channel maximum, so a head that stays on the same LED for
+     * several frames does not keep getting brighter
+     * @param index LED index in the strip
+     * @param color Head color at full trail brightness
+     */
+    void stamp(int index, const CRGB& color);
+
+    /**
+     * Stamp a trail head that passed an LED some time ago, already faded by
+     * the decay since then - for warm-ups, which move heads several LEDs per step
+     * @param index LED index in the strip
+     * @param color Head color at full trail brightness
+     * @param framesAgo How many frames ago the head was on this LED
+     */
+    void stampFaded(int index, const CRGB& color, float framesAgo);
+
+    /**
+     * Write the buffer into an LED array, overwriting what was there
+     * @param out Destination LED array (must hold at least getLength() LEDs)
+     * @param scale Overall brightness applied on output (255 = unchanged)
+     */
+    void render(CRGB* out, uint8_t scale = 255) const;
+
+    /**
+     * Get the number of LEDs in this buffer
+     */
+    int getLength() const { return length; }
+
+    /**
+     * Calculate the decay factor that makes a moving head leave a tail
+     * which drops to half brightness a given number of pixels behind it
+     * @param pixelsPerFrame Typical head speed in pixels per frame
+     * @param halfLifePixels Distance behind the head where the tail is at 50%
+     * @return Decay factor suitable for setDecay()
+     */
+    static uint16_t decayForTrail(float pixelsPerFrame, float halfLifePixels);
+
+private:
+    int length;          // Number of LEDs
+    uint16_t* channels;  // 3 channels per LED, 8.8 fixed point
+    uint16_t decay;      // Fraction kept per frame (0.16 fixed point)
+
+    // Owns its channel storage - a copy would free it twice
+    DecayBuffer(const DecayBuffer&) = delete;
+    DecayBuffer& operator=(const DecayBuffer&) = delete;
+};
+
+#endif // DECAY_BUFFER_H
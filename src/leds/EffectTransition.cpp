@@ -0,0 +1,76 @@
+// src/leds/EffectTransition.cpp
+#include "EffectTransition.h"
+
+EffectTransition::EffectTransition() :
+    worker(nullptr),
+    outgoing(nullptr),
+    incoming(nullptr),
+    active(false),
+    startTime(0),
+    duration(0),
+    shortened(false)
+{
+}
+
+void EffectTransition::start(Effect* from, Effect* to, RenderTarget& screen, unsigned long durationMs) {
+    outgoing = from;
+    incoming = to;
+    startTime = millis();
+    duration = durationMs;
+    shortened = false;
+    active = true;
+
+    // The outgoing effect carries on from what is on screen, the incoming one starts dark
+    outgoingFrame.copyFrom(screen);
+    incomingFrame.clearAll();
+}
+
+bool EffectTransition::render(RenderTarget& out, unsigned long frameBudgetUs, bool drawRing) {
+    if (!active) {
+        return false;
+    }
+
+    unsigned long elapsed = millis() - startTime;
+    if (elapsed >= duration) {
+        // Fade complete - hand the incoming effect its own frame back, so effects
+        // that build on their previous frame (trails, fades) carry on smoothly
+        out.copyFrom(incomingFrame, drawRing);
+        active = false;
+        return true;
+    }
+
+    // Both effects keep running, each in its own frame - on two cores if we can
+    // (not when one draws the other, e.g. leaving the party cycle for one of its effects)
+    unsigned long renderStart = micros();
+    bool parallel = worker != nullptr &&
+                    !outgoing->containsEffect(incoming) && !incoming->containsEffect(outgoing) &&
+                    worker->start(incoming, incomingFrame);
+    bool outgoingDrawn = outgoing->update(outgoingFrame);
+    bool incomingDrawn = parallel ? worker->finish() : incoming->update(incomingFrame);
+
+    // Keep the frame rate: if drawing both effects ran over budget, halve what
+    // is left of the fade so the slow part ends sooner - once, so a slow pair
+    // still gets a fade rather than collapsing into a cut
+    unsigned long renderMicros = micros() - renderStart;
+    if (frameBudgetUs > 0 && renderMicros > frameBudgetUs && !shortened) {
+        duration = elapsed + (duration - elapsed) / 2;
+        shortened = true;
+        Serial.print("Transition over budget (");
+        Serial.print(renderMicros);
+        Serial.print("us) - shortened to ");
+        Serial.print(duration);
+        Serial.println("ms");
+    }
+
+    if (!outgoingDrawn && !incomingDrawn) {
+        // Neither has a new frame yet - keep the last blend
+        return false;
+    }
+
+    // Smooth S-curve so the fade starts and ends gently
+    float progress = (float)elapsed / (float)duration;
+    float smoothProgress = progress * progress * (3.0f - 2.0f * progress);
+
+    out.mixFrom(outgoingFrame, incomingFrame, (uint8_t)(smoothProgress * 255), drawRing);
+    return true;
+}
@@ -0,0 +1,96 @@
+// src/leds/EffectTransition.h
+#ifndef EFFECT_TRANSITION_H
+#define EFFECT_TRANSITION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "RenderTarget.h"
+#include "RenderWorker.h"
+#include "effects/Effect.h"
+
+/**
+ * EffectTransition - Crossfades from one effect to another
+ *
+ * While a transition runs, both effects keep animating, each into its own
+ * OffscreenTarget, and every frame shown is a blend of the two
+ * (RenderTarget::mixFrom). The outgoing effect starts from whatever was on
+ * the strips, so switching in the middle of a fade carries on smoothly.
+ *
+ * With a RenderWorker the incoming effect is drawn on core 0 while the
+ * outgoing one is drawn here, so a frame costs the slower of the two
+ * instead of both. If a transition frame still takes longer than the
+ * frame budget, the rest of the fade is cut to half (once per
+ * transition) instead of stuttering through all of it.
+ */
+class EffectTransition {
+public:
+    /**
+     * Constructor - allocates the two frames (about 2KB)
+     */
+    EffectTransition();
+
+    /**
+     * Draw the incoming effect on another core
+     * @param worker Worker to use (nullptr = draw both effects here)
+     */
+    void setRenderWorker(RenderWorker* worker) { this->worker = worker; }
+
+    /**
+     * Start fading from one effect to another
+     * @param from Effect being faded out
+     * @param to Effect being faded in
+     * @param screen Frame currently on the strips (the outgoing effect continues from it)
+     * @param durationMs How long the fade takes
+     */
+    void start(Effect* from, Effect* to, RenderTarget& screen, unsigned long durationMs);
+
+    /**
+     * Stop the transition without drawing anything else
+     */
+    void cancel() { active = false; }
+
+    /**
+     * Draw one transition frame
+     * When the fade is over the incoming effect's frame is copied into 'out'
+     * and the transition stops - the caller then runs that effect directly.
+     * @param out Where to draw the blended frame
+     * @param frameBudgetUs Longest a transition frame may take before the fade is shortened (0 = no limit)
+     * @param drawRing False to leave the ring of 'out' alone (button feedback is showing on it)
+     * @return True if a new frame was drawn into 'out'
+     */
+    bool render(RenderTarget& out, unsigned long frameBudgetUs, bool drawRing = true);
+
+    /**
+     * Check whether a transition is running
+     * @return True between start() and the end of the fade
+     */
+    bool isActive() const { return active; }
+
+    /**
+     * Get the effect being faded out
+     * @return Outgoing effect (only meaningful while active)
+     */
+    Effect* getOutgoing() const { return outgoing; }
+
+    /**
+     * Get the effect being faded in
+     * @return Incoming effect (only meaningful while active)
+     */
+    Effect* getIncoming() const { return incoming; }
+
+private:
+    OffscreenTarget outgoingFrame;   // Frames of the effect being faded out
+    OffscreenTarget incomingFrame;   // Frames of the effect being faded in
+
+    RenderWorker* worker;            // Draws the incoming effect in parallel (nullptr = none)
+
+    Effect* outgoing;                // Effect being faded out
+    Effect* incoming;                // Effect being faded in
+    bool active;                     // True while a fade is running
+
+    unsigned long startTime;         // When the fade started (millis)
+    unsigned long duration;          // Length of the fade - shortened when frames run over budget
+    bool shortened;                  // The fade was already shortened once
+};
+
+#endif // EFFECT_TRANSITION_H
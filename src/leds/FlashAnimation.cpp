@@ -0,0 +1,117 @@
+// src/leds/FlashAnimation.cpp
+#include "FlashAnimation.h"
+
+// LEDs in one frame: core, inner, outer and ring, back to back
+static const int FRAME_LEDS = LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT +
+                              LED_STRIP_OUTER_COUNT + LED_STRIP_RING_COUNT;
+
+FlashAnimation::FlashAnimation() :
+    data(nullptr),
+    size(0),
+    mapHandle(0),
+    header()
+{
+}
+
+FlashAnimation::~FlashAnimation() {
+    close();
+}
+
+bool FlashAnimation::open(const char* partitionLabel) {
+    close();
+
+    const esp_partition_t* partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partitionLabel);
+    if (partition == nullptr) {
+        Serial.print("No animation partition named ");
+        Serial.println(partitionLabel);
+        return false;
+    }
+
+    // Read the start of the header first, so only the bytes the file uses get mapped
+    uint8_t start[20];
+    if (esp_partition_read(partition, 0, start, sizeof(start)) != ESP_OK) {
+        return false;
+    }
+    uint32_t frameCount = start[12] | (start[13] << 8) | (start[14] << 16) | ((uint32_t)start[15] << 24);
+    uint32_t indexOffset = start[16] | (start[17] << 8) | (start[18] << 16) | ((uint32_t)start[19] << 24);
+    if (indexOffset > partition->size || frameCount > (partition->size - indexOffset) / 4) {
+        Serial.println("Animation partition is empty");  // Erased flash reads as 0xFF
+        return false;
+    }
+    size_t fileSize = max((size_t)sizeof(start), (size_t)(indexOffset + frameCount * 4));
+
+    const void* mapped = nullptr;
+    if (esp_partition_mmap(partition, 0, fileSize, SPI_FLASH_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) {
+        Serial.println("Could not map the animation partition");
+        return false;
+    }
+    data = (const uint8_t*)mapped;
+    size = fileSize;
+
+    if (!AnimationCodec::readHeader(data, size, header) || header.ledCount != FRAME_LEDS) {
+        Serial.println("Animation partition does not hold an animation for this lantern");
+        close();
+        return false;
+    }
+
+    Serial.print("Mapped animation: ");
+    Serial.print(header.frameCount);
+    Serial.print(" frames at ");
+    Serial.print(header.frameMs);
+    Serial.print("ms, ");
+    Serial.print(size);
+    Serial.println(" bytes of flash");
+    return true;
+}
+
+bool FlashAnimation::isStored(const char* partitionLabel) {
+    FlashAnimation probe;
+    return probe.open(partitionLabel);  // Unmapped again when probe goes away
+}
+
+void FlashAnimation::close() {
+    if (data != nullptr) {
+        spi_flash_munmap(mapHandle);
+        data = nullptr;
+    }
+    size = 0;
+}
+
+uint32_t FlashAnimation::keyFrameBefore(uint32_t index) const {
+    while (index > 0 && !AnimationCodec::isKeyFrame(data, header, index)) {
+        index--;
+    }
+    return index;
+}
+
+bool FlashAnimation::decode(uint32_t index, RenderTarget& target, bool drawRing) {
+    if (!isOpen() || index >= header.frameCount) {
+        return false;
+    }
+
+    // CRGB is three bytes in R, G, B order, so the strips are decoded into directly
+    const AnimationCodec::Span spans[] = {
+        {(uint8_t*)target.getCore(), LED_STRIP_CORE_COUNT},
+        {(uint8_t*)target.getInner(), LED_STRIP_INNER_COUNT},
+        {(uint8_t*)target.getOuter(), LED_STRIP_OUTER_COUNT},
+        {drawRing ? (uint8_t*)target.getRing() : nullptr, LED_STRIP_RING_COUNT}
+    };
+
+    size_t recordSize;
+    const uint8_t* record = AnimationCodec::frameRecord(data, header, index, recordSize);
+    return AnimationCodec::decodeFrame(record, recordSize, spans, 4);
+}
+
+bool FlashAnimation::seek(uint32_t index, RenderTarget& target, bool drawRing) {
+    if (!isOpen() || index >= header.frameCount) {
+        return false;
+    }
+
+    for (uint32_t frame = keyFrameBefore(index); frame <= index; frame++) {
+        if (!decode(frame, target, drawRing)) {
+            return false;
+        }
+    }
+    return true;
+}
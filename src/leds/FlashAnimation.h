@@ -0,0 +1,119 @@
+// src/leds/FlashAnimation.h
+#ifndef FLASH_ANIMATION_H
+#define FLASH_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <esp_partition.h>
+#include "RenderTarget.h"
+#include "AnimationCodec.h"
+
+/**
+ * FlashAnimation - Plays an AnimationCodec file straight out of flash
+ *
+ * The file is written to its own flash partition (see partitions.csv and
+ * tools/animation) and mapped into the address space with
+ * esp_partition_mmap(), so frames are read where they sit - nothing is
+ * copied into RAM. Decoding writes the LEDs directly into the buffers of
+ * a render target, and delta frames only touch the LEDs that changed.
+ *
+ * Delta frames build on whatever the target holds, so frames have to be
+ * decoded in order into the same target. seek() gets there from the
+ * nearest key frame when that is not the case.
+ */
+class FlashAnimation {
+public:
+    /**
+     * Constructor - nothing is mapped until open()
+     */
+    FlashAnimation();
+
+    /**
+     * Destructor - unmaps the partition
+     */
+    ~FlashAnimation();
+
+    /**
+     * Map the animation stored in a partition
+     * @param partitionLabel Name of the data partition in partitions.csv
+     * @return True if the partition holds a valid animation for this lantern's LED count
+     */
+    bool open(const char* partitionLabel);
+
+    /**
+     * Unmap the partition
+     */
+    void close();
+
+    /**
+     * Check whether a partition holds a valid animation, without keeping it mapped
+     * @param partitionLabel Name of the data partition in partitions.csv
+     * @return True if open() would succeed
+     */
+    static bool isStored(const char* partitionLabel);
+
+    /**
+     * Check whether an animation is mapped
+     */
+    bool isOpen() const { return data != nullptr; }
+
+    /**
+     * Number of frames (0 when nothing is open)
+     */
+    uint32_t getFrameCount() const { return isOpen() ? header.frameCount : 0; }
+
+    /**
+     * Time between frames (ms)
+     */
+    unsigned long getFrameMs() const { return header.frameMs; }
+
+    /**
+     * True if the animation starts over after the last frame, false if it holds it
+     */
+    bool loops() const { return (header.flags & AnimationCodec::FLAG_LOOP) != 0; }
+
+    /**
+     * Bytes of flash the animation takes
+     */
+    size_t getBytes() const { return isOpen() ? size : 0; }
+
+    /**
+     * Find where decoding has to start to reach a frame
+     * @param index Frame number
+     * @return The nearest key frame at or before it
+     */
+    uint32_t keyFrameBefore(uint32_t index) const;
+
+    /**
+     * Decode one frame into a target
+     * Key frames can be decoded anywhere; a delta frame needs the target to
+     * hold the frame before it.
+     * @param index Frame number
+     * @param target Where to draw
+     * @param drawRing False to leave the ring alone (button feedback owns it)
+     * @return False if the frame is damaged or nothing is open
+     */
+    bool decode(uint32_t index, RenderTarget& target, bool drawRing);
+
+    /**
+     * Decode a frame into a target that may hold anything
+     * Starts at the nearest key frame and decodes the delta frames up to it.
+     * @param index Frame number
+     * @param target Where to draw
+     * @param drawRing False to leave the ring alone
+     * @return False if a frame on the way is damaged or nothing is open
+     */
+    bool seek(uint32_t index, RenderTarget& target, bool drawRing);
+
+private:
+    const uint8_t* data;                 // Start of the mapped file (nullptr = closed)
+    size_t size;                         // Mapped bytes
+    spi_flash_mmap_handle_t mapHandle;   // For unmapping
+    AnimationCodec::Header header;
+
+    // Mapping the same partition twice would unmap it under the other copy
+    FlashAnimation(const FlashAnimation&) = delete;
+    FlashAnimation& operator=(const FlashAnimation&) = delete;
+};
+
+#endif // FLASH_ANIMATION_H
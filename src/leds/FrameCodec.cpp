@@ -0,0 +1,286 @@
+// src/leds/FrameCodec.cpp
+#include "FrameCodec.h"
+#include <string.h>
+
+namespace FrameCodec {
+
+Encoder::Encoder(const int* stripLengths, int stripCount, const Options& options) :
+    stripLengths(stripLengths, stripLengths + stripCount),
+    framesToKey(stripCount, 0),
+    options(options),
+    frameLeds(0),
+    started(false)
+{
+    for (int i = 0; i < stripCount; i++) {
+        frameLeds += stripLengths[i];
+    }
+    previous.assign(frameLeds * 3, 0);
+}
+
+void Encoder::restart() {
+    started = false;
+}
+
+size_t Encoder::encode(const uint8_t* rgb, std::vector<uint8_t>& out) {
+    size_t start = out.size();
+    int stripCount = stripLengths.size();
+    const uint8_t* strip = rgb;
+    const uint8_t* before = previous.data();
+
+    for (int s = 0; s < stripCount; s++) {
+        int leds = stripLengths[s];
+        bool keyDue = !started || (options.keyInterval > 0 && framesToKey[s] <= 0);
+
+        if (!keyDue && memcmp(strip, before, leds * 3) == 0) {
+            out.push_back(BLOCK_SAME);
+            framesToKey[s]--;
+        } else {
+            // Try every coding that is allowed and keep the smallest
+            best.clear();
+            best.push_back(BLOCK_KEY);
+            encodeXor(strip, nullptr, leds, best);
+
+            candidate.clear();
+            candidate.push_back(BLOCK_PALETTE);
+            if (encodePalette(strip, leds, candidate) && candidate.size() < best.size()) {
+                best.swap(candidate);
+            }
+
+            if (!keyDue) {
+                candidate.clear();
+                candidate.push_back(BLOCK_DELTA);
+                encodeXor(strip, before, leds, candidate);
+                if (candidate.size() < best.size()) {
+                    best.swap(candidate);
+                }
+            }
+
+            out.insert(out.end(), best.begin(), best.end());
+            if (best[0] == BLOCK_DELTA) {
+                framesToKey[s]--;
+            } else if (!started) {
+                // The strips take turns with their keys after the first frame
+                framesToKey[s] = options.keyInterval * (s + 1) / stripCount;
+            } else {
+                framesToKey[s] = options.keyInterval;
+            }
+        }
+
+        strip += leds * 3;
+        before += leds * 3;
+    }
+
+    memcpy(previous.data(), rgb, previous.size());
+    started = true;
+    return out.size() - start;
+}
+
+void Encoder::encodeXor(const uint8_t* rgb, const uint8_t* previous, int leds, std::vector<uint8_t>& out) {
+    int bytes = leds * 3;
+    auto x = [&](int i) -> uint8_t {
+        return previous != nullptr ? rgb[i] ^ previous[i] : rgb[i];
+    };
+
+    int i = 0;
+    while (i < bytes) {
+        int length = 1;
+        if (x(i) == 0) {
+            // Bytes that did not change (zero bytes, in a key)
+            while (i + length < bytes && length < MAX_OP_LENGTH && x(i + length) == 0) length++;
+            out.push_back(length - 1);
+        } else {
+            // Changed bytes, until three zeros in a row make a run cheaper
+            while (i + length < bytes && length < MAX_OP_LENGTH) {
+                int next = i + length;
+                bool zerosAhead = x(next) == 0 &&
+                                  (next + 1 >= bytes || x(next + 1) == 0) &&
+                                  (next + 2 >= bytes || x(next + 2) == 0);
+                if (zerosAhead) break;
+                length++;
+            }
+            out.push_back(OP_LITERAL | (length - 1));
+            for (int k = 0; k < length; k++) {
+                out.push_back(x(i + k));
+            }
+        }
+        i += length;
+    }
+}
+
+bool Encoder::encodePalette(const uint8_t* rgb, int leds, std::vector<uint8_t>& out) {
+    if (options.paletteColors <= 0) {
+        return false;
+    }
+    int maxColors = options.paletteColors < 256 ? options.paletteColors : 256;
+
+    // Collect the colors - strips that can use a palette only have a few,
+    // so a straight search is fast enough
+    palette.clear();
+    size_t paletteStart = out.size();
+    out.push_back(0);  // Color count - 1, filled in below
+
+    pixelIndex.resize(leds);
+    for (int i = 0; i < leds; i++) {
+        uint32_t color = (rgb[i * 3] << 16) | (rgb[i * 3 + 1] << 8) | rgb[i * 3 + 2];
+        int index = 0;
+        while (index < (int)palette.size() && palette[index] != color) index++;
+        if (index == (int)palette.size()) {
+            if ((int)palette.size() == maxColors) {
+                out.resize(paletteStart);
+                return false;
+            }
+            palette.push_back(color);
+            out.push_back(color >> 16);
+            out.push_back((color >> 8) & 0xFF);
+            out.push_back(color & 0xFF);
+        }
+        pixelIndex[i] = index;
+    }
+    out[paletteStart] = palette.size() - 1;
+
+    // Indices: runs of one index, or single indices until a run of three starts
+    int i = 0;
+    while (i < leds) {
+        int run = 1;
+        while (i + run < leds && run < MAX_OP_LENGTH && pixelIndex[i + run] == pixelIndex[i]) run++;
+        if (run >= 2) {
+            out.push_back(run - 1);
+            out.push_back(pixelIndex[i]);
+            i += run;
+            continue;
+        }
+
+        int length = 1;
+        while (i + length < leds && length < MAX_OP_LENGTH) {
+            int next = i + length;
+            bool runAhead = next + 2 < leds &&
+                            pixelIndex[next] == pixelIndex[next + 1] &&
+                            pixelIndex[next] == pixelIndex[next + 2];
+            if (runAhead) break;
+            length++;
+        }
+        out.push_back(OP_LITERAL | (length - 1));
+        out.insert(out.end(), pixelIndex.begin() + i, pixelIndex.begin() + i + length);
+        i += length;
+    }
+    return true;
+}
+
+/**
+ * Decode a DELTA or KEY block into one strip
+ * @return Bytes of block data used, or 0 if it is damaged
+ */
+static size_t decodeXor(const uint8_t* data, size_t size, uint8_t* out, int leds, bool key) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    int bytes = leds * 3;
+    int pos = 0;
+
+    while (pos < bytes) {
+        if (p >= end) return 0;
+        uint8_t op = *p++;
+        int length = (op & 0x7F) + 1;
+        if (length > bytes - pos) return 0;
+
+        if (op & OP_LITERAL) {
+            if (end - p < length) return 0;
+            if (out != nullptr) {
+                if (key) {
+                    memcpy(out + pos, p, length);
+                } else {
+                    uint8_t* o = out + pos;
+                    for (int i = 0; i < length; i++) o[i] ^= p[i];
+                }
+            }
+            p += length;
+        } else if (key && out != nullptr) {
+            // A run of zeros: black in a key, unchanged in a delta
+            memset(out + pos, 0, length);
+        }
+        pos += length;
+    }
+    return p - data;
+}
+
+/**
+ * Decode a PALETTE block into one strip
+ * @return Bytes of block data used, or 0 if it is damaged
+ */
+static size_t decodePalette(const uint8_t* data, size_t size, uint8_t* out, int leds) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    if (p >= end) return 0;
+
+    int colors = *p++ + 1;
+    if (end - p < colors * 3) return 0;
+    const uint8_t* palette = p;
+    p += colors * 3;
+
+    int pos = 0;
+    while (pos < leds) {
+        if (p >= end) return 0;
+        uint8_t op = *p++;
+        int length = (op & 0x7F) + 1;
+        if (length > leds - pos) return 0;
+
+        if (op & OP_LITERAL) {
+            if (end - p < length) return 0;
+            for (int i = 0; i < length; i++) {
+                if (p[i] >= colors) return 0;
+                if (out != nullptr) memcpy(out + (pos + i) * 3, palette + p[i] * 3, 3);
+            }
+            p += length;
+        } else {
+            if (p >= end || *p >= colors) return 0;
+            if (out != nullptr) {
+                const uint8_t* color = palette + *p * 3;
+                for (int i = 0; i < length; i++) memcpy(out + (pos + i) * 3, color, 3);
+            }
+            p++;
+        }
+        pos += length;
+    }
+    return p - data;
+}
+
+bool decode(const uint8_t* data, size_t size, const AnimationCodec::Span* strips, int stripCount,
+            uint8_t* keyed) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    if (keyed != nullptr) *keyed = 0;
+
+    for (int s = 0; s < stripCount; s++) {
+        if (p >= end) return false;
+        uint8_t type = *p++;
+        uint8_t* out = strips[s].rgb;
+        int leds = strips[s].count;
+
+        size_t used;
+        switch (type) {
+            case BLOCK_SAME:
+                continue;
+            case BLOCK_DELTA:
+                used = decodeXor(p, end - p, out, leds, false);
+                break;
+            case BLOCK_KEY:
+                used = decodeXor(p, end - p, out, leds, true);
+                break;
+            case BLOCK_PALETTE:
+                used = decodePalette(p, end - p, out, leds);
+                break;
+            default:
+                return false;
+        }
+        if (used == 0 && leds > 0) {
+            return false;
+        }
+        p += used;
+
+        if (keyed != nullptr && type != BLOCK_DELTA) {
+            *keyed |= 1 << s;
+        }
+    }
+    return p == end;
+}
+
+}
@@ -0,0 +1,140 @@
+// src/leds/FrameCodec.h
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "AnimationCodec.h"
+
+/**
+ * FrameCodec - Compresses a stream of lantern frames, strip by strip
+ *
+ * Made for sending frames somewhere as they are drawn (recording over
+ * Serial, streaming): every frame is coded against the one before it, and
+ * the receiver decodes each frame in place over the last one.
+ *
+ * Each strip of a frame is one block, coded whichever of these ways is
+ * smallest:
+ *
+ *   SAME      the strip did not change (1 byte)
+ *   DELTA     the strip's bytes XORed with the previous frame. Unchanged
+ *             bytes XOR to zero, so the result is mostly runs of zeros,
+ *             which are run-length coded. Decoding XORs the bytes back into
+ *             the buffer that holds the previous frame - no second frame
+ *             buffer is needed on either side.
+ *   KEY       the strip on its own (the same coding, against black)
+ *   PALETTE   optional: up to 256 colors, then one run-length coded index
+ *             per LED. Solid and gradient-stepped strips shrink a lot.
+ *
+ * Keys and palette blocks don't depend on earlier frames. Each strip gets
+ * one every keyInterval frames, with the strips taking turns, so a receiver
+ * that missed data recovers strip by strip without a big key frame.
+ *
+ * Why not AnimationCodec: that format is made for playing from flash. It
+ * works in whole LEDs, keys whole frames and indexes every frame so the
+ * player can seek. A live stream can't be indexed and loses records, and
+ * its LEDs often change one channel while the others stay put - byte XOR
+ * runs skip the unchanged channels, where an LED skip needs the whole LED
+ * to match. anim_tool turns a decoded stream into an AnimationCodec file.
+ *
+ * On the lantern, LEDController::captureFrame() decodes every record it
+ * sends, so the stream is checked where it is made.
+ *
+ * This file only uses the C++ standard library, so the host tools in
+ * tools/animation build it as it is.
+ */
+namespace FrameCodec {
+
+    // First byte of every strip block
+    static const uint8_t BLOCK_SAME = 0;
+    static const uint8_t BLOCK_DELTA = 1;
+    static const uint8_t BLOCK_KEY = 2;
+    static const uint8_t BLOCK_PALETTE = 3;
+
+    // Run-length instruction byte: top bit clear = run, set = literal; low seven bits = length - 1
+    static const uint8_t OP_LITERAL = 0x80;
+    static const int MAX_OP_LENGTH = 128;
+
+    static const int MAX_STRIPS = 8;
+
+    /**
+     * Encoder settings
+     */
+    struct Options {
+        int keyInterval = 64;    // Frames between keys of each strip (0 = only the first frame)
+        int paletteColors = 256; // Most colors a palette block may have (0 = no palette blocks, max 256)
+    };
+
+    /**
+     * Codes frames against the one before them
+     * Frames are given as all strips back to back, RGB bytes per LED.
+     */
+    class Encoder {
+    public:
+        /**
+         * Constructor
+         * @param stripLengths LEDs in each strip, in frame order
+         * @param stripCount Number of strips (up to MAX_STRIPS)
+         * @param options Encoder settings
+         */
+        Encoder(const int* stripLengths, int stripCount, const Options& options = Options());
+
+        /**
+         * Code the next frame and append it
+         * @param rgb The frame
+         * @param out Coded frame is appended here
+         * @return Size of the coded frame in bytes
+         */
+        size_t encode(const uint8_t* rgb, std::vector<uint8_t>& out);
+
+        /**
+         * Key every strip in the next frame (for a receiver that starts listening now)
+         */
+        void restart();
+
+        /**
+         * LEDs per frame
+         */
+        int getFrameLeds() const { return frameLeds; }
+
+    private:
+        std::vector<int> stripLengths;
+        std::vector<uint8_t> previous;      // The last frame that was coded
+        std::vector<int> framesToKey;       // Frames until each strip is keyed again
+        std::vector<uint8_t> candidate;     // Scratch for comparing block sizes
+        std::vector<uint8_t> best;
+        std::vector<uint32_t> palette;      // Scratch for palette blocks
+        std::vector<uint8_t> pixelIndex;
+        Options options;
+        int frameLeds;
+        bool started;                       // False until the first frame (everything is keyed)
+
+        /**
+         * Code a strip as DELTA (previous given) or KEY (previous = nullptr)
+         */
+        void encodeXor(const uint8_t* rgb, const uint8_t* previous, int leds, std::vector<uint8_t>& out);
+
+        /**
+         * Code a strip as PALETTE
+         * @return False if the strip has more colors than the options allow
+         */
+        bool encodePalette(const uint8_t* rgb, int leds, std::vector<uint8_t>& out);
+    };
+
+    /**
+     * Decode a frame in place
+     * The strips must hold the previous frame; strips whose block is SAME or
+     * DELTA are only partly written.
+     * @param data Coded frame
+     * @param size Its size
+     * @param strips Strip buffers in frame order (nullptr = skip that strip's block)
+     * @param stripCount Number of strips, the same as the encoder's
+     * @param keyed If given, bit N is set when strip N was coded on its own (KEY or PALETTE)
+     * @return False if the data is damaged or does not cover every strip
+     */
+    bool decode(const uint8_t* data, size_t size, const AnimationCodec::Span* strips, int stripCount,
+                uint8_t* keyed = nullptr);
+}
+
+#endif // FRAME_CODEC_H
@@ -0,0 +1,80 @@
+// src/leds/HSVKernel.cpp
+#include "HSVKernel.h"
+
+CRGB HSVKernel::palette[256];
+bool HSVKernel::paletteReady = false;
+
+const CRGB* HSVKernel::rainbowPalette() {
+    if (!paletteReady) {
+        build();
+    }
+    return palette;
+}
+
+void HSVKernel::build() {
+    for (int hue = 0; hue < 256; hue++) {
+        hsv2rgb_rainbow(CHSV(hue, 255, 255), palette[hue]);
+    }
+    paletteReady = true;
+}
+
+CRGB HSVKernel::rainbow(uint8_t hue, uint8_t val) {
+    CRGB color = rainbowPalette()[hue];
+
+    if (val != 255) {
+        // hsv2rgb_rainbow dims with val squared for a more natural brightness curve
+        color.nscale8_video(scale8_video(val, val));
+    }
+
+    return color;
+}
+
+CRGB HSVKernel::hsv(uint8_t hue, uint8_t sat, uint8_t val) {
+    if (sat == 255) {
+        return rainbow(hue, val);
+    }
+
+    CRGB color;
+    hsv2rgb_rainbow(CHSV(hue, sat, val), color);
+    return color;
+}
+
+void HSVKernel::fillRainbow(CRGB* out, int count, uint16_t startHue, uint32_t hueRange) {
+    if (count <= 0) return;
+
+    const CRGB* table = rainbowPalette();
+
+    // Walk the hue in 8.24 fixed point: the top byte is the palette index
+    uint32_t hue = (uint32_t)startHue << 16;
+    uint32_t step = (uint32_t)(((uint64_t)hueRange << 16) / count);
+
+    for (int i = 0; i < count; i++) {
+        out[i] = table[hue >> 24];
+        hue += step;
+    }
+}
+
+void HSVKernel::benchmark() {
+    const int NUM_CONVERSIONS = 10000;
+    static CRGB output[256];
+
+    // Before: one hsv2rgb_rainbow() call per pixel
+    unsigned long start = micros();
+    for (int i = 0; i < NUM_CONVERSIONS; i++) {
+        hsv2rgb_rainbow(CHSV(i, 255, 255), output[i & 255]);
+    }
+    unsigned long perPixelMicros = max(1UL, micros() - start);
+
+    // After: palette spans
+    rainbowPalette();
+    start = micros();
+    for (int done = 0; done < NUM_CONVERSIONS; done += 256) {
+        fillRainbow(output, min(256, NUM_CONVERSIONS - done), done, 65536);
+    }
+    unsigned long spanMicros = max(1UL, micros() - start);
+
+    Serial.print("HSV conversions/s - hsv2rgb_rainbow: ");
+    Serial.print((unsigned long)(NUM_CONVERSIONS * 1000000.0f / perPixelMicros));
+    Serial.print(", rainbow palette span: ");
+    Serial.println((unsigned long)(NUM_CONVERSIONS * 1000000.0f / spanMicros));
+}
@@ -0,0 +1,73 @@
+// src/leds/HSVKernel.h
+#ifndef HSV_KERNEL_H
+#define HSV_KERNEL_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * HSVKernel - Fast HSV to RGB conversion for rainbow effects
+ *
+ * Most rainbow effects only ever ask for full-saturation, full-brightness
+ * colors, and there are only 256 of those. They are converted once into a
+ * shared palette, so a rainbow pixel becomes a single table read instead of
+ * a full hsv2rgb_rainbow() call.
+ *
+ * fillRainbow() writes a whole span of LEDs with a hue that steps evenly
+ * along it, which is what the rainbow gradients do on every strip.
+ *
+ * Colors that are not fully saturated still go through hsv2rgb_rainbow().
+ */
+class HSVKernel {
+public:
+    /**
+     * Get the 256-entry rainbow palette (saturation 255, value 255)
+     * Built the first time it is requested
+     * @return Pointer to 256 colors indexed by hue
+     */
+    static const CRGB* rainbowPalette();
+
+    /**
+     * Full-saturation rainbow color
+     * @param hue Hue (0-255)
+     * @param val Brightness (0-255), dimmed the same way hsv2rgb_rainbow() does
+     * @return The color, same as CHSV(hue, 255, val)
+     */
+    static CRGB rainbow(uint8_t hue, uint8_t val = 255);
+
+    /**
+     * Any HSV color - uses the palette when saturation is full
+     * @param hue Hue (0-255)
+     * @param sat Saturation (0-255)
+     * @param val Brightness (0-255)
+     * @return The color, same as CHSV(hue, sat, val)
+     */
+    static CRGB hsv(uint8_t hue, uint8_t sat, uint8_t val);
+
+    /**
+     * Fill a span of LEDs with an evenly spread rainbow
+     * LED i gets hue startHue + i * hueRange / count (16-bit hues, 65536 = full circle)
+     * @param out First LED to write
+     * @param count Number of LEDs to write
+     * @param startHue 16-bit hue of the first LED
+     * @param hueRange 16-bit hue distance covered by the whole span (65536 = one full rainbow)
+     */
+    static void fillRainbow(CRGB* out, int count, uint16_t startHue, uint32_t hueRange);
+
+    /**
+     * Print HSV conversion speed over Serial, per call versus palette span
+     * Run from SmartLantern::begin() when frame profiling is switched on
+     */
+    static void benchmark();
+
+private:
+    static CRGB palette[256];  // Full-saturation, full-value rainbow
+    static bool paletteReady;
+
+    /**
+     * Fill the palette (runs once)
+     */
+    static void build();
+};
+
+#endif // HSV_KERNEL_H
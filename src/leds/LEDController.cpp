@@ -1,8 +1,64 @@
 // src/leds/LEDController.cpp
 #include "LEDController.h"
+#include "HSVKernel.h"
+#include "FrameCodec.h"
 
-LEDController::LEDController() : brightness(77) // 30% default brightness
+// Fade curves used by the masks - brightness of the LED at 'position' from the bottom of a segment
+
+// Fire effects: cubic fade starting 45% up the strip, top 10% forced black
+static float fireFadeCurve(int position, int ledsPerSegment) {
+    float fadeStartPosition = ledsPerSegment * 0.45f;
+    if (position < fadeStartPosition) {
+        return 1.0f;
+    }
+    if (position >= ledsPerSegment * 0.90f) {
+        return 0.0f;
+    }
+
+    float fadeProgress = (float(position) - fadeStartPosition) / (ledsPerSegment - fadeStartPosition);
+    return 1.0f - fadeProgress * fadeProgress * fadeProgress;
+}
+
+// Gradients: cubic fade starting 45% up the strip down to 10% brightness,
+// with the top 10% dimmed a further 90%
+static float softFadeCurve(int position, int ledsPerSegment) {
+    float fadeStartPosition = ledsPerSegment * 0.45f;
+    if (position < fadeStartPosition) {
+        return 1.0f;
+    }
+
+    float fadeProgress = (float(position) - fadeStartPosition) / (ledsPerSegment - fadeStartPosition);
+    float fadeFactor = 1.0f - fadeProgress * fadeProgress * fadeProgress * 0.9f;
+
+    if (position >= ledsPerSegment * 0.90f) {
+        fadeFactor *= 26.0f / 255.0f;
+    }
+    return fadeFactor;
+}
+
+// Ambient white: straight line from full brightness at the bottom to black at the top
+static float linearFadeCurve(int position, int ledsPerSegment) {
+    return 1.0f - (float)position / (ledsPerSegment - 1);
+}
+
+// Code Red trails: full brightness up to 30% of the strip, then a squared fade to black at the top
+static float trailFadeCurve(int position, int ledsPerSegment) {
+    float positionRatio = (float)position / (ledsPerSegment - 1);
+    if (positionRatio <= 0.3f) {
+        return 1.0f;
+    }
+
+    float fadeProgress = (positionRatio - 0.3f) / 0.7f;
+    return 1.0f - fadeProgress * fadeProgress;
+}
+
+LEDController::LEDController() :
+    screen(ledsCore, ledsInner, ledsOuter, ledsRing),
+    brightness(77), // 30% default brightness
+    showTimeMicros(0)
 {
+    buildFadeMasks();
+    screen.armGuards();
 }
 
 void LEDController::begin() {
@@ -30,8 +86,92 @@ void LEDController::clearAll() {
 }
 
 void LEDController::showAll() {
+    unsigned long start = micros();
+
     // FastLED optimization: update all strips in one call
     FastLED.show();
+
+    // Track output time separately so frame profiling can report pure render cost
+    showTimeMicros += micros() - start;
+
+#if CAPTURE_SHOW_FRAMES
+    captureFrame();
+#endif
+}
+
+void LEDController::captureFrame() {
+    // Frames are coded against the one before (FrameCodec), which keeps
+    // the Serial link from limiting the frame rate while recording
+    static const int STRIP_LENGTHS[] = {
+        LED_STRIP_CORE_COUNT, LED_STRIP_INNER_COUNT, LED_STRIP_OUTER_COUNT, LED_STRIP_RING_COUNT
+    };
+    static const int FRAME_BYTES = (LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT +
+                                    LED_STRIP_OUTER_COUNT + LED_STRIP_RING_COUNT) * 3;
+    static FrameCodec::Encoder encoder(STRIP_LENGTHS, 4);
+    static std::vector<uint8_t> record;
+    static uint8_t frame[FRAME_BYTES];
+    static uint16_t sequence = 0;
+
+    uint8_t* p = frame;
+    memcpy(p, ledsCore, LED_STRIP_CORE_COUNT * sizeof(CRGB));
+    p += LED_STRIP_CORE_COUNT * sizeof(CRGB);
+    memcpy(p, ledsInner, LED_STRIP_INNER_COUNT * sizeof(CRGB));
+    p += LED_STRIP_INNER_COUNT * sizeof(CRGB);
+    memcpy(p, ledsOuter, LED_STRIP_OUTER_COUNT * sizeof(CRGB));
+    p += LED_STRIP_OUTER_COUNT * sizeof(CRGB);
+    memcpy(p, ledsRing, LED_STRIP_RING_COUNT * sizeof(CRGB));
+
+    // One record per shown frame: "LFRZ", the time in ms, a sequence number
+    // and the coded size (little-endian), then the coded frame. Log lines
+    // can sit between records - the encoder looks for the marker, and uses
+    // the sequence number to notice records that got lost.
+    record.assign(12, 0);
+    size_t size = encoder.encode(frame, record);
+
+#if CAPTURE_VERIFY_FRAMES
+    // Debug: decode the record the way anim_tool will, so a coding bug shows
+    // up here instead of as a broken animation. A record that does not give
+    // back the shown frame is coded again with every strip keyed - and if
+    // that one is wrong too, the frame is dropped and the next one keyed.
+    static uint8_t received[FRAME_BYTES];  // What anim_tool has after decoding every record so far
+    static uint8_t previous[FRAME_BYTES];  // received before this record, to decode the keyed one against
+    const AnimationCodec::Span spans[] = {
+        {received, LED_STRIP_CORE_COUNT},
+        {received + LED_STRIP_CORE_COUNT * 3, LED_STRIP_INNER_COUNT},
+        {received + (LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT) * 3, LED_STRIP_OUTER_COUNT},
+        {received + (LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT + LED_STRIP_OUTER_COUNT) * 3, LED_STRIP_RING_COUNT}
+    };
+    memcpy(previous, received, FRAME_BYTES);
+    if (!FrameCodec::decode(record.data() + 12, size, spans, 4) || memcmp(received, frame, FRAME_BYTES) != 0) {
+        Serial.println("Captured frame did not decode - keying every strip");
+        encoder.restart();
+        record.assign(12, 0);
+        size = encoder.encode(frame, record);
+
+        memcpy(received, previous, FRAME_BYTES);
+        if (!FrameCodec::decode(record.data() + 12, size, spans, 4) || memcmp(received, frame, FRAME_BYTES) != 0) {
+            Serial.println("Keyed frame did not decode either - dropping it");
+            encoder.restart();
+            memcpy(received, previous, FRAME_BYTES);
+            return;
+        }
+    }
+#endif
+
+    uint32_t time = millis();
+    const uint8_t head[12] = {'L', 'F', 'R', 'Z',
+                              (uint8_t)time, (uint8_t)(time >> 8), (uint8_t)(time >> 16), (uint8_t)(time >> 24),
+                              (uint8_t)sequence, (uint8_t)(sequence >> 8),
+                              (uint8_t)size, (uint8_t)(size >> 8)};
+    memcpy(record.data(), head, sizeof(head));
+    Serial.write(record.data(), record.size());
+    sequence++;
+}
+
+unsigned long LEDController::takeShowTime() {
+    unsigned long result = showTimeMicros;
+    showTimeMicros = 0;
+    return result;
 }
 
 void LEDController::setBrightness(uint8_t newBrightness) {
@@ -39,29 +179,66 @@ void LEDController::setBrightness(uint8_t newBrightness) {
     FastLED.setBrightness(brightness);
 }
 
-uint32_t LEDController::colorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
-    // Use FastLED's HSV to RGB conversion
-    CHSV hsv(hue >> 8, sat, val); // FastLED uses 0-255 for hue
-    CRGB rgb;
-    hsv2rgb_rainbow(hsv, rgb);
-
-    return CRGBToNeoColor(rgb);
+CRGB LEDController::colorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
+    // FastLED uses 0-255 for hue
+    return HSVKernel::hsv(hue >> 8, sat, val);
 }
 
-uint32_t LEDController::color(uint8_t r, uint8_t g, uint8_t b) {
-    return ((uint32_t) r << 16) | ((uint32_t) g << 8) | b;
+void LEDController::buildFadeMasks() {
+    buildSegmentMask(innerFireFade, 1, NUM_INNER_STRIPS, INNER_LEDS_PER_STRIP, fireFadeCurve);
+    buildSegmentMask(outerFireFade, 2, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, fireFadeCurve);
+    buildSegmentMask(outerSoftFade, 2, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, softFadeCurve);
+    buildSegmentMask(outerLinearFade, 2, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, linearFadeCurve);
+    buildSegmentMask(outerTrailFade, 2, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, trailFadeCurve);
+
+    fadeMasks[MASK_INNER_FIRE_FADE] = innerFireFade;
+    fadeMasks[MASK_OUTER_FIRE_FADE] = outerFireFade;
+    fadeMasks[MASK_OUTER_SOFT_FADE] = outerSoftFade;
+    fadeMasks[MASK_OUTER_LINEAR_FADE] = outerLinearFade;
+    fadeMasks[MASK_OUTER_TRAIL_FADE] = outerTrailFade;
+
+    fadeMaskLengths[MASK_INNER_FIRE_FADE] = LED_STRIP_INNER_COUNT;
+    fadeMaskLengths[MASK_OUTER_FIRE_FADE] = LED_STRIP_OUTER_COUNT;
+    fadeMaskLengths[MASK_OUTER_SOFT_FADE] = LED_STRIP_OUTER_COUNT;
+    fadeMaskLengths[MASK_OUTER_LINEAR_FADE] = LED_STRIP_OUTER_COUNT;
+    fadeMaskLengths[MASK_OUTER_TRAIL_FADE] = LED_STRIP_OUTER_COUNT;
+
+    // The gradients always faded with nscale8_video; the fire, trail and
+    // temperature fades multiplied and truncated, which lets the dim top of a
+    // flame go black - keep each look as it was
+    fadeMaskVideo[MASK_INNER_FIRE_FADE] = false;
+    fadeMaskVideo[MASK_OUTER_FIRE_FADE] = false;
+    fadeMaskVideo[MASK_OUTER_SOFT_FADE] = true;
+    fadeMaskVideo[MASK_OUTER_LINEAR_FADE] = false;
+    fadeMaskVideo[MASK_OUTER_TRAIL_FADE] = false;
 }
 
-CRGB LEDController::neoColorToCRGB(uint32_t color) {
-    return CRGB(
-        (color >> 16) & 0xFF,
-        (color >> 8) & 0xFF,
-        color & 0xFF
-    );
+void LEDController::buildSegmentMask(uint8_t* mask, int stripId, int numSegments, int ledsPerSegment,
+                                     float (*curve)(int position, int ledsPerSegment)) {
+    for (int segment = 0; segment < numSegments; segment++) {
+        for (int i = 0; i < ledsPerSegment; i++) {
+            // Store in physical order so the mask lines up with the LED array
+            int physicalPos = segment * ledsPerSegment + mapPositionToPhysical(stripId, i, segment);
+            mask[physicalPos] = Colors::toScale(curve(i, ledsPerSegment));
+        }
+    }
 }
 
-uint32_t LEDController::CRGBToNeoColor(CRGB color) {
-    return ((uint32_t) color.r << 16) | ((uint32_t) color.g << 8) | color.b;
+void LEDController::applyMask(CRGB* strip, FadeMask mask) const {
+    const uint8_t* scales = fadeMasks[mask];
+    int count = fadeMaskLengths[mask];
+
+    // One straight pass with no branches inside, so the compiler can keep it tight.
+    // A scale of 0 gives black either way.
+    if (fadeMaskVideo[mask]) {
+        for (int i = 0; i < count; i++) {
+            strip[i].nscale8_video(scales[i]);
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            strip[i].nscale8(scales[i]);
+        }
+    }
 }
 
 int LEDController::mapPositionToPhysical(int stripId, int logicalPos, int subStrip) {
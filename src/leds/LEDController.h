@@ -5,15 +5,28 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include "Config.h"
+#include "Colors.h"
+#include "RenderTarget.h"
 
 class LEDController {
 public:
+    // Precomputed brightness masks: one scale (0-255) per LED of a strip, in physical order
+    enum FadeMask {
+        MASK_INNER_FIRE_FADE,    // Inner strips: cubic fade from 45% height, top 10% black (fire effects)
+        MASK_OUTER_FIRE_FADE,    // Outer strips: same curve as the inner fire fade
+        MASK_OUTER_SOFT_FADE,    // Outer strips: cubic fade from 45% height down to 10% brightness (gradients)
+        MASK_OUTER_LINEAR_FADE,  // Outer strips: full brightness at the bottom to black at the top
+        MASK_OUTER_TRAIL_FADE,   // Outer strips: squared fade from 30% height to black at the top (Code Red trails)
+        NUM_FADE_MASKS
+    };
+
     LEDController();
 
     void begin();
     void clearAll();
     void setBrightness(uint8_t brightness);
-    uint32_t colorHSV(uint16_t hue, uint8_t sat, uint8_t val);
+    uint8_t getBrightness() const { return brightness; }
+    CRGB colorHSV(uint16_t hue, uint8_t sat, uint8_t val);
     int mapPositionToPhysical(int stripId, int logicalPos, int subStrip);
 
     // Methods to access LED arrays
@@ -22,22 +35,66 @@ public:
     CRGB* getOuter() { return ledsOuter; }
     CRGB* getRing() { return ledsRing; }
 
+    // Render target backed by the strips - effects draw the visible frame into this
+    RenderTarget& getScreen() { return screen; }
+
     // Update to display changes on all strips
     void showAll();
 
-    // Helper methods for color conversion between systems
-    uint32_t color(uint8_t r, uint8_t g, uint8_t b);
-    CRGB neoColorToCRGB(uint32_t color);
-    uint32_t CRGBToNeoColor(CRGB color);
+    // Time spent inside showAll() since the last call, in microseconds (resets the counter)
+    unsigned long takeShowTime();
+
+    // Scale every LED of a strip by a fade mask (the strip must be the one the mask was built for).
+    // Each mask scales the way the effect fades it replaced did (see fadeMaskVideo)
+    void applyMask(CRGB* strip, FadeMask mask) const;
+
+    // Raw mask scales, for effects that bake a fade into their own tables
+    const uint8_t* getFadeMask(FadeMask mask) const { return fadeMasks[mask]; }
+    int getFadeMaskLength(FadeMask mask) const { return fadeMaskLengths[mask]; }
 
 private:
-    // LED arrays for each strip
-    CRGB ledsCore[LED_STRIP_CORE_COUNT];
-    CRGB ledsInner[LED_STRIP_INNER_COUNT];
-    CRGB ledsOuter[LED_STRIP_OUTER_COUNT];
-    CRGB ledsRing[LED_STRIP_RING_COUNT];
+    // LED arrays for each strip (plus the debug canary LEDs, see STRIP_GUARD_LEDS)
+    CRGB ledsCore[LED_STRIP_CORE_COUNT + STRIP_GUARD_LEDS];
+    CRGB ledsInner[LED_STRIP_INNER_COUNT + STRIP_GUARD_LEDS];
+    CRGB ledsOuter[LED_STRIP_OUTER_COUNT + STRIP_GUARD_LEDS];
+    CRGB ledsRing[LED_STRIP_RING_COUNT + STRIP_GUARD_LEDS];
+    RenderTarget screen;  // The four arrays above, as a render target
 
     uint8_t brightness;
+    unsigned long showTimeMicros;  // Accumulated time spent pushing data to the strips
+
+    // Fade mask storage, built once from the strip geometry in Config.h
+    uint8_t innerFireFade[LED_STRIP_INNER_COUNT];
+    uint8_t outerFireFade[LED_STRIP_OUTER_COUNT];
+    uint8_t outerSoftFade[LED_STRIP_OUTER_COUNT];
+    uint8_t outerLinearFade[LED_STRIP_OUTER_COUNT];
+    uint8_t outerTrailFade[LED_STRIP_OUTER_COUNT];
+    const uint8_t* fadeMasks[NUM_FADE_MASKS];
+    int fadeMaskLengths[NUM_FADE_MASKS];
+    bool fadeMaskVideo[NUM_FADE_MASKS];  // Video scaling (dim LEDs stay faintly lit) instead of truncating to black
+
+    /**
+     * Send the frame just shown over Serial for tools/animation (CAPTURE_SHOW_FRAMES)
+     * The strips hold the colors before brightness, so the recording does not
+     * depend on the brightness it was made at
+     */
+    void captureFrame();
+
+    /**
+     * Fill all fade masks (runs once from the constructor)
+     */
+    void buildFadeMasks();
+
+    /**
+     * Fill one mask by repeating a fade curve over every segment of a strip
+     * @param mask Mask to fill (numSegments * ledsPerSegment entries)
+     * @param stripId Strip type for mapPositionToPhysical (1 = inner, 2 = outer)
+     * @param numSegments Number of segments in the strip
+     * @param ledsPerSegment LEDs in each segment
+     * @param curve Brightness (0.0-1.0) of the LED at a position from the bottom of a segment
+     */
+    void buildSegmentMask(uint8_t* mask, int stripId, int numSegments, int ledsPerSegment,
+                          float (*curve)(int position, int ledsPerSegment));
 };
 
 #endif // LED_CONTROLLER_H
\ No newline at end of file
@@ -1,6 +1,7 @@
 // src/leds/MPR121LEDHandler.cpp
 
 #include "MPR121LEDHandler.h"
+#include "effects/EffectCatalog.h"
 #include <math.h>
 
 MPR121LEDHandler::MPR121LEDHandler(LEDController& ledController) :
@@ -14,7 +15,7 @@ MPR121LEDHandler::MPR121LEDHandler(LEDController& ledController) :
 
 void MPR121LEDHandler::showTemperatureState(int state, unsigned long showTime) {
     // Get the color for this temperature state
-    uint32_t color = getStateColor(state);
+    CRGB color = getStateColor(state);
 
     // Set up feedback timing
     feedbackStartTime = millis();
@@ -35,7 +36,7 @@ void MPR121LEDHandler::showTemperatureState(int state, unsigned long showTime) {
 
 void MPR121LEDHandler::showLightState(int state, unsigned long showTime) {
     // Get the color for this light sensor state
-    uint32_t color = getStateColor(state);
+    CRGB color = getStateColor(state);
 
     // Set up feedback timing
     feedbackStartTime = millis();
@@ -92,14 +93,14 @@ void MPR121LEDHandler::showEffectSelection(int currentEffect, int totalEffects,
     Serial.println(totalEffects);
 }
 
-void MPR121LEDHandler::showEffectSelectionSmart(int currentEffect, int totalEffects, bool isPartyMode, unsigned long showTime) {
+void MPR121LEDHandler::showEffectSelectionSmart(int currentEffect, int totalEffects, bool isPartyCycle, unsigned long showTime) {
     // Set up feedback timing
     feedbackStartTime = millis();
     feedbackDuration = showTime;
     feedbackActive = true;
 
-    // Check if this is the party cycle effect (index 0 in party mode)
-    if (isPartyMode && currentEffect == 0) {
+    // Check if this is the party cycle effect
+    if (isPartyCycle) {
         // Use special party cycle display
         applyPartyCycleDisplay();
         Serial.println("Effect selection feedback: Party Cycle (All Effects)");
@@ -149,14 +150,14 @@ bool MPR121LEDHandler::isFeedbackActive() const {
     return feedbackActive;
 }
 
-uint32_t MPR121LEDHandler::getStateColor(int state) {
+CRGB MPR121LEDHandler::getStateColor(int state) {
     // Return appropriate color based on state
     switch (constrain(state, 0, 3)) {
-        case 0:  return STATE_OFF_COLOR;    // Red
-        case 1:  return STATE_LOW_COLOR;    // Blue
-        case 2:  return STATE_MED_COLOR;    // Yellow
-        case 3:  return STATE_HIGH_COLOR;   // Orange
-        default: return STATE_OFF_COLOR;    // Fallback to red
+        case 0:  return Colors::fromHex(STATE_OFF_COLOR);    // Red
+        case 1:  return Colors::fromHex(STATE_LOW_COLOR);    // Blue
+        case 2:  return Colors::fromHex(STATE_MED_COLOR);    // Yellow
+        case 3:  return Colors::fromHex(STATE_HIGH_COLOR);   // Orange
+        default: return Colors::fromHex(STATE_OFF_COLOR);    // Fallback to red
     }
 }
 
@@ -180,14 +181,7 @@ uint8_t MPR121LEDHandler::calculateBellCurveBrightness(int position) {
     return (uint8_t)(30 + brightness * 225);
 }
 
-void MPR121LEDHandler::applyFeedbackToRing(uint32_t color) {
-    // Convert 32-bit color to CRGB
-    CRGB baseColor = CRGB(
-        (color >> 16) & 0xFF,  // Red
-        (color >> 8) & 0xFF,   // Green
-        color & 0xFF           // Blue
-    );
-
+void MPR121LEDHandler::applyFeedbackToRing(const CRGB& baseColor) {
     // Clear the entire ring first
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
         leds.getRing()[i] = CRGB::Black;
@@ -263,25 +257,11 @@ void MPR121LEDHandler::applyPartyCycleDisplay() {
         leds.getRing()[i] = CRGB::Black;
     }
 
-    // Representative colors for each party effect (same as PartyCycleEffect)
-    // Order: lust, emerald, suspendedPartyFire, codeRed, matrix,
-    // technoOrange, rainbowTrance, partyFire, rainbow, future, futureRainbow, rgbPattern
-    CRGB effectColors[] = {
-        CRGB(255, 20, 147),    // Lust Effect - Deep pink/magenta
-        CRGB(0, 255, 127),     // Emerald City - Emerald green
-        CRGB(255, 69, 0),      // Suspended Party Fire - Orange red
-        CRGB(220, 20, 60),     // Code Red - Crimson red
-        CRGB(0, 255, 0),       // Matrix - Bright green
-        CRGB(255, 140, 0),     // Techno Orange (Regal) - Dark orange
-        CRGB(138, 43, 226),    // Rainbow Trance - Blue violet
-        CRGB(255, 0, 0),       // Party Fire - Red
-        CRGB(255, 255, 0),     // Rainbow - Yellow (center of rainbow)
-        CRGB(0, 191, 255),     // Future - Deep sky blue
-        CRGB(255, 0, 255),     // Future Rainbow - Magenta
-        CRGB(128, 0, 128)      // RGB Pattern - Purple
-    };
-
-    int numEffects = sizeof(effectColors) / sizeof(effectColors[0]);
+    // Representative colors of the party effects, in cycle order (same as PartyCycleEffect)
+    int numEffects = EffectCatalog::countWith(EFFECT_IN_PARTY_CYCLE);
+    if (numEffects == 0) {
+        return;
+    }
 
     // Static brightness for button feedback (no breathing during feedback)
     uint8_t brightness = 180; // Bright enough to be clearly visible
@@ -296,7 +276,7 @@ void MPR121LEDHandler::applyPartyCycleDisplay() {
         if (effectIndex >= numEffects) effectIndex = numEffects - 1;
 
         // Get the base color for this effect
-        CRGB baseColor = effectColors[effectIndex];
+        CRGB baseColor = CRGB(EffectCatalog::get(EffectCatalog::findWith(EFFECT_IN_PARTY_CYCLE, effectIndex)).color);
 
         // Apply consistent brightness
         baseColor.nscale8_video(brightness);
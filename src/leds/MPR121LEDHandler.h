@@ -64,10 +64,10 @@ public:
      * Show effect selection feedback with special handling for party cycle
      * @param currentEffect Current effect index (0-based)
      * @param totalEffects Total number of available effects for current mode
-     * @param isPartyMode True if we're in party mode
+     * @param isPartyCycle True if the selected effect is the party cycle (EFFECT_PARTY_CYCLE in the catalog)
      * @param showTime How long to show the feedback in milliseconds (default 2000ms)
      */
-    void showEffectSelectionSmart(int currentEffect, int totalEffects, bool isPartyMode, unsigned long showTime = 2000);
+    void showEffectSelectionSmart(int currentEffect, int totalEffects, bool isPartyCycle, unsigned long showTime = 2000);
 
     /**
      * Update the LED handler - call this every frame
@@ -100,17 +100,17 @@ private:
     bool feedbackActive;                // Is feedback currently active
 
     // State colors for different button states
-    static const uint32_t STATE_OFF_COLOR = 0xFF0000;      // Red
-    static const uint32_t STATE_LOW_COLOR = 0x0000FF;      // Blue
-    static const uint32_t STATE_MED_COLOR = 0xFFFF00;      // Yellow
-    static const uint32_t STATE_HIGH_COLOR = 0xFF8000;     // Orange
+    static constexpr uint32_t STATE_OFF_COLOR = 0xFF0000;      // Red
+    static constexpr uint32_t STATE_LOW_COLOR = 0x0000FF;      // Blue
+    static constexpr uint32_t STATE_MED_COLOR = 0xFFFF00;      // Yellow
+    static constexpr uint32_t STATE_HIGH_COLOR = 0xFF8000;     // Orange
 
     /**
      * Get color for a given state
      * @param state The button state (0-3)
-     * @return Color as 32-bit RGB value
+     * @return Color for that state
      */
-    uint32_t getStateColor(int state);
+    CRGB getStateColor(int state);
 
     /**
      * Calculate bell curve brightness for position within button face
@@ -121,9 +121,9 @@ private:
 
     /**
      * Apply feedback display to ring LEDs using solid color
-     * @param color Base color for the feedback
+     * @param baseColor Base color for the feedback
      */
-    void applyFeedbackToRing(uint32_t color);
+    void applyFeedbackToRing(const CRGB& baseColor);
 
     /**
      * Apply selection display to ring LEDs using dynamic layout
@@ -134,7 +134,8 @@ private:
 
     /**
      * Apply special party cycle display showing all effect colors
-     * Used when the party cycle effect (index 0 in party mode) is selected
+     * Used when the party cycle effect is selected - the colors come from
+     * the effect catalog, so they always match the effects in the cycle
      */
     void applyPartyCycleDisplay();
 
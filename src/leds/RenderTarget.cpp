@@ -0,0 +1,70 @@
+// src/leds/RenderTarget.cpp
+#include "RenderTarget.h"
+#include "Colors.h"
+
+void RenderTarget::clearAll() {
+    fill_solid(core, LED_STRIP_CORE_COUNT, CRGB::Black);
+    fill_solid(inner, LED_STRIP_INNER_COUNT, CRGB::Black);
+    fill_solid(outer, LED_STRIP_OUTER_COUNT, CRGB::Black);
+    fill_solid(ring, LED_STRIP_RING_COUNT, CRGB::Black);
+}
+
+void RenderTarget::copyFrom(RenderTarget& source, bool drawRing) {
+    memcpy(core, source.getCore(), LED_STRIP_CORE_COUNT * sizeof(CRGB));
+    memcpy(inner, source.getInner(), LED_STRIP_INNER_COUNT * sizeof(CRGB));
+    memcpy(outer, source.getOuter(), LED_STRIP_OUTER_COUNT * sizeof(CRGB));
+    if (drawRing) {
+        memcpy(ring, source.getRing(), LED_STRIP_RING_COUNT * sizeof(CRGB));
+    }
+}
+
+void RenderTarget::mixFrom(RenderTarget& from, RenderTarget& to, uint8_t amount, bool drawRing) {
+    Colors::mixSpan(from.getCore(), to.getCore(), core, LED_STRIP_CORE_COUNT, amount);
+    Colors::mixSpan(from.getInner(), to.getInner(), inner, LED_STRIP_INNER_COUNT, amount);
+    Colors::mixSpan(from.getOuter(), to.getOuter(), outer, LED_STRIP_OUTER_COUNT, amount);
+    if (drawRing) {
+        Colors::mixSpan(from.getRing(), to.getRing(), ring, LED_STRIP_RING_COUNT, amount);
+    }
+}
+
+void RenderTarget::armGuards() {
+    fill_solid(core + LED_STRIP_CORE_COUNT, STRIP_GUARD_LEDS, CRGB(GUARD_COLOR));
+    fill_solid(inner + LED_STRIP_INNER_COUNT, STRIP_GUARD_LEDS, CRGB(GUARD_COLOR));
+    fill_solid(outer + LED_STRIP_OUTER_COUNT, STRIP_GUARD_LEDS, CRGB(GUARD_COLOR));
+    fill_solid(ring + LED_STRIP_RING_COUNT, STRIP_GUARD_LEDS, CRGB(GUARD_COLOR));
+}
+
+/**
+ * Check the canary LEDs after one buffer
+ */
+static bool guardIntact(const CRGB* guard, const CRGB& canary) {
+    for (int i = 0; i < STRIP_GUARD_LEDS; i++) {
+        if (guard[i] != canary) return false;
+    }
+    return true;
+}
+
+bool RenderTarget::guardsIntact() const {
+    CRGB canary(GUARD_COLOR);
+    return guardIntact(core + LED_STRIP_CORE_COUNT, canary) &&
+           guardIntact(inner + LED_STRIP_INNER_COUNT, canary) &&
+           guardIntact(outer + LED_STRIP_OUTER_COUNT, canary) &&
+           guardIntact(ring + LED_STRIP_RING_COUNT, canary);
+}
+
+OffscreenTarget::OffscreenTarget() :
+    RenderTarget(new CRGB[LED_STRIP_CORE_COUNT + STRIP_GUARD_LEDS],
+                 new CRGB[LED_STRIP_INNER_COUNT + STRIP_GUARD_LEDS],
+                 new CRGB[LED_STRIP_OUTER_COUNT + STRIP_GUARD_LEDS],
+                 new CRGB[LED_STRIP_RING_COUNT + STRIP_GUARD_LEDS])
+{
+    clearAll();
+    armGuards();
+}
+
+OffscreenTarget::~OffscreenTarget() {
+    delete[] core;
+    delete[] inner;
+    delete[] outer;
+    delete[] ring;
+}
@@ -0,0 +1,107 @@
+// src/leds/RenderTarget.h
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+
+/**
+ * RenderTarget - One set of core, inner, outer and ring buffers for effects to draw into
+ *
+ * Effects never draw straight into the LED strips. They get a RenderTarget
+ * from whoever runs them and only write into its four buffers:
+ * - LEDController::getScreen() is the target backed by the real strips
+ * - OffscreenTarget has buffers of its own, so an effect can be drawn
+ *   somewhere else (transitions, previews, layering, benchmarks) without
+ *   copying the strips around
+ *
+ * Every target has the same strip lengths as Config.h, so an effect does
+ * not need to know which kind it is drawing into.
+ */
+class RenderTarget {
+public:
+    /**
+     * Constructor - wrap existing buffers (they must outlive the target)
+     * @param core Core buffer (LED_STRIP_CORE_COUNT LEDs)
+     * @param inner Inner buffer (LED_STRIP_INNER_COUNT LEDs)
+     * @param outer Outer buffer (LED_STRIP_OUTER_COUNT LEDs)
+     * @param ring Ring buffer (LED_STRIP_RING_COUNT LEDs)
+     */
+    RenderTarget(CRGB* core, CRGB* inner, CRGB* outer, CRGB* ring) :
+        core(core), inner(inner), outer(outer), ring(ring) {}
+
+    virtual ~RenderTarget() {}
+
+    // Buffers to draw into
+    CRGB* getCore() { return core; }
+    CRGB* getInner() { return inner; }
+    CRGB* getOuter() { return outer; }
+    CRGB* getRing() { return ring; }
+
+    /**
+     * Set every LED of every strip to black
+     */
+    void clearAll();
+
+    /**
+     * Copy the whole frame from another target
+     * @param source Target to copy from
+     * @param drawRing False to leave the ring alone (button feedback is showing on it)
+     */
+    void copyFrom(RenderTarget& source, bool drawRing = true);
+
+    /**
+     * Crossfade two whole frames into this target (see Colors::mixSpan)
+     * This target may be one of the two sources
+     * @param from Frame at amount 0
+     * @param to Frame at amount 255
+     * @param amount How far to move from 'from' towards 'to' (0-255)
+     * @param drawRing False to leave the ring alone (button feedback is showing on it)
+     */
+    void mixFrom(RenderTarget& from, RenderTarget& to, uint8_t amount, bool drawRing = true);
+
+    /**
+     * Debug: fill the STRIP_GUARD_LEDS canary LEDs after every buffer
+     * Every buffer must have that many spare LEDs after its strip
+     */
+    void armGuards();
+
+    /**
+     * Debug: check that nothing was drawn past the end of a strip
+     * @return False if a canary LED was overwritten (always true when STRIP_GUARD_LEDS is 0)
+     */
+    bool guardsIntact() const;
+
+protected:
+    CRGB* core;
+    CRGB* inner;
+    CRGB* outer;
+    CRGB* ring;
+
+    // Canary color for the guard LEDs - unlikely to be drawn by accident
+    static const uint32_t GUARD_COLOR = 0x5AA55A;
+
+private:
+    // A target only points at buffers - copying it would not copy the frame
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+};
+
+/**
+ * OffscreenTarget - A RenderTarget with its own buffers (about 1KB), not connected to the strips
+ */
+class OffscreenTarget : public RenderTarget {
+public:
+    /**
+     * Constructor - allocate the buffers and clear them to black
+     */
+    OffscreenTarget();
+
+    /**
+     * Destructor - free the buffers
+     */
+    ~OffscreenTarget();
+};
+
+#endif // RENDER_TARGET_H
@@ -0,0 +1,115 @@
+// src/leds/RenderWorker.cpp
+#include "RenderWorker.h"
+#include "HSVKernel.h"
+
+RenderWorker::RenderWorker() :
+    taskHandle(nullptr),
+    state(JOB_IDLE),
+    job(nullptr),
+    jobArgument(nullptr),
+    jobEffect(nullptr),
+    jobTarget(nullptr),
+    jobResult(false)
+{
+}
+
+bool RenderWorker::begin() {
+    // Shared lookup tables are built on first use - build them now, before two
+    // cores can ask for them at the same time
+    HSVKernel::rainbowPalette();
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        taskWrapper,            // Function to run
+        "RenderWorker",         // Task name
+        8192,                   // Stack size (bytes) - effects keep some scratch arrays on the stack
+        this,                   // Parameter to pass to function
+        2,                      // Above the sensor task, so a job starts right away
+        &taskHandle,            // Task handle
+        0                       // Core 0 (core 1 runs main loop)
+    );
+
+    if (result != pdPASS) {
+        Serial.println("ERROR: Failed to create render worker - effects will be drawn on one core");
+        taskHandle = nullptr;
+        return false;
+    }
+
+    Serial.println("Render worker started on core 0");
+    return true;
+}
+
+bool RenderWorker::start(Effect* effect, RenderTarget& target) {
+    if (taskHandle == nullptr || state.load(std::memory_order_acquire) != JOB_IDLE) {
+        return false;
+    }
+
+    jobEffect = effect;
+    jobTarget = &target;
+    return startJob(drawEffectJob, this);
+}
+
+bool RenderWorker::drawEffectJob(void* worker) {
+    RenderWorker* self = static_cast<RenderWorker*>(worker);
+    return self->jobEffect->update(*self->jobTarget);
+}
+
+bool RenderWorker::startJob(Job job, void* argument) {
+    if (taskHandle == nullptr || state.load(std::memory_order_acquire) != JOB_IDLE) {
+        return false;
+    }
+
+    this->job = job;
+    jobArgument = argument;
+
+    // Publish the job, then wake the worker
+    state.store(JOB_QUEUED, std::memory_order_release);
+    xTaskNotifyGive(taskHandle);
+    return true;
+}
+
+bool RenderWorker::finish() {
+    // The main loop has just drawn its own effect, so the worker is usually
+    // done or nearly done - spin instead of paying for a task switch
+    unsigned long start = micros();
+    bool warned = false;
+    while (state.load(std::memory_order_acquire) != JOB_DONE) {
+        unsigned long waited = micros() - start;
+        if (waited < WORKER_SPIN_US) {
+            continue;
+        }
+
+        // Taking long - the job still owns its target, so keep waiting, but
+        // give the other tasks on this core (and its watchdog) a turn
+        if (waited >= WORKER_LATE_US && !warned) {
+            Serial.print("WARNING: render worker job is taking over ");
+            Serial.print(WORKER_LATE_US / 1000);
+            Serial.println("ms");
+            warned = true;
+        }
+        vTaskDelay(warned ? 1 : 0);
+    }
+
+    bool result = jobResult;
+    state.store(JOB_IDLE, std::memory_order_release);
+    return result;
+}
+
+void RenderWorker::taskWrapper(void* parameter) {
+    static_cast<RenderWorker*>(parameter)->taskFunction();
+}
+
+void RenderWorker::taskFunction() {
+    while (true) {
+        // Sleep until start() hands over a job
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if (state.load(std::memory_order_acquire) != JOB_QUEUED) {
+            continue;
+        }
+
+        jobResult = job(jobArgument);
+
+        // Publish the result
+        state.store(JOB_DONE, std::memory_order_release);
+    }
+}
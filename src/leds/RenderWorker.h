@@ -0,0 +1,116 @@
+// src/leds/RenderWorker.h
+#ifndef RENDER_WORKER_H
+#define RENDER_WORKER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "RenderTarget.h"
+#include "effects/Effect.h"
+
+/**
+ * RenderWorker - Runs drawing jobs on core 0 while the main loop keeps drawing on core 1
+ *
+ * The main loop runs on core 1 and core 0 mostly waits for the sensor task.
+ * Together they make a two-worker job system, one worker per core:
+ * - During a crossfade one of the two effects is handed to this worker
+ *   and both are drawn at the same time:
+ *
+ *     if (worker.start(incoming, incomingFrame)) {   // core 0 starts drawing
+ *         outgoing->update(outgoingFrame);          // core 1 draws meanwhile
+ *         incomingDrawn = worker.finish();          // wait for core 0
+ *     }
+ *
+ * - Effects that draw their strips as separate jobs (Effect::renderStrips)
+ *   hand a job loop to the worker with startJob(), and both cores take
+ *   strips from the same queue until all four are drawn.
+ *
+ * The handoff is lock-free: the job is written first and then published
+ * through an atomic state (IDLE -> QUEUED -> DONE -> IDLE). A task
+ * notification only wakes the worker up. Jobs are handed out by the main
+ * loop - code already running on the worker just gets false from start().
+ *
+ * The two effects must not share drawing state - each draws into its own
+ * target and keeps its own random numbers, so the effects in this project
+ * are safe to run side by side.
+ */
+class RenderWorker {
+public:
+    // A job for the worker - returns its result to finish()
+    typedef bool (*Job)(void* argument);
+
+    /**
+     * Constructor - the worker task is started by begin()
+     */
+    RenderWorker();
+
+    /**
+     * Start the worker task on core 0
+     * @return True if the task is running
+     */
+    bool begin();
+
+    /**
+     * Hand an effect to the worker
+     * @param effect Effect to draw
+     * @param target Where to draw it - the caller must not touch it until finish()
+     * @return True if the worker took the job, false if it is busy or not
+     *         running (the caller then draws the effect itself)
+     */
+    bool start(Effect* effect, RenderTarget& target);
+
+    /**
+     * Hand any job to the worker
+     * @param job Function to run on core 0
+     * @param argument Passed to the job
+     * @return True if the worker took the job, false if it is busy or not
+     *         running (the caller then does the work itself)
+     */
+    bool startJob(Job job, void* argument);
+
+    /**
+     * Wait for the job handed over by start() or startJob()
+     * Spins for WORKER_SPIN_US, then yields while waiting, and warns once if
+     * the job runs past WORKER_LATE_US
+     * @return What the effect's update() (or the job) returned
+     */
+    bool finish();
+
+private:
+    enum JobState : uint8_t {
+        JOB_IDLE,    // No job - the main loop may start one
+        JOB_QUEUED,  // Job published, worker is drawing it
+        JOB_DONE     // Worker finished, result is ready
+    };
+
+    TaskHandle_t taskHandle;          // Worker task on core 0
+    std::atomic<uint8_t> state;       // JobState - publishes the job and the result
+
+    // Job - written before state becomes QUEUED, read by the worker after
+    Job job;
+    void* jobArgument;
+    Effect* jobEffect;                // Effect and target for start()
+    RenderTarget* jobTarget;
+    bool jobResult;                   // Result - written before state becomes DONE
+
+    /**
+     * Job used by start() - draws jobEffect into jobTarget
+     * @param worker The RenderWorker
+     * @return What the effect's update() returned
+     */
+    static bool drawEffectJob(void* worker);
+
+    /**
+     * FreeRTOS entry point
+     * @param parameter The RenderWorker
+     */
+    static void taskWrapper(void* parameter);
+
+    /**
+     * Worker loop - sleeps until start() wakes it, then draws the job
+     */
+    void taskFunction();
+};
+
+#endif // RENDER_WORKER_H
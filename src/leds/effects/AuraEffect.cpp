@@ -1,6 +1,10 @@
 // src/leds/effects/AuraEffect.cpp
 
 #include "AuraEffect.h"
+#include "../HSVKernel.h"
+
+uint8_t AuraEffect::falloffTable[256];
+bool AuraEffect::falloffTableReady = false;
 
 AuraEffect::AuraEffect(LEDController& ledController,
                        bool enableCore,
@@ -11,12 +15,27 @@ AuraEffect::AuraEffect(LEDController& ledController,
     coreEnabled(enableCore),
     innerEnabled(enableInner),
     outerEnabled(enableOuter),
-    ringEnabled(enableRing),
-    lastUpdate(0)
+    ringEnabled(enableRing)
 {
     // Reserve space for ripples to avoid memory reallocations
     ripples.reserve(MAX_RIPPLES);
 
+    // Split the accumulation storage into one canvas per strip segment
+    uint16_t* storage = accumulation;
+    for (int i = 0; i < NUM_CANVASES; i++) {
+        RippleCanvas& canvas = canvases[i];
+        canvas.stripType = (i < 9) ? i / 3 : 3;
+        canvas.subStrip = (i < 9) ? i % 3 : 0;
+        canvas.length = getStripLength(canvas.stripType, canvas.subStrip);
+        canvas.channels = storage;
+        canvas.spanStart = 0;
+        canvas.spanEnd = -1;
+        storage += canvas.length * 3;
+    }
+    memset(accumulation, 0, sizeof(accumulation));
+
+    buildFalloffTable();
+
     Serial.println("AuraEffect created - colorful expanding ripples with fade-out");
     Serial.print("Enabled strips - Core: ");
     Serial.print(coreEnabled ? "YES" : "NO");
@@ -35,38 +54,45 @@ AuraEffect::~AuraEffect() {
 void AuraEffect::reset() {
     // Clear all active ripples
     ripples.clear();
-    lastUpdate = millis();
 
     Serial.println("AuraEffect reset - all ripples cleared");
 }
 
-void AuraEffect::update() {
+void AuraEffect::render() {
     // Target 60 FPS for smooth ripple animation
-    if (!shouldUpdate(16)) {  // 16ms = ~60 FPS
+    if (!beginFrame(16, REFERENCE_FRAME_MS)) {  // 16ms = ~60 FPS
         return;
     }
 
-    // Clear all strips first
-    leds.clearAll();
-
     // Randomly create new ripples
-    if (random(100) < RIPPLE_CREATE_CHANCE) {
+    if (frameChance(RIPPLE_CREATE_CHANCE / 100.0f)) {
         createNewRipple();
     }
 
     // Update all existing ripples
     updateRipples();
 
-    // Draw all ripples
-    drawRipples();
+    // Draw all ripples - each strip has its own canvases, so on both cores
+    renderStrips();
+}
+
+void AuraEffect::renderStrip(StripJob strip) {
+    // Clear the strip first - only the touched spans are written below
+    switch (strip) {
+        case STRIP_JOB_CORE:  fill_solid(target->getCore(), LED_STRIP_CORE_COUNT, CRGB::Black); break;
+        case STRIP_JOB_INNER: fill_solid(target->getInner(), LED_STRIP_INNER_COUNT, CRGB::Black); break;
+        case STRIP_JOB_OUTER: fill_solid(target->getOuter(), LED_STRIP_OUTER_COUNT, CRGB::Black); break;
+        case STRIP_JOB_RING:  fill_solid(target->getRing(), LED_STRIP_RING_COUNT, CRGB::Black); break;
+        default: return;
+    }
 
-    // Show the changes
-    leds.showAll();
+    // Strip jobs are numbered like the ripple strip types
+    drawRipples(strip);
 }
 
 void AuraEffect::createNewRipple() {
-    // Don't create more ripples if we're at maximum
-    if (ripples.size() >= MAX_RIPPLES) {
+    // Don't create more ripples if we're at maximum (fewer at reduced quality)
+    if (ripples.size() >= qualityBudget(MAX_RIPPLES)) {
         return;
     }
 
@@ -85,7 +111,7 @@ void AuraEffect::createNewRipple() {
     Ripple newRipple;
 
     // Randomly choose a strip type from enabled strips only
-    int choice = random(enabledCount);
+    int choice = rng.range(enabledCount);
     int currentChoice = 0;
 
     // Map the choice to an enabled strip type
@@ -114,10 +140,10 @@ void AuraEffect::createNewRipple() {
     // For strips with segments, randomly choose which segment
     if (newRipple.stripType == 0) {
         // Core has 3 segments
-        newRipple.subStrip = random(3);
+        newRipple.subStrip = rng.range(3);
     } else if (newRipple.stripType == 1 || newRipple.stripType == 2) {
         // Inner and outer have 3 segments
-        newRipple.subStrip = random(3);
+        newRipple.subStrip = rng.range(3);
     } else {
         // Ring doesn't have segments
         newRipple.subStrip = 0;
@@ -129,7 +155,7 @@ void AuraEffect::createNewRipple() {
     // Allow ripple center to be off the edges of the strip
     // This creates ripples that enter from the sides
     // Range: -MAX_RADIUS to (stripLength + MAX_RADIUS)
-    newRipple.centerPos = random(-MAX_RADIUS, stripLength + MAX_RADIUS);
+    newRipple.centerPos = rng.range(-MAX_RADIUS, stripLength + MAX_RADIUS);
 
     // Start with radius 0 (will expand outward)
     newRipple.radius = 0.0f;
@@ -171,7 +197,7 @@ void AuraEffect::updateRipples() {
         if (!ripple.active) continue;
 
         // Expand the ripple radius
-        ripple.radius += RIPPLE_SPEED;
+        ripple.radius += RIPPLE_SPEED * frameStep;
 
         // Start fading when ripple reaches fade start radius
         if (ripple.radius > FADE_START_RADIUS) {
@@ -210,10 +236,10 @@ void AuraEffect::updateRipples() {
         ripples.end());
 }
 
-void AuraEffect::drawRipples() {
-    // Draw each active ripple
+void AuraEffect::drawRipples(int stripType) {
+    // Add every active ripple on this strip type into its canvas
     for (const auto& ripple : ripples) {
-        if (!ripple.active) continue;
+        if (!ripple.active || ripple.stripType != stripType) continue;
 
         // Skip if this strip type is disabled
         if (ripple.stripType == 0 && !coreEnabled) continue;
@@ -221,130 +247,130 @@ void AuraEffect::drawRipples() {
         if (ripple.stripType == 2 && !outerEnabled) continue;
         if (ripple.stripType == 3 && !ringEnabled) continue;
 
-        // Draw the ripple from center-radius to center+radius
-        int startPos = ripple.centerPos - (int)MAX_RADIUS;
-        int endPos = ripple.centerPos + (int)MAX_RADIUS;
-
-        // Get strip length
-        int stripLength = getStripLength(ripple.stripType, ripple.subStrip);
-
-        // Draw each LED in the potential ripple area
-        for (int pos = startPos; pos <= endPos; pos++) {
-            // Skip if outside strip bounds
-            if (pos < 0 || pos >= stripLength) continue;
-
-            // Calculate distance from ripple center
-            float distance = abs(pos - ripple.centerPos);
-
-            // Calculate brightness based on distance, current radius, and fade-out
-            float brightness = calculateRippleBrightness(distance, ripple.radius, ripple.fadeOut);
-
-            // Skip if this LED is not part of the current ripple
-            if (brightness <= 0.0f) continue;
-
-            // Apply brightness to ripple color
-            CRGB ledColor = CRGB(
-                ripple.color.r * brightness,
-                ripple.color.g * brightness,
-                ripple.color.b * brightness
-            );
-
-            // Get physical LED position
-            int physicalPos = leds.mapPositionToPhysical(ripple.stripType, pos, ripple.subStrip);
-
-            // Adjust for segment offset based on strip type
-            if (ripple.stripType == 0) {
-                // Core strips
-                int segmentLength = LED_STRIP_CORE_COUNT / 3;
-                physicalPos += ripple.subStrip * segmentLength;
-
-                // Add color to existing (allows ripples to blend)
-                if (physicalPos >= 0 && physicalPos < LED_STRIP_CORE_COUNT) {
-                    leds.getCore()[physicalPos] += ledColor;
-                }
-            } else if (ripple.stripType == 1) {
-                // Inner strips
-                physicalPos += ripple.subStrip * INNER_LEDS_PER_STRIP;
-
-                // Add color to existing (allows ripples to blend)
-                if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-                    leds.getInner()[physicalPos] += ledColor;
-                }
-            } else if (ripple.stripType == 2) {
-                // Outer strips
-                physicalPos += ripple.subStrip * OUTER_LEDS_PER_STRIP;
-
-                // Add color to existing (allows ripples to blend)
-                if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-                    leds.getOuter()[physicalPos] += ledColor;
-                }
-            } else if (ripple.stripType == 3) {
-                // Ring strip (no segments)
-                if (physicalPos >= 0 && physicalPos < LED_STRIP_RING_COUNT) {
-                    leds.getRing()[physicalPos] += ledColor;
-                }
-            }
+        rasterizeRipple(ripple);
+    }
+
+    // Write the touched parts of each canvas to the LEDs
+    // Everything outside those spans is still black from the clear in renderStrip()
+    for (int i = 0; i < NUM_CANVASES; i++) {
+        RippleCanvas& canvas = canvases[i];
+        if (canvas.stripType != stripType) continue;
+
+        // Leave the ring alone while button feedback is showing on it
+        if (canvas.stripType == 3 && skipRing) {
+            memset(canvas.channels, 0, canvas.length * 3 * sizeof(uint16_t));
+            canvas.spanStart = 0;
+            canvas.spanEnd = -1;
+            continue;
         }
+
+        resolveCanvas(canvas);
     }
+}
 
-    // Apply brightness limiting to prevent oversaturation when ripples overlap
-    // This ensures overlapping ripples create nice color blends without going pure white
+void AuraEffect::rasterizeRipple(const Ripple& ripple) {
+    RippleCanvas& canvas = getCanvas(ripple.stripType, ripple.subStrip);
 
-    // Limit core strip brightness
-    if (coreEnabled) {
-        for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-            CRGB& pixel = leds.getCore()[i];
-            uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
-            if (maxComponent > 230) {
-                float scale = 230.0f / maxComponent;
-                pixel.r = pixel.r * scale;
-                pixel.g = pixel.g * scale;
-                pixel.b = pixel.b * scale;
-            }
-        }
+    // Maintain ripple shape even as it expands beyond MAX_RADIUS
+    float effectiveRadius = min(ripple.radius, MAX_RADIUS * 1.2f); // Soft cap at 16.8
+    if (effectiveRadius <= 0.0f) return;
+
+    // Only LEDs closer than the radius are lit, and never more than MAX_RADIUS away
+    int reach = min((int)ceilf(effectiveRadius) - 1, (int)MAX_RADIUS);
+    int start = max(ripple.centerPos - reach, 0);
+    int end = min(ripple.centerPos + reach, canvas.length - 1);
+    if (start > end) return;  // Ripple is completely off this strip
+
+    // Grow this canvas's touched span
+    if (canvas.spanEnd < canvas.spanStart) {
+        canvas.spanStart = start;
+        canvas.spanEnd = end;
+    } else {
+        canvas.spanStart = min(canvas.spanStart, start);
+        canvas.spanEnd = max(canvas.spanEnd, end);
     }
 
-    // Limit inner strip brightness
-    if (innerEnabled) {
-        for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-            CRGB& pixel = leds.getInner()[i];
-            uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
-            if (maxComponent > 230) {
-                float scale = 230.0f / maxComponent;
-                pixel.r = pixel.r * scale;
-                pixel.g = pixel.g * scale;
-                pixel.b = pixel.b * scale;
-            }
-        }
+    // distance * step >> 8 is distance / radius as 0-255 (always < 256 inside the radius)
+    uint32_t step = (uint32_t)(65536.0f / effectiveRadius);
+    uint8_t fade = (uint8_t)(ripple.fadeOut * 255.0f);
+
+    for (int pos = start; pos <= end; pos++) {
+        int distance = abs(pos - ripple.centerPos);
+        uint8_t brightness = scale8(falloffTable[(distance * step) >> 8], fade);
+
+        uint16_t* pixel = &canvas.channels[pos * 3];
+        pixel[0] += scale8(ripple.color.r, brightness);
+        pixel[1] += scale8(ripple.color.g, brightness);
+        pixel[2] += scale8(ripple.color.b, brightness);
     }
+}
 
-    // Limit outer strip brightness
-    if (outerEnabled) {
-        for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-            CRGB& pixel = leds.getOuter()[i];
-            uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
-            if (maxComponent > 230) {
-                float scale = 230.0f / maxComponent;
-                pixel.r = pixel.r * scale;
-                pixel.g = pixel.g * scale;
-                pixel.b = pixel.b * scale;
-            }
-        }
+void AuraEffect::resolveCanvas(RippleCanvas& canvas) {
+    if (canvas.spanEnd < canvas.spanStart) return;  // Nothing drawn here this frame
+
+    // Find the LED array and segment offset for this canvas
+    CRGB* strip;
+    int offset;
+    switch (canvas.stripType) {
+        case 0:  strip = target->getCore();  offset = canvas.subStrip * (LED_STRIP_CORE_COUNT / 3); break;
+        case 1:  strip = target->getInner(); offset = canvas.subStrip * INNER_LEDS_PER_STRIP; break;
+        case 2:  strip = target->getOuter(); offset = canvas.subStrip * OUTER_LEDS_PER_STRIP; break;
+        default: strip = target->getRing();  offset = 0; break;
     }
 
-    // Limit ring strip brightness
-    if (ringEnabled && !skipRing) {
-        for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-            CRGB& pixel = leds.getRing()[i];
-            uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
-            if (maxComponent > 230) {
-                float scale = 230.0f / maxComponent;
-                pixel.r = pixel.r * scale;
-                pixel.g = pixel.g * scale;
-                pixel.b = pixel.b * scale;
-            }
+    for (int pos = canvas.spanStart; pos <= canvas.spanEnd; pos++) {
+        uint16_t* pixel = &canvas.channels[pos * 3];
+
+        // Overlapping ripples saturate at full brightness per channel...
+        uint16_t r = min(pixel[0], (uint16_t)255);
+        uint16_t g = min(pixel[1], (uint16_t)255);
+        uint16_t b = min(pixel[2], (uint16_t)255);
+
+        // ...then the whole pixel is scaled down so no channel passes the limit.
+        // This keeps overlaps as color blends instead of washing out to white.
+        uint16_t maxComponent = max(max(r, g), b);
+        if (maxComponent > MAX_PIXEL_BRIGHTNESS) {
+            r = r * MAX_PIXEL_BRIGHTNESS / maxComponent;
+            g = g * MAX_PIXEL_BRIGHTNESS / maxComponent;
+            b = b * MAX_PIXEL_BRIGHTNESS / maxComponent;
         }
+
+        int physicalPos = offset + leds.mapPositionToPhysical(canvas.stripType, pos, canvas.subStrip);
+        strip[physicalPos] = CRGB(r, g, b);
+
+        // Clear as we go, so the canvas is empty for the next frame
+        pixel[0] = pixel[1] = pixel[2] = 0;
+    }
+
+    canvas.spanStart = 0;
+    canvas.spanEnd = -1;
+}
+
+RippleCanvas& AuraEffect::getCanvas(int stripType, int subStrip) {
+    if (stripType == 3) {
+        return canvases[9];
+    }
+    return canvases[stripType * 3 + subStrip];
+}
+
+void AuraEffect::buildFalloffTable() {
+    if (falloffTableReady) return;
+
+    for (int i = 0; i < 256; i++) {
+        // Base brightness falls off linearly with distance from center
+        float brightness = 1.0f - (i / 256.0f);
+
+        // Apply very gentle curve to maintain visibility
+        // Using power of 1.2 instead of 2 for much brighter ripples
+        brightness = pow(brightness, 1.2f);
+
+        // Ensure minimum brightness for visible parts of the ripple
+        brightness = max(brightness, 0.15f); // Minimum 15% brightness
+
+        falloffTable[i] = (uint8_t)(brightness * 255.0f + 0.5f);
     }
+
+    falloffTableReady = true;
 }
 
 CRGB AuraEffect::generateRandomColor() {
@@ -361,48 +387,14 @@ CRGB AuraEffect::generateRandomColor() {
     uint8_t sectionSize = (uint8_t)(255 * 0.6f); // 3/5 of 255 = 153
 
     // Choose a random position within our 3/5 section
-    uint8_t randomOffset = random(sectionSize); // 0 to 152
+    uint8_t randomOffset = rng.range(sectionSize); // 0 to 152
 
     // Calculate final hue by adding the random offset to our section start
     uint8_t finalHue = sectionStartHue + randomOffset;
     // No need to wrap around since we're using uint8_t (automatically wraps at 255)
 
-    // Keep full saturation and brightness for vibrant colors
-    uint8_t saturation = 255;       // Full saturation for bright colors
-    uint8_t value = 255;            // Full brightness
-
-    // Convert HSV to RGB
-    return CHSV(finalHue, saturation, value);
-}
-float AuraEffect::calculateRippleBrightness(float distance, float radius, float fadeOut) {
-    // If this LED is outside the current ripple radius, it's off
-    if (distance > radius) {
-        return 0.0f;
-    }
-
-    // LED is within the ripple - calculate brightness
-    float brightness;
-
-    // Maintain ripple shape even as it expands beyond MAX_RADIUS
-    float effectiveRadius = min(radius, MAX_RADIUS * 1.2f); // Soft cap at 16.8
-
-    // Calculate base brightness with distance from center
-    brightness = 1.0f - (distance / effectiveRadius);
-
-    // Apply very gentle curve to maintain visibility
-    // Using power of 1.2 instead of 2 for much brighter ripples
-    brightness = pow(brightness, 1.2f);
-
-    // Ensure minimum brightness for visible parts of the ripple
-    // This keeps the ripple visible even at edges
-    if (brightness > 0.0f) {
-        brightness = max(brightness, 0.15f); // Minimum 15% brightness
-    }
-
-    // Apply the fade-out multiplier
-    brightness *= fadeOut;
-
-    return brightness;
+    // Full saturation and brightness for vibrant colors, straight from the rainbow palette
+    return HSVKernel::rainbow(finalHue);
 }
 
 int AuraEffect::getStripLength(int stripType, int subStrip) {
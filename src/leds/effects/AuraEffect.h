@@ -20,6 +20,20 @@ struct Ripple {
     float fadeOut;      // Fade-out multiplier (1.0 = full bright, 0.0 = fully faded)
 };
 
+/**
+ * Accumulation buffer for one strip segment
+ * Ripples add into 16-bit channels here, so overlapping ripples never clip
+ * until the final brightness limit is applied
+ */
+struct RippleCanvas {
+    uint16_t* channels;  // 3 channels per LED (logical order), sum of all ripples
+    int length;          // LEDs in this segment
+    int stripType;       // 0 = core, 1 = inner, 2 = outer, 3 = ring
+    int subStrip;        // Segment within the strip type
+    int spanStart;       // First LED touched this frame
+    int spanEnd;         // Last LED touched this frame (spanEnd < spanStart = untouched)
+};
+
 /**
  * AuraEffect - Creates colorful ripples that expand from random positions
  *
@@ -52,11 +66,6 @@ public:
      */
     ~AuraEffect();
 
-    /**
-     * Update the ripple animation
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      */
@@ -65,9 +74,23 @@ public:
     /**
      * Get the name of this effect
      */
-    String getName() const override { return "Aura Effect"; }
+    const char* getName() const override { return "Aura Effect"; }
+
+    // Ripples on one strip never touch another, so each strip is its own job
+    bool hasStripJobs() const override { return true; }
 
 private:
+    /**
+     * Update the ripple animation
+     */
+    void render() override;
+
+    /**
+     * Clear one strip and draw the ripples on it
+     * @param strip Which strip to draw
+     */
+    void renderStrip(StripJob strip) override;
+
     // Collection of all active ripples
     std::vector<Ripple> ripples;
 
@@ -79,13 +102,25 @@ private:
 
     // Effect parameters
     static const int MAX_RIPPLES = 50;              // Maximum number of simultaneous ripples
+    static constexpr float REFERENCE_FRAME_MS = 16.0f; // Frame length the per-frame values below are tuned for
     static const int RIPPLE_CREATE_CHANCE = 12;     // Chance to create new ripple each frame (out of 100)
     static constexpr float MAX_RADIUS = 14.0f;      // Maximum radius (12 LEDs on each side = 24 total)
     static constexpr float FADE_START_RADIUS = 6.0f; // Start fading at this radius
     static constexpr float RIPPLE_SPEED = 0.2f;     // Speed of ripple expansion per frame
+    static const uint8_t MAX_PIXEL_BRIGHTNESS = 230; // Brightest channel allowed where ripples overlap
+
+    // One canvas per segment: 3 core, 3 inner, 3 outer, 1 ring
+    static const int NUM_CANVASES = 10;
+    static const int TOTAL_CANVAS_LEDS = (LED_STRIP_CORE_COUNT / 3) * 3 + LED_STRIP_INNER_COUNT +
+                                         LED_STRIP_OUTER_COUNT + LED_STRIP_RING_COUNT;
+
+    RippleCanvas canvases[NUM_CANVASES];
+    uint16_t accumulation[TOTAL_CANVAS_LEDS * 3];  // Storage shared by all canvases
 
-    // Timing
-    unsigned long lastUpdate;
+    // Ripple brightness by distance from the center (as a fraction of the radius, 0-255),
+    // with the 1.2 power curve and 15% minimum already applied. Shared by all instances.
+    static uint8_t falloffTable[256];
+    static bool falloffTableReady;
 
     /**
      * Create a new ripple at a random position on a random enabled strip
@@ -98,24 +133,41 @@ private:
     void updateRipples();
 
     /**
-     * Draw all active ripples to the LED strips
+     * Draw the active ripples of one strip type to the LEDs
+     * Adds each ripple into its canvas, then writes only the touched spans to the LEDs
+     * @param stripType The type of strip (0=core, 1=inner, 2=outer, 3=ring)
      */
-    void drawRipples();
+    void drawRipples(int stripType);
 
     /**
-     * Generate a random bright color for ripples
-     * @return Random color as CRGB
+     * Add one ripple into its canvas, touching only the LEDs inside its radius
+     * @param ripple The ripple to draw
      */
-    CRGB generateRandomColor();
+    void rasterizeRipple(const Ripple& ripple);
+
+    /**
+     * Brightness-limit the touched span of a canvas, write it to the LEDs and clear it
+     * @param canvas The canvas to write out
+     */
+    void resolveCanvas(RippleCanvas& canvas);
+
+    /**
+     * Find the canvas for a strip segment
+     * @param stripType The type of strip (0=core, 1=inner, 2=outer, 3=ring)
+     * @param subStrip Which segment for multi-segment strips
+     */
+    RippleCanvas& getCanvas(int stripType, int subStrip);
 
     /**
-     * Calculate brightness for a ripple at a given distance from center
-     * @param distance Distance from ripple center
-     * @param radius Current radius of the ripple
-     * @param fadeOut Current fade-out value of the ripple
-     * @return Brightness factor (0.0 to 1.0)
+     * Fill falloffTable (runs once, the first time an AuraEffect is created)
      */
-    float calculateRippleBrightness(float distance, float radius, float fadeOut);
+    static void buildFalloffTable();
+
+    /**
+     * Generate a random bright color for ripples
+     * @return Random color as CRGB
+     */
+    CRGB generateRandomColor();
 
     /**
      * Get the length of a strip based on its type
@@ -3,6 +3,7 @@
 #include "CandleFlickerEffect.h"
 
 // Timing constants - FASTER AND SMOOTHER
+static constexpr float REFERENCE_FRAME_MS = 25.0f;  // Frame length the per-frame speeds are tuned for
 static constexpr unsigned long FLICKER_UPDATE_INTERVAL = 60; // Faster updates (every 60ms instead of 120ms)
 
 // Global flicker parameters (affects whole lamp) - MORE NOTICEABLE FLICKERING
@@ -29,7 +30,7 @@ static constexpr float FADE_END_POSITION = 0.9f;          // Complete fade by 90
 // Animation constants for the floating bright spot - LARGER SPAN AROUND MIDDLE
 static constexpr float BRIGHT_SPOT_MIN = 0.2f;      // 20% position - larger range from middle
 static constexpr float BRIGHT_SPOT_MAX = 0.8f;      // 80% position - larger range from middle (center is 50%)
-static constexpr float BRIGHT_SPOT_SPEED = 0.08f;   // How fast it moves toward target
+static constexpr float BRIGHT_SPOT_SPEED = 0.08f;   // How fast it moves toward target (share of the gap per 25ms frame)
 static constexpr unsigned long POSITION_UPDATE_INTERVAL = 80; // Change target every 80ms
 static constexpr int POSITION_CHANGE_CHANCE = 60;   // 60% chance to pick new target
 
@@ -76,9 +77,9 @@ void CandleFlickerEffect::reset() {
     lastPositionUpdate = 0;
 }
 
-void CandleFlickerEffect::update() {
+void CandleFlickerEffect::render() {
     // Standard effect timing check
-    if (!shouldUpdate(25)) { // Update at ~40 FPS for smoother animation (was ~30 FPS)
+    if (!beginFrame(25, REFERENCE_FRAME_MS)) { // Update at ~40 FPS for smoother animation (was ~30 FPS)
         return;
     }
 
@@ -89,16 +90,13 @@ void CandleFlickerEffect::update() {
     updateBrightSpotPosition();
 
     // Clear all LEDs first
-    leds.clearAll();
+    target->clearAll();
 
     // Apply candle flame effect to inner strips
     applyCandleFlameToInner();
 
     // Apply candle flame with fade to outer strips
     applyCandleFlameAndFadeToOuter();
-
-    // Show the updated LEDs
-    leds.showAll();
 }
 
 void CandleFlickerEffect::updateFlickerIntensities() {
@@ -113,13 +111,13 @@ void CandleFlickerEffect::updateFlickerIntensities() {
 
     // === GLOBAL FLICKER (affects entire lamp) ===
     // This creates the overall candle breathing/flickering that affects everything
-    if (random(100) < GLOBAL_FLICKER_CHANCE) {
+    if (rng.chance(GLOBAL_FLICKER_CHANCE, 100)) {
         // Set new target for global flicker (smaller range for subtle effect)
-        globalFlickerTarget = GLOBAL_MIN_INTENSITY + (random(100) / 100.0f) * (GLOBAL_MAX_INTENSITY - GLOBAL_MIN_INTENSITY);
+        globalFlickerTarget = GLOBAL_MIN_INTENSITY + (rng.range(100) / 100.0f) * (GLOBAL_MAX_INTENSITY - GLOBAL_MIN_INTENSITY);
 
         // Very rare stronger flickers for the whole lamp
-        if (random(100) < GLOBAL_BRIGHT_FLICKER_CHANCE) {
-            globalFlickerTarget = GLOBAL_BRIGHT_INTENSITY + (random(10) / 100.0f); // Small random variation
+        if (rng.chance(GLOBAL_BRIGHT_FLICKER_CHANCE, 100)) {
+            globalFlickerTarget = GLOBAL_BRIGHT_INTENSITY + (rng.range(10) / 100.0f); // Small random variation
         }
     }
 
@@ -131,22 +129,22 @@ void CandleFlickerEffect::updateFlickerIntensities() {
     // These are much gentler and less frequent
 
     // Main flame zone (top) - more noticeable variation
-    if (random(100) < ZONE_FLICKER_CHANCE) {
-        mainFlameTarget = ZONE_BASE_INTENSITY + (random(60) / 100.0f) * ZONE_VARIATION_RANGE; // 0.8 to 1.2
+    if (rng.chance(ZONE_FLICKER_CHANCE, 100)) {
+        mainFlameTarget = ZONE_BASE_INTENSITY + (rng.range(60) / 100.0f) * ZONE_VARIATION_RANGE; // 0.8 to 1.2
     }
     float mainDifference = mainFlameTarget - mainFlameIntensity;
     mainFlameIntensity += mainDifference * ZONE_SMOOTH_FACTOR;
 
     // Secondary flame zone (middle) - noticeable but less than main
-    if (random(100) < ZONE_FLICKER_CHANCE / 2) {
-        secondaryFlameTarget = ZONE_BASE_INTENSITY * 1.1f + (random(50) / 100.0f) * ZONE_VARIATION_RANGE * 0.7f; // 0.97 to 1.38
+    if (rng.chance(ZONE_FLICKER_CHANCE / 2, 100)) {
+        secondaryFlameTarget = ZONE_BASE_INTENSITY * 1.1f + (rng.range(50) / 100.0f) * ZONE_VARIATION_RANGE * 0.7f; // 0.97 to 1.38
     }
     float secondaryDifference = secondaryFlameTarget - secondaryFlameIntensity;
     secondaryFlameIntensity += secondaryDifference * ZONE_SMOOTH_FACTOR;
 
     // Base glow zone (bottom) - brightest with small variations
-    if (random(100) < ZONE_FLICKER_CHANCE / 3) {
-        baseGlowTarget = ZONE_BASE_INTENSITY * 1.3f + (random(40) / 100.0f) * ZONE_VARIATION_RANGE * 0.5f; // 1.2 to 1.56
+    if (rng.chance(ZONE_FLICKER_CHANCE / 3, 100)) {
+        baseGlowTarget = ZONE_BASE_INTENSITY * 1.3f + (rng.range(40) / 100.0f) * ZONE_VARIATION_RANGE * 0.5f; // 1.2 to 1.56
     }
     float baseDifference = baseGlowTarget - baseGlowIntensity;
     baseGlowIntensity += baseDifference * ZONE_SMOOTH_FACTOR * 0.8f; // Slightly slower but still smooth
@@ -160,15 +158,15 @@ void CandleFlickerEffect::updateBrightSpotPosition() {
         lastPositionUpdate = currentTime;
 
         // Randomly decide to change target position
-        if (random(100) < POSITION_CHANGE_CHANCE) {
+        if (rng.chance(POSITION_CHANGE_CHANCE, 100)) {
             // Pick new random target between 2/5 and 4/5
-            brightSpotTarget = BRIGHT_SPOT_MIN + (random(100) / 100.0f) * (BRIGHT_SPOT_MAX - BRIGHT_SPOT_MIN);
+            brightSpotTarget = BRIGHT_SPOT_MIN + (rng.range(100) / 100.0f) * (BRIGHT_SPOT_MAX - BRIGHT_SPOT_MIN);
         }
     }
 
-    // Smoothly move current position toward target
+    // Smoothly move current position toward target (same approach speed at any frame rate)
     float positionDifference = brightSpotTarget - brightSpotPosition;
-    brightSpotPosition += positionDifference * BRIGHT_SPOT_SPEED;
+    brightSpotPosition += positionDifference * (1.0f - frameDecay(1.0f - BRIGHT_SPOT_SPEED));
 }
 
 void CandleFlickerEffect::applyCandleFlameToInner() {
@@ -222,7 +220,7 @@ void CandleFlickerEffect::applyCandleFlameToInner() {
                 (uint8_t)min(255, (int)(baseColor.b * finalIntensity))
             );
 
-            leds.getInner()[ledIndex] = flickeredColor;
+            target->getInner()[ledIndex] = flickeredColor;
         }
     }
 }
@@ -294,7 +292,7 @@ void CandleFlickerEffect::applyCandleFlameAndFadeToOuter() {
                 (uint8_t)min(255, (int)(baseColor.b * finalBrightness))
             );
 
-            leds.getOuter()[ledIndex] = finalColor;
+            target->getOuter()[ledIndex] = finalColor;
         }
     }
 }
@@ -28,12 +28,6 @@ public:
      */
     CandleFlickerEffect(LEDController& ledController);
 
-    /**
-     * Update the flickering candle effect
-     * Updates global and zone flicker intensities and applies candle color with fade
-     */
-    void update() override;
-
     /**
      * Reset the effect - resets all flicker intensities
      */
@@ -43,9 +37,15 @@ public:
      * Get the name of this effect
      * @return Effect name for display/debugging
      */
-    String getName() const override { return "Candle Flicker"; }
+    const char* getName() const override { return "Candle Flicker"; }
 
 private:
+    /**
+     * Update the flickering candle effect
+     * Updates global and zone flicker intensities and applies candle color with fade
+     */
+    void render() override;
+
     // Base candle color (warm 1800K temperature)
     CRGB baseColor;
 
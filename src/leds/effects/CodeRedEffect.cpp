@@ -8,29 +8,44 @@ CodeRedEffect::CodeRedEffect(LEDController& ledController) :
     currentSize(0),
     leftPosition(0),
     rightPosition(0),
-    lastUpdateTime(0),
+    lastCoreStepTime(0),
     lastTrailCreateTime(0),
     lastRingTrailCreateTime(0),  // Initialize ring trail timing
     breathingPhase(0.0f),
     breathingSpeed(0.02f),      // Slow breathing cycle - adjust this for faster/slower breathing
     minBrightness(0.4f),        // 40% minimum brightness
-    maxBrightness(1.0f)         // 100% maximum brightness
+    maxBrightness(1.0f),        // 100% maximum brightness
+    persistentTrails(false),
+    innerTrailBuffer(LED_STRIP_INNER_COUNT),
+    outerTrailBuffer(LED_STRIP_OUTER_COUNT)
 {
     // Initialize trails vectors
     trails.reserve(MAX_TRAILS);
     ringTrails.reserve(MAX_RING_TRAILS);
 
+    // Both strips share the same trail speeds, so they use the same decay factor
+    uint16_t trailDecay = DecayBuffer::decayForTrail(TYPICAL_TRAIL_SPEED, TRAIL_HALF_LIFE);
+    innerTrailBuffer.setDecay(trailDecay);
+    outerTrailBuffer.setDecay(trailDecay);
+
     Serial.println("CoreGrowEffect created - core grows + breathing trails + breathing ring trails");
 }
 
 void CodeRedEffect::reset() {
+    restartCore();
+
+    // Fill the strips with trails in flight rather than starting empty
+    warmUp(warmUpMs());
+}
+
+void CodeRedEffect::restartCore() {
     currentPhase = GROWING;
     currentSize = 0;
     leftPosition = 0;
     rightPosition = 0;
-    lastUpdateTime = millis();
-    lastTrailCreateTime = millis();
-    lastRingTrailCreateTime = millis();  // Reset ring trail timing
+    lastCoreStepTime = now();
+    lastTrailCreateTime = now();
+    lastRingTrailCreateTime = now();  // Reset ring trail timing
 
     // DON'T clear trails - let them continue independently
     // trails.clear(); // <- REMOVED THIS LINE
@@ -39,42 +54,47 @@ void CodeRedEffect::reset() {
     Serial.println("CoreGrowEffect reset to growing phase (trails continue)");
 }
 
-void CodeRedEffect::update() {
+void CodeRedEffect::setPersistentTrails(bool enabled) {
+    if (enabled == persistentTrails) return;
+
+    persistentTrails = enabled;
+
+    // Start from empty buffers so old tails don't flash in when switching modes
+    innerTrailBuffer.clear();
+    outerTrailBuffer.clear();
+}
+
+void CodeRedEffect::render() {
+    // No frame rate cap - just measure the time step so motion speed does not depend on it
+    beginFrame(0, REFERENCE_FRAME_MS);
+
     // Clear all strips first
-    leds.clearAll();
+    target->clearAll();
 
     // Update breathing phase for trails AND ring (synchronized)
-    breathingPhase += breathingSpeed;
+    breathingPhase += breathingSpeed * frameStep;
     if (breathingPhase > 2.0f * PI) {
         breathingPhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
     }
 
-    unsigned long currentTime = millis();
+    unsigned long currentTime = now();
 
     // Update and draw trails first (so core effect can overlap)
     updateTrails();
-    drawTrails();
+    if (persistentTrails) {
+        drawTrailsPersistent();
+    } else {
+        drawTrails();
+    }
 
     // Update ring trail effects (replaces single breathing ring)
     updateRingTrails();
 
     // Create new trails with staggered timing to prevent waves
-    int activeTrails = 0;
-    for (const auto& trail : trails) {
-        if (trail.active) activeTrails++;
-    }
-
-    // Calculate dynamic interval with randomness to prevent synchronized waves
-    int createInterval = TRAIL_CREATE_INTERVAL + random(-TRAIL_STAGGER_VARIANCE, TRAIL_STAGGER_VARIANCE);
-
-    // Create new trails when needed with variance to prevent synchronization
-    if (activeTrails < TARGET_TRAILS && (currentTime - lastTrailCreateTime >= createInterval)) {
-        createNewTrail();
-        lastTrailCreateTime = currentTime;
-    }
+    spawnTrails(currentTime);
 
     // Core effect phases (handle growth and movement)
-    if (currentTime - lastUpdateTime >= ((currentPhase == GROWING) ? GROW_INTERVAL : MOVE_INTERVAL)) {
+    if (currentTime - lastCoreStepTime >= ((currentPhase == GROWING) ? GROW_INTERVAL : MOVE_INTERVAL)) {
         if (currentPhase == GROWING) {
             // Growing phase
             currentSize++;
@@ -98,12 +118,12 @@ void CodeRedEffect::update() {
 
             // Check if patterns have moved completely off their segments
             if (leftPosition < -MAX_SIZE && rightPosition >= coreSegmentLength + MAX_SIZE) {
-                // Reset to growing phase
-                reset();
+                // Back to the growing phase
+                restartCore();
             }
         }
 
-        lastUpdateTime = currentTime;
+        lastCoreStepTime = currentTime;
     }
 
     // Draw core effect on all 3 segments
@@ -143,9 +163,60 @@ void CodeRedEffect::update() {
             drawPattern(segment, segmentRightPos);
         }
     }
+}
+
+void CodeRedEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, REFERENCE_FRAME_MS);
+    updateTrails();
+    if (persistentTrails) {
+        stampWarmUpTrails();
+    }
+    spawnTrails(now());
+}
 
-    // Show the LEDs
-    leds.showAll();
+void CodeRedEffect::stampWarmUpTrails() {
+    innerTrailBuffer.fade(frameStep);
+    outerTrailBuffer.fade(frameStep);
+
+    // A step moves a head several LEDs - stamp every LED it passed, faded
+    // by how long ago it was there, so the tail looks like the live one
+    const CRGB headColor = CRGB(255, 35, 0);
+    for (const auto& trail : trails) {
+        if (!trail.active || trail.speed <= 0.0f) continue;
+
+        int stripLength = (trail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
+        float travelled = trail.speed * frameStep;
+        float start = trail.direction ? trail.position - travelled : trail.position + travelled;
+        int from = (int)min(start, trail.position);
+        int to = (int)max(start, trail.position);
+
+        for (int headPos = max(from, 0); headPos <= min(to, stripLength - 1); headPos++) {
+            float framesAgo = fabsf(trail.position - headPos) / trail.speed;
+            int physicalPos = leds.mapPositionToPhysical(trail.stripType, headPos, trail.subStrip);
+            if (trail.stripType == 1) {
+                innerTrailBuffer.stampFaded(physicalPos + trail.subStrip * INNER_LEDS_PER_STRIP, headColor, framesAgo);
+            } else {
+                outerTrailBuffer.stampFaded(physicalPos + trail.subStrip * OUTER_LEDS_PER_STRIP, headColor, framesAgo);
+            }
+        }
+    }
+}
+
+void CodeRedEffect::spawnTrails(unsigned long currentTime) {
+    int activeTrails = 0;
+    for (const auto& trail : trails) {
+        if (trail.active) activeTrails++;
+    }
+
+    // Calculate dynamic interval with randomness to prevent synchronized waves
+    int createInterval = TRAIL_CREATE_INTERVAL + rng.range(-TRAIL_STAGGER_VARIANCE, TRAIL_STAGGER_VARIANCE);
+
+    // Create new trails when needed with variance to prevent synchronization
+    // (fewer trails at reduced quality - the ones already running still finish)
+    if (activeTrails < qualityBudget(TARGET_TRAILS) && (currentTime - lastTrailCreateTime >= createInterval)) {
+        createNewTrail();
+        lastTrailCreateTime = currentTime;
+    }
 }
 
 float CodeRedEffect::calculateBreathingBrightness() {
@@ -187,10 +258,10 @@ void CodeRedEffect::updateRingTrails() {
     }
 
     // Calculate dynamic interval with randomness to prevent synchronized waves
-    int createInterval = RING_TRAIL_CREATE_INTERVAL + random(-RING_TRAIL_STAGGER_VARIANCE, RING_TRAIL_STAGGER_VARIANCE);
+    int createInterval = RING_TRAIL_CREATE_INTERVAL + rng.range(-RING_TRAIL_STAGGER_VARIANCE, RING_TRAIL_STAGGER_VARIANCE);
 
     // Create new ring trails as needed
-    if (activeRingTrails < TARGET_RING_TRAILS && (currentTime - lastRingTrailCreateTime >= createInterval)) {
+    if (activeRingTrails < qualityBudget(TARGET_RING_TRAILS) && (currentTime - lastRingTrailCreateTime >= createInterval)) {
         createNewRingTrail();
         lastRingTrailCreateTime = currentTime;
     }
@@ -201,13 +272,13 @@ void CodeRedEffect::updateRingTrails() {
 
         // Move the trail around the ring
         if (trail.clockwise) {
-            trail.position += trail.speed;
+            trail.position += trail.speed * frameStep;
             // Wrap around when we reach the end
             if (trail.position >= LED_STRIP_RING_COUNT) {
                 trail.position -= LED_STRIP_RING_COUNT;
             }
         } else {
-            trail.position -= trail.speed;
+            trail.position -= trail.speed * frameStep;
             // Wrap around when we go below 0
             if (trail.position < 0) {
                 trail.position += LED_STRIP_RING_COUNT;
@@ -239,20 +310,20 @@ void CodeRedEffect::createNewRingTrail() {
     RingTrail newTrail;
 
     // Random starting position around the ring
-    newTrail.position = random(LED_STRIP_RING_COUNT);
+    newTrail.position = rng.range(LED_STRIP_RING_COUNT);
 
     // Random direction (clockwise or counter-clockwise)
-    newTrail.clockwise = random(2) == 1;
+    newTrail.clockwise = rng.range(2) == 1;
 
     // Random speed (slower than linear trails for smooth circular motion)
-    newTrail.speed = 0.08f + (random(100) / 100.0f) * 0.12f; // 0.08 to 0.20 speed range
+    newTrail.speed = 0.08f + (rng.range(100) / 100.0f) * 0.12f; // 0.08 to 0.20 speed range
 
     // Set trail length
     newTrail.length = RING_TRAIL_LENGTH;
 
     // Set creation time and random lifespan (8-15 seconds for nice variety)
     newTrail.creationTime = millis();
-    newTrail.lifespan = 8000 + random(7000); // 8000ms to 15000ms (8-15 seconds)
+    newTrail.lifespan = 8000 + rng.range(7000); // 8000ms to 15000ms (8-15 seconds)
 
     // Activate the trail
     newTrail.active = true;
@@ -264,7 +335,7 @@ void CodeRedEffect::createNewRingTrail() {
 void CodeRedEffect::drawRingTrails() {
     // Clear the ring first
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        leds.getRing()[i] = CRGB::Black;
+        target->getRing()[i] = CRGB::Black;
     }
 
     // Calculate the current breathing brightness multiplier for all ring trails
@@ -303,7 +374,7 @@ void CodeRedEffect::drawRingTrails() {
             CRGB color = CRGB(redValue, 0, 0);
 
             // Add the color to the existing pixel (in case trails overlap)
-            leds.getRing()[pixelPos] += color;
+            target->getRing()[pixelPos] += color;
         }
     }
 }
@@ -317,16 +388,16 @@ void CodeRedEffect::createNewTrail() {
     CoreTrail newTrail;
 
     // Randomly choose inner (1) or outer (2) strips
-    newTrail.stripType = random(1, 3);
+    newTrail.stripType = rng.range(1, 3);
 
     // Randomly choose which segment (0, 1, or 2)
-    newTrail.subStrip = random(3);
+    newTrail.subStrip = rng.range(3);
 
     // Get strip length
     int stripLength = (newTrail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
 
     // Randomly choose direction for both inner and outer strips
-    newTrail.direction = random(2) == 1; // true = upward, false = downward
+    newTrail.direction = rng.range(2) == 1; // true = upward, false = downward
 
     // Set starting position based on direction (start trails completely off the strip)
     if (newTrail.direction) {
@@ -338,10 +409,10 @@ void CodeRedEffect::createNewTrail() {
     }
 
     // Random speed with less variation to keep trails slower and more consistent
-    float baseSpeed = 0.14f + (random(100) / 100.0f) * 0.16f; // 0.14 to 0.30 (much smaller range)
+    float baseSpeed = 0.14f + (rng.range(100) / 100.0f) * 0.16f; // 0.14 to 0.30 (much smaller range)
 
     // Add minimal randomness to speed to prevent trails from moving in sync
-    float speedVariance = (random(100) / 100.0f) * 0.03f - 0.015f; // ±0.015 variance (much smaller)
+    float speedVariance = (rng.range(100) / 100.0f) * 0.03f - 0.015f; // ±0.015 variance (much smaller)
     newTrail.speed = baseSpeed + speedVariance;
     newTrail.active = true;
 
@@ -357,10 +428,10 @@ void CodeRedEffect::updateTrails() {
         // Move the trail
         if (trail.direction) {
             // Moving upward
-            trail.position += trail.speed;
+            trail.position += trail.speed * frameStep;
         } else {
             // Moving downward
-            trail.position -= trail.speed;
+            trail.position -= trail.speed * frameStep;
         }
 
         // Get strip length
@@ -458,43 +529,57 @@ void CodeRedEffect::drawTrails() {
                 physicalPos += trail.subStrip * OUTER_LEDS_PER_STRIP;
             }
 
-            // Apply fade-to-black mask for outer strips only
-            if (trail.stripType == 2) {
-                // Calculate position ratio (0.0 at bottom, 1.0 at top)
-                float positionRatio = (float)pixelPos / (OUTER_LEDS_PER_STRIP - 1);
-
-                // Apply fade starting at 30% up the strip
-                if (positionRatio > 0.3f) {
-                    // Calculate fade amount (0.0 at 30%, 1.0 at top)
-                    float fadeProgress = (positionRatio - 0.3f) / 0.7f; // 0.7 = 1.0 - 0.3
-
-                    // Apply exponential curve for smoother fade
-                    fadeProgress = fadeProgress * fadeProgress; // Square for exponential fade
-
-                    // Calculate fade multiplier (1.0 at 30%, 0.0 at top)
-                    float fadeMask = 1.0f - fadeProgress;
-
-                    // Apply fade mask to the color
-                    color.r = color.r * fadeMask;
-                    color.g = color.g * fadeMask;
-                    color.b = color.b * fadeMask;
-                }
-            }
-
             // Set the LED
             if (trail.stripType == 1) {
                 // Inner strips
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-                    leds.getInner()[physicalPos] = color;
+                    target->getInner()[physicalPos] = color;
                 }
             } else {
                 // Outer strips
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-                    leds.getOuter()[physicalPos] = color;
+                    target->getOuter()[physicalPos] = color;
                 }
             }
         }
     }
+
+    // Fade the outer strips to black towards the top
+    leds.applyMask(target->getOuter(), LEDController::MASK_OUTER_TRAIL_FADE);
+}
+
+void CodeRedEffect::drawTrailsPersistent() {
+    // Fade the old head positions - this is what draws the tails
+    innerTrailBuffer.fade(frameStep);
+    outerTrailBuffer.fade(frameStep);
+
+    // Head color: full red with the orange shooting star tip
+    const CRGB headColor = CRGB(255, 35, 0);
+
+    for (const auto& trail : trails) {
+        if (!trail.active) continue;
+
+        // Only the head is stamped; skip it while it is off the strip
+        int stripLength = (trail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
+        int headPos = (int)trail.position;
+        if (headPos < 0 || headPos >= stripLength) continue;
+
+        int physicalPos = leds.mapPositionToPhysical(trail.stripType, headPos, trail.subStrip);
+
+        if (trail.stripType == 1) {
+            innerTrailBuffer.stamp(physicalPos + trail.subStrip * INNER_LEDS_PER_STRIP, headColor);
+        } else {
+            outerTrailBuffer.stamp(physicalPos + trail.subStrip * OUTER_LEDS_PER_STRIP, headColor);
+        }
+    }
+
+    // Breathing is applied once per LED on output
+    uint8_t outputScale = (uint8_t)(calculateBreathingBrightness() * 255.0f);
+    innerTrailBuffer.render(target->getInner(), outputScale);
+    outerTrailBuffer.render(target->getOuter(), outputScale);
+
+    // The outer fade-to-black mask depends only on height, so apply it after rendering
+    leds.applyMask(target->getOuter(), LEDController::MASK_OUTER_TRAIL_FADE);
 }
 
 float CodeRedEffect::calculateBrightness(int offset) {
@@ -515,9 +600,9 @@ void CodeRedEffect::drawPattern(int segment, int centerPos) {
     // Draw center LED in bright red at 100% brightness
     if (centerPos >= segmentStart && centerPos <= segmentEnd) {
         // Use max instead of add to prevent brightness increase from overlapping
-        CRGB currentColor = leds.getCore()[centerPos];
+        CRGB currentColor = target->getCore()[centerPos];
         CRGB newColor = CRGB(255, 0, 0); // Bright red
-        leds.getCore()[centerPos] = CRGB(
+        target->getCore()[centerPos] = CRGB(
             max(currentColor.r, newColor.r),
             max(currentColor.g, newColor.g),
             max(currentColor.b, newColor.b)
@@ -538,9 +623,9 @@ void CodeRedEffect::drawPattern(int segment, int centerPos) {
         int leftPos = centerPos - offset;
         if (leftPos >= segmentStart && leftPos <= segmentEnd) {
             // Use max instead of add to prevent brightness increase from overlapping
-            CRGB currentColor = leds.getCore()[leftPos];
+            CRGB currentColor = target->getCore()[leftPos];
             CRGB newColor = CRGB(redValue, 0, 0);
-            leds.getCore()[leftPos] = CRGB(
+            target->getCore()[leftPos] = CRGB(
                 max(currentColor.r, newColor.r),
                 max(currentColor.g, newColor.g),
                 max(currentColor.b, newColor.b)
@@ -551,9 +636,9 @@ void CodeRedEffect::drawPattern(int segment, int centerPos) {
         int rightPos = centerPos + offset;
         if (rightPos >= segmentStart && rightPos <= segmentEnd) {
             // Use max instead of add to prevent brightness increase from overlapping
-            CRGB currentColor = leds.getCore()[rightPos];
+            CRGB currentColor = target->getCore()[rightPos];
             CRGB newColor = CRGB(redValue, 0, 0);
-            leds.getCore()[rightPos] = CRGB(
+            target->getCore()[rightPos] = CRGB(
                 max(currentColor.r, newColor.r),
                 max(currentColor.g, newColor.g),
                 max(currentColor.b, newColor.b)
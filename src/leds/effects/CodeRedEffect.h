@@ -4,6 +4,7 @@
 #define CORE_GROW_EFFECT_H
 
 #include "Effect.h"
+#include "../DecayBuffer.h"
 #include <vector>
 
 // Structure to represent a core effect trail
@@ -11,7 +12,7 @@ struct CoreTrail {
     int stripType;      // 1 = inner, 2 = outer
     int subStrip;       // Which segment (0, 1, or 2)
     float position;     // Current head position (float for smooth movement)
-    float speed;        // Movement speed (pixels per frame)
+    float speed;        // Movement speed (pixels per reference frame)
     bool active;        // Whether this trail is active
     bool direction;     // true = upward, false = downward
 };
@@ -19,7 +20,7 @@ struct CoreTrail {
 // Structure to represent a ring trail (circular movement)
 struct RingTrail {
     float position;     // Current head position around the ring (0 to LED_STRIP_RING_COUNT)
-    float speed;        // Movement speed (pixels per frame)
+    float speed;        // Movement speed (pixels per reference frame)
     int length;         // Length of the trail
     bool active;        // Whether this trail is active
     bool clockwise;     // true = clockwise, false = counter-clockwise
@@ -39,6 +40,11 @@ struct RingTrail {
  * - Trails: Breathing effect that fades from 40% to 100% brightness
  * - Ring: Breathing red trails that move in circles around the ring
  * - All breathing elements use the same timing for synchronized effect
+ *
+ * Inner/outer trails can be drawn two ways:
+ * - Classic: every LED of every trail is redrawn each frame
+ * - Persistent: a per-strip DecayBuffer is faded each frame and only the trail
+ *   heads are stamped in, so the cost scales with the number of heads
  */
 class CodeRedEffect : public Effect {
 public:
@@ -49,21 +55,37 @@ public:
     CodeRedEffect(LEDController& ledController);
 
     /**
-     * Update the animation
+     * Reset the effect to initial state
      */
-    void update() override;
+    void reset() override;
 
     /**
-     * Reset the effect to initial state
+     * Long enough for the first trails to run the length of the strips
      */
-    void reset() override;
+    unsigned long warmUpMs() const override { return TRAIL_WARM_UP_MS; }
 
     /**
      * Get the name of this effect
      */
-    String getName() const override { return "Core Grow Effect"; }
+    const char* getName() const override { return "Core Grow Effect"; }
+
+    /**
+     * Switch between classic and persistent (decay buffer) trail rendering
+     * @param enabled True to stamp trail heads into decay buffers instead of redrawing full trails
+     */
+    void setPersistentTrails(bool enabled);
 
 private:
+    /**
+     * Update the animation
+     */
+    void render() override;
+
+    /**
+     * Create and move the inner/outer trails for a warm-up step, without drawing
+     */
+    void simulate(unsigned long stepMs) override;
+
     // Animation phases
     enum Phase {
         GROWING = 0,    // Growing from 1 to 17 LEDs
@@ -74,15 +96,16 @@ private:
     int currentSize;                    // Current size during growing phase (0 to 8)
     int leftPosition;                   // Center position of left-moving pattern
     int rightPosition;                  // Center position of right-moving pattern
-    unsigned long lastUpdateTime;       // Last time we updated the animation
+    unsigned long lastCoreStepTime;     // Last time the core pattern grew or moved
 
     // Breathing effect variables for trails AND ring (synchronized)
     float breathingPhase;               // Current phase of breathing cycle (0.0 to 2*PI)
-    float breathingSpeed;               // Speed of breathing cycle
+    float breathingSpeed;               // Speed of breathing cycle (radians per reference frame)
     float minBrightness;                // Minimum brightness (40%)
     float maxBrightness;                // Maximum brightness (100%)
 
     // Timing constants for core effect
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;  // Frame length the per-frame speeds are tuned for
     static const int MAX_SIZE = 12;         // Maximum LEDs on each side of center (total 25 = 12+1+12)
     static const int GROW_INTERVAL = 100;   // Milliseconds between each growth step (slower for smoother appearance)
     static const int MOVE_INTERVAL = 50;    // Milliseconds between each movement step (faster for smoother movement)
@@ -96,11 +119,21 @@ private:
     unsigned long lastTrailCreateTime;       // Last time we created a trail
     static const int TRAIL_CREATE_INTERVAL = 80;  // Create a new trail every 80ms (very frequent)
     static const int TRAIL_STAGGER_VARIANCE = 40; // Add random variance to prevent waves
+    static const unsigned long TRAIL_WARM_UP_MS = 4000; // Trails start a full length off the strip - about 2s before they show
 
     // Trail management
     std::vector<CoreTrail> trails;          // Collection of all trails
     std::vector<RingTrail> ringTrails;      // Collection of ring trails
 
+    // Persistent trail rendering
+    bool persistentTrails;                  // True = decay buffer mode, false = classic full redraw
+    DecayBuffer innerTrailBuffer;           // Persistence buffer for the inner strips
+    DecayBuffer outerTrailBuffer;           // Persistence buffer for the outer strips
+
+    // Decay tuning - the shooting star falloff is down to 25% about 27 LEDs behind the head
+    static constexpr float TRAIL_HALF_LIFE = 14.0f;      // LEDs behind head where the tail is at 50%
+    static constexpr float TYPICAL_TRAIL_SPEED = 0.22f;  // Middle of the 0.14 to 0.30 speed range
+
     // Ring trail constants
     static const int MAX_RING_TRAILS = 6;        // Maximum number of ring trails at once
     static const int RING_TRAIL_LENGTH = 12;     // Length of each ring trail in LEDs
@@ -146,11 +179,22 @@ private:
      */
     void drawRingTrails();
 
+    /**
+     * Start the core pattern growing again (trails are left alone)
+     */
+    void restartCore();
+
     /**
      * Create a new trail on a random strip
      */
     void createNewTrail();
 
+    /**
+     * Create a new trail if there are too few and the staggered interval has passed
+     * @param currentTime Animation time (now())
+     */
+    void spawnTrails(unsigned long currentTime);
+
     /**
      * Update all active trails
      */
@@ -161,6 +205,18 @@ private:
      */
     void drawTrails();
 
+    /**
+     * Draw trails using the decay buffers
+     * Fades the buffers, stamps only the trail heads, then writes the result to the strips
+     */
+    void drawTrailsPersistent();
+
+    /**
+     * Warm-up version of the persistent trails: fade the decay buffers by the
+     * step and stamp the LEDs each head passed during it (nothing is drawn)
+     */
+    void stampWarmUpTrails();
+
     /**
      * Calculate brightness based on distance from center
      * @param offset Distance from center (0 = center, higher = further out)
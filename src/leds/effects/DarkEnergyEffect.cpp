@@ -6,27 +6,22 @@
 // Constructor - sets up the dark energy effect
 DarkEnergyEffect::DarkEnergyEffect(LEDController& ledController)
     : Effect(ledController), ballPosition(0.5f), ballVelocity(0.0f),
-      breathingPhase(0.0f), rangePhase(0.0f), energyPhase(0.0f), lastUpdateTime(0) {
+      breathingPhase(0.0f), rangePhase(0.0f), energyPhase(0.0f), movementPhase(0.0f) {
     // Constructor intentionally does NOT call leds.clear() as per your requirements
     // Effect will be applied on first update() call
     // Ball starts in center with no initial velocity
 }
 
 // Update the effect - applies dark energy pattern with hovering black ball
-void DarkEnergyEffect::update() {
-    // Get frame time for smooth animation
-    unsigned long currentTime = millis();
-    if (lastUpdateTime == 0) {
-        lastUpdateTime = currentTime;
-    }
-    float deltaTime = (currentTime - lastUpdateTime) / 1000.0f; // Convert to seconds
-    lastUpdateTime = currentTime;
+void DarkEnergyEffect::render() {
+    // Get the frame time step for smooth animation (no frame rate cap)
+    beginFrame(0, REFERENCE_FRAME_MS);
 
     // Update black ball animation
     updateBlackBall();
 
     // Clear all strips to start fresh
-    leds.clearAll();
+    target->clearAll();
 
     // Apply base red pattern to inner and outer strips
     applyInnerPattern();
@@ -36,9 +31,6 @@ void DarkEnergyEffect::update() {
     applyBlackBall();
 
     // Core and ring strips remain off (already cleared)
-
-    // Show all changes to make them visible
-    leds.showAll();
 }
 
 // Reset the effect to initial state
@@ -49,7 +41,7 @@ void DarkEnergyEffect::reset() {
     breathingPhase = 0.0f;
     rangePhase = 0.0f;
     energyPhase = 0.0f;
-    lastUpdateTime = 0;
+    movementPhase = 0.0f;
 }
 
 // Apply dark energy pattern to inner strips
@@ -66,7 +58,7 @@ void DarkEnergyEffect::applyInnerPattern() {
             float fadeBrightness = calculateFadeBrightness(i, INNER_LEDS_PER_STRIP);
 
             // Apply red color with calculated brightness
-            applyRedWithBrightness(leds.getInner()[ledIndex], fadeBrightness);
+            applyRedWithBrightness(target->getInner()[ledIndex], fadeBrightness);
         }
     }
 }
@@ -85,7 +77,7 @@ void DarkEnergyEffect::applyOuterPattern() {
             float fadeBrightness = calculateFadeBrightness(i, OUTER_LEDS_PER_STRIP);
 
             // Apply red color with calculated brightness
-            applyRedWithBrightness(leds.getOuter()[ledIndex], fadeBrightness);
+            applyRedWithBrightness(target->getOuter()[ledIndex], fadeBrightness);
         }
     }
 }
@@ -109,43 +101,35 @@ float DarkEnergyEffect::calculateFadeBrightness(int position, int stripLength) {
 
 // Apply red color with specified brightness to an LED
 void DarkEnergyEffect::applyRedWithBrightness(CRGB& color, float brightnessFactor) {
-    // Start with base red color at 50% brightness
-    CRGB baseColor = leds.neoColorToCRGB(BASE_RED_COLOR);
-
     // Apply base brightness (50%) and fade brightness
     float finalBrightness = BASE_BRIGHTNESS * brightnessFactor;
 
     // Set the LED color with calculated brightness
-    color = CRGB(
-        (uint8_t)(baseColor.r * finalBrightness),
-        (uint8_t)(baseColor.g * finalBrightness),
-        (uint8_t)(baseColor.b * finalBrightness)
-    );
+    color = Colors::scaled(Colors::fromHex(BASE_RED_COLOR), finalBrightness);
 }
 
 // Update black ball animation physics
 void DarkEnergyEffect::updateBlackBall() {
     // Update breathing phase for size animation
-    breathingPhase += BALL_BREATHING_SPEED;
+    breathingPhase += BALL_BREATHING_SPEED * frameStep;
     if (breathingPhase > 2.0f * PI) {
         breathingPhase -= 2.0f * PI;
     }
 
     // Update range phase for travel range animation
-    rangePhase += BALL_RANGE_SPEED;
+    rangePhase += BALL_RANGE_SPEED * frameStep;
     if (rangePhase > 2.0f * PI) {
         rangePhase -= 2.0f * PI;
     }
 
     // Update energy phase for red base pulsing
-    energyPhase += ENERGY_PULSE_SPEED;
+    energyPhase += ENERGY_PULSE_SPEED * frameStep;
     if (energyPhase > 2.0f * PI) {
         energyPhase -= 2.0f * PI;
     }
 
     // Simple smooth sine wave motion - like a pendulum
-    static float movementPhase = 0.0f;
-    movementPhase += BALL_MOVE_SPEED;
+    movementPhase += BALL_MOVE_SPEED * frameStep;
     if (movementPhase > 2.0f * PI) {
         movementPhase -= 2.0f * PI;
     }
@@ -218,8 +202,8 @@ void DarkEnergyEffect::applyBlackBall() {
                 edgeFalloff = edgeFalloff * edgeFalloff; // Square for smoother edge
 
                 // Apply black by reducing existing color brightness
-                CRGB currentColor = leds.getInner()[ledIndex];
-                leds.getInner()[ledIndex] = CRGB(
+                CRGB currentColor = target->getInner()[ledIndex];
+                target->getInner()[ledIndex] = CRGB(
                     (uint8_t)(currentColor.r * (1.0f - edgeFalloff)),
                     (uint8_t)(currentColor.g * (1.0f - edgeFalloff)),
                     (uint8_t)(currentColor.b * (1.0f - edgeFalloff))
@@ -251,8 +235,8 @@ void DarkEnergyEffect::applyBlackBall() {
                 edgeFalloff = edgeFalloff * edgeFalloff; // Square for smoother edge
 
                 // Apply black by reducing existing color brightness
-                CRGB currentColor = leds.getOuter()[ledIndex];
-                leds.getOuter()[ledIndex] = CRGB(
+                CRGB currentColor = target->getOuter()[ledIndex];
+                target->getOuter()[ledIndex] = CRGB(
                     (uint8_t)(currentColor.r * (1.0f - edgeFalloff)),
                     (uint8_t)(currentColor.g * (1.0f - edgeFalloff)),
                     (uint8_t)(currentColor.b * (1.0f - edgeFalloff))
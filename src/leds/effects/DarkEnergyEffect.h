@@ -31,12 +31,6 @@ public:
      */
     DarkEnergyEffect(LEDController& ledController);
 
-    /**
-     * Update the effect - applies the dark energy pattern with hovering black ball
-     * Handles ball movement, breathing, range animation, and red base pattern
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Resets ball position, breathing phase, and range phase
@@ -47,14 +41,23 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Dark Energy Effect"; }
+    const char* getName() const override { return "Dark Energy Effect"; }
 
 private:
+    /**
+     * Update the effect - applies the dark energy pattern with hovering black ball
+     * Handles ball movement, breathing, range animation, and red base pattern
+     */
+    void render() override;
+
     // Effect color constants
     static constexpr uint32_t BASE_RED_COLOR = 0xFF0000;    // Pure red color
     static constexpr float BASE_BRIGHTNESS = 0.5f;         // 50% brightness
     static constexpr float FADE_PERCENTAGE = 0.9f;         // 90% fade to black
 
+    // Animation speeds below are in radians per reference frame
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;      // Frame length the speeds are tuned for
+
     // Black ball animation constants
     static constexpr float BALL_COVERAGE = 0.7f;           // Ball covers 70% of strip length
     static constexpr float BALL_MOVE_SPEED = 0.025f;       // Speed of up/down movement
@@ -77,7 +80,7 @@ private:
     float breathingPhase;       // Current breathing animation phase (0.0 to 2*PI)
     float rangePhase;           // Current range animation phase (0.0 to 2*PI)
     float energyPhase;          // Current energy pulse phase (0.0 to 2*PI)
-    unsigned long lastUpdateTime;  // Time tracking for frame-rate independence
+    float movementPhase;        // Current up/down movement phase (0.0 to 2*PI)
 
     /**
      * Apply the dark energy pattern to inner strips
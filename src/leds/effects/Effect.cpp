@@ -0,0 +1,225 @@
+// src/leds/effects/Effect.cpp
+#include "Effect.h"
+#include "../RenderWorker.h"
+#include "../BakedLoop.h"
+
+RenderWorker* Effect::stripWorker = nullptr;
+size_t Effect::bakedBytes = 0;
+
+Effect::~Effect() {
+    dropBakedLoop();
+}
+
+size_t Effect::bakedLoopBytes() const {
+    return loopPeriodMs() > 0 ? BakedLoop::bytesFor(loopPeriodMs(), loopFrameMs()) : 0;
+}
+
+void Effect::dropBakedLoop() {
+    if (bakedLoop != nullptr) {
+        bakedBytes -= bakedLoop->getBytes();
+    }
+    delete bakedLoop;
+    delete loopFrame;
+    bakedLoop = nullptr;
+    loopFrame = nullptr;
+}
+
+bool Effect::setBaked(bool baked) {
+    if (!baked || loopPeriodMs() == 0) {
+        dropBakedLoop();
+        return false;
+    }
+
+    if (bakedLoop != nullptr) {
+        return true;
+    }
+
+    if (BAKE_PSRAM_BUDGET > 0 && bakedBytes + bakedLoopBytes() > BAKE_PSRAM_BUDGET) {
+        Serial.print(getName());
+        Serial.println(": baked loops are over BAKE_PSRAM_BUDGET - drawing live");
+        return false;
+    }
+
+    BakedLoop* loop = new BakedLoop();
+    if (!loop->begin(loopPeriodMs(), loopFrameMs(), BAKE_SEAM_MS)) {
+        Serial.print(getName());
+        Serial.println(": not enough PSRAM for a baked loop - drawing live");
+        delete loop;
+        return false;
+    }
+
+    bakedLoop = loop;
+    bakedBytes += bakedLoop->getBytes();
+    loopFrame = new OffscreenTarget();
+    loopStale = true;  // Record from the next update
+
+    Serial.print(getName());
+    Serial.print(": baking a ");
+    Serial.print(loopPeriodMs());
+    Serial.print("ms loop into PSRAM (");
+    Serial.print(bakedLoop->getBytes());
+    Serial.print(" bytes, ");
+    Serial.print(bakedBytes);
+    Serial.println(" baked in total)");
+    return true;
+}
+
+void Effect::playBakedLoop() {
+    unsigned long currentTime = millis();
+    unsigned long frameMs = bakedLoop->getFrameMs();
+
+    // If the effect stopped running partway through recording, its own timers
+    // (spawn times, color cycles) moved on with now() - frames recorded so far
+    // would not join up with the ones drawn from here, so start over
+    if (!bakedLoop->isComplete() && currentTime - lastPlayTime > MAX_FRAME_GAP_MS) {
+        loopStale = true;
+    }
+    lastPlayTime = currentTime;
+
+    if (loopStale) {
+        // New loop (or a setting changed, or recording was interrupted) - record it from here
+        loopStale = false;
+        bakedLoop->restart();
+        loopStartTime = currentTime;
+        lastUpdateTime = currentTime - frameMs;  // The first recorded frame is one normal step
+    }
+
+    if (!bakedLoop->isComplete()) {
+        unsigned long wanted = (currentTime - loopStartTime) / frameMs + 2;
+
+        // Record up to one frame ahead of the time shown, so playback always
+        // has two frames to blend. Stored frames always include the ring.
+        RenderTarget* shown = target;
+        bool ringSkipped = skipRing;
+        target = loopFrame;
+        skipRing = false;
+        loopClockActive = true;
+
+        for (int frames = 0; frames < 2 && (unsigned long)bakedLoop->getRecordedFrames() < wanted && !bakedLoop->isComplete(); frames++) {
+            loopClock = loopStartTime + bakedLoop->getRecordedFrames() * frameMs;
+            render();
+            bakedLoop->recordFrame(*loopFrame);
+        }
+
+        loopClockActive = false;
+        skipRing = ringSkipped;
+        target = shown;
+        frameSkipped = false;  // A frame rate cap inside render() doesn't apply to playback
+
+        if (bakedLoop->isComplete()) {
+            Serial.print(getName());
+            Serial.println(": baked loop complete");
+        }
+    }
+
+    bakedLoop->draw(*target, currentTime - loopStartTime, !skipRing);
+}
+
+void Effect::resetBakedLoop() {
+    if (bakedLoop != nullptr && !bakedLoop->isComplete()) {
+        invalidate();
+    }
+}
+
+void Effect::warmUp(unsigned long ms) {
+    warmedUp = true;
+    if (ms < WARM_UP_STEP_MS) {
+        return;
+    }
+
+    // Simulate the time leading up to now, so anything the steps time with
+    // now() (spawn timers, ages) lines up with the frames that follow
+    unsigned long start = micros();
+    unsigned long endTime = millis();
+    bool clockWasActive = loopClockActive;
+    unsigned long clockBefore = loopClock;
+    loopClockActive = true;
+
+    for (unsigned long elapsed = WARM_UP_STEP_MS; elapsed <= ms; elapsed += WARM_UP_STEP_MS) {
+        loopClock = endTime - ms + elapsed;
+        simulate(WARM_UP_STEP_MS);
+
+        if (WARM_UP_BUDGET_US > 0 && micros() - start >= WARM_UP_BUDGET_US) {
+            break;
+        }
+    }
+
+    loopClockActive = clockWasActive;
+    loopClock = clockBefore;
+
+    // The next frame draws straight away and moves on by a single reference
+    // frame (see MAX_FRAME_GAP_MS), not a catch-up - so the update() that
+    // warms a new effect up also draws its first frame
+    lastUpdateTime = now() - MAX_FRAME_GAP_MS - 1;
+    tickCarry = 0.0f;
+}
+
+void Effect::renderStrips() {
+    // Biggest strip first, so the last job left is a short one
+    nextStripJob.store(STRIP_JOB_CORE, std::memory_order_relaxed);
+
+    // The worker pulls strips from the same queue while we do
+    bool shared = stripWorker != nullptr && stripWorker->startJob(stripJobRunner, this);
+    runStripJobs();
+
+    // Join before anyone shows the frame
+    if (shared) {
+        stripWorker->finish();
+    }
+
+#if STRIP_GUARD_LEDS > 0
+    // Debug: a strip job that draws past its strip races with the job drawing the next one
+    if (!target->guardsIntact()) {
+        Serial.print(getName());
+        Serial.println(" drew past the end of a strip");
+        target->armGuards();
+    }
+#endif
+}
+
+void Effect::runStripJobs() {
+    uint8_t strip;
+    while ((strip = nextStripJob.fetch_add(1, std::memory_order_relaxed)) < STRIP_JOB_COUNT) {
+        renderStrip((StripJob)strip);
+    }
+}
+
+bool Effect::stripJobRunner(void* effect) {
+    static_cast<Effect*>(effect)->runStripJobs();
+    return true;
+}
+
+void Effect::benchmarkStrips(int frames) {
+    if (!hasStripJobs() || frames <= 0) {
+        return;
+    }
+
+    OffscreenTarget scratch;
+    RenderTarget* previousTarget = target;
+    target = &scratch;
+
+    // Before: all four strips one after the other on this core
+    unsigned long start = micros();
+    for (int frame = 0; frame < frames; frame++) {
+        for (int strip = 0; strip < STRIP_JOB_COUNT; strip++) {
+            renderStrip((StripJob)strip);
+        }
+    }
+    unsigned long serialMicros = micros() - start;
+
+    // After: strips shared between both cores
+    start = micros();
+    for (int frame = 0; frame < frames; frame++) {
+        renderStrips();
+    }
+    unsigned long parallelMicros = micros() - start;
+
+    target = previousTarget;
+
+    Serial.print(getName());
+    Serial.print(" strip jobs per frame - one core: ");
+    Serial.print(serialMicros / frames);
+    Serial.print("us, two cores: ");
+    Serial.print(parallelMicros / frames);
+    Serial.println("us");
+}
@@ -1,13 +1,21 @@
 #ifndef EFFECT_H
 #define EFFECT_H
 
+#include <atomic>
 #include "../LEDController.h"
+#include "FastRandom.h"
+
+class RenderWorker;
+class BakedLoop;
 
 /**
  * Base class for all LED effects
  *
  * This class provides frame rate independence by tracking time between updates.
- * Child classes should use deltaTime for consistent animation speeds.
+ * Effects start each frame with beginFrame(), which measures the time step.
+ * Speeds stay written "per reference frame" (the frame length the effect was
+ * tuned for) and are multiplied by frameStep, so the same motion comes out
+ * at any frame rate.
  */
 class Effect {
 public:
@@ -15,64 +23,396 @@ public:
      * Constructor - creates an effect that works with the given LED controller
      * @param ledController Reference to the LED controller to use
      */
-    Effect(LEDController& ledController) : leds(ledController), lastUpdateTime(0) {}
+    Effect(LEDController& ledController) : leds(ledController), lastUpdateTime(0), rng(nextDefaultSeed()) {}
 
     /**
      * Virtual destructor - allows proper cleanup of child classes
      */
-    virtual ~Effect() {}
+    virtual ~Effect();
 
     /**
-     * Update the effect - must be implemented by child classes
-     * This is called every frame and should use deltaTime for frame rate independence
+     * Draw the effect's next frame into a render target
+     * Effects only draw - showing the frame on the strips is up to the caller
+     * @param target Where to draw: LEDController::getScreen() or an OffscreenTarget
+     * @return True if a new frame was drawn, false if the effect kept its last
+     *         one (frame rate cap) and the target was left untouched
      */
-    virtual void update() = 0;
+    bool update(RenderTarget& target) {
+        this->target = &target;
+        frameSkipped = false;
+        if (!warmedUp) {
+            warmUp(warmUpMs());  // First frame of a freshly built effect
+        }
+        if (bakedLoop != nullptr) {
+            playBakedLoop();
+        } else {
+            render();
+        }
+        return !frameSkipped;
+    }
 
     /**
      * Reset the effect to its initial state - optional to implement
      */
-    virtual void reset() { lastUpdateTime = millis(); }
+    virtual void reset() { lastUpdateTime = millis(); frameDirty = true; }
 
     /**
      * Get the name of this effect - must be implemented by child classes
-     * @return String containing the effect name for debugging/display
+     * Returns a string literal, so asking for it never allocates
+     * @return Effect name for debugging/display
      */
-    virtual String getName() const = 0;
+    virtual const char* getName() const = 0;
     /**
      * Check if ring LEDs should be skipped (for button feedback)
-     * @param buttonFeedbackActive True if button feedback is currently showing
+     * @param skipRing True if button feedback is currently showing
+     * @param redraw False for effects that keep the ring black - button
+     *               feedback clears what it drew, so their frame stays right
+     */
+    virtual void setSkipRing(bool skipRing, bool redraw = true) {
+        if (this->skipRing != skipRing) {
+            this->skipRing = skipRing;
+            if (redraw) {
+                frameDirty = true;  // The ring has to be drawn again (or left alone) - a baked loop always has it
+            }
+        }
+    }
+
+    /**
+     * Static effects draw exactly the same frame until one of their settings changes.
+     * The main loop only calls update() on a static effect after invalidate(), so an
+     * unchanged ambient frame costs no rendering and no LED output at all.
+     * @return True if this effect follows the static contract
+     */
+    virtual bool isStatic() const { return false; }
+
+    /**
+     * Check whether drawing this effect also draws another one
+     * Effects that run other effects (PartyCycleEffect) say yes for those, so
+     * nobody draws the same effect on two cores at once.
+     * @param effect Effect to look for
+     * @return True if it is this effect or one this effect draws
+     */
+    virtual bool containsEffect(const Effect* effect) const { return effect == this; }
+
+    /**
+     * Check whether a static effect has to draw its frame again
+     * @return True after invalidate(), until the main loop has drawn the frame
+     */
+    bool isFrameDirty() const { return frameDirty; }
+
+    /**
+     * Ask for the frame to be drawn again - static effects call this from every setter
+     * A baked effect records its loop again, so baked effects call it from their setters too
+     */
+    void invalidate() { frameDirty = true; loopStale = true; }
+
+    /**
+     * Called by the main loop once a static effect's frame is on the strips
+     */
+    void markFrameDrawn() { frameDirty = false; }
+
+    /**
+     * Restart this effect's random sequence from a fixed seed
+     * Two runs with the same seed (and the same frame timing) draw identical frames
+     * @param seed Seed for the effect's random number generator
+     */
+    void seedRandom(uint32_t seed) { rng.seed(seed); }
+
+    // Lowest detail level the main loop will ask for
+    static constexpr float MIN_QUALITY = 0.25f;
+
+    /**
+     * Set how much detail the effect draws - particle effects scale their
+     * trail, drop and ripple budgets with this. The main loop lowers it when
+     * frames take longer than the render budget and raises it again when
+     * there is headroom. Particles already running are left to finish.
+     * @param quality 1.0 = full detail, down to MIN_QUALITY
+     */
+    virtual void setQuality(float quality) { this->quality = constrain(quality, MIN_QUALITY, 1.0f); }
+
+    /**
+     * Get the current detail level
+     * @return Quality from MIN_QUALITY to 1.0
+     */
+    float getQuality() const { return quality; }
+
+    /**
+     * Let effects that draw their strips as separate jobs share them with core 0
+     * @param worker Worker to use for every effect (nullptr = draw all strips on one core)
+     */
+    static void setStripWorker(RenderWorker* worker) { stripWorker = worker; }
+
+    /**
+     * Check whether this effect draws its strips with renderStrips()
+     * @return True for effects that override renderStrip()
+     */
+    virtual bool hasStripJobs() const { return false; }
+
+    /**
+     * Length of one period of the animation - effects that can be baked override this
+     * Only for effects that draw the same frames every period: no random
+     * numbers and nothing that depends on the quality. Brightness is fine,
+     * it is applied when the strips are shown.
+     * @return Period in milliseconds (0 = not periodic, never baked)
+     */
+    virtual unsigned long loopPeriodMs() const { return 0; }
+
+    /**
+     * Time between the frames stored in a baked loop - playback blends between them
+     * @return Milliseconds per stored frame
+     */
+    virtual unsigned long loopFrameMs() const { return BAKE_FRAME_MS; }
+
+    /**
+     * Play the effect from a loop in PSRAM instead of drawing every frame
+     * The first period is recorded while it is shown, then it plays back at
+     * the cost of one blend per frame. invalidate() records it again.
+     * @param baked True to bake, false to draw live again
+     * @return True if the effect is baked now (needs loopPeriodMs(), free PSRAM
+     *         and room in BAKE_PSRAM_BUDGET)
+     */
+    bool setBaked(bool baked);
+
+    /**
+     * Check whether the effect plays from a baked loop
+     */
+    bool isBaked() const { return bakedLoop != nullptr; }
+
+    /**
+     * PSRAM a baked loop of this effect needs
+     * @return Bytes (0 = not periodic)
+     */
+    size_t bakedLoopBytes() const;
+
+    /**
+     * PSRAM held by the baked loops of every effect together
+     * setBaked() refuses a loop that would take this past BAKE_PSRAM_BUDGET
+     * @return Bytes
+     */
+    static size_t getBakedBytes() { return bakedBytes; }
+
+    /**
+     * Animation time the effect needs after reset() before it looks the way
+     * it does when it has been running for a while - effects whose particles
+     * or heat start out empty override this together with simulate()
+     * @return Milliseconds (0 = looks right from the first frame)
+     */
+    virtual unsigned long warmUpMs() const { return 0; }
+
+    /**
+     * Fast-forward the simulation without drawing anything
+     * Runs simulate() in steps of WARM_UP_STEP_MS, on a clock that ends at
+     * the current time, and stops early once WARM_UP_BUDGET_US of CPU time
+     * is used up. The next frame carries on from where it stopped.
+     * update() calls this once for an effect that is built but never reset;
+     * resets of effects that override warmUpMs() call it themselves.
+     * @param ms Animation time to skip (usually warmUpMs())
+     */
+    void warmUp(unsigned long ms);
+
+    /**
+     * Time the strip jobs on one core and on two, and print both
+     * Draws the same frame over and over into a scratch target
+     * @param frames Number of frames to time each way
      */
-    virtual void setSkipRing(bool skipRing) { this->skipRing = skipRing; }
+    void benchmarkStrips(int frames);
 
 protected:
+    // Strips an effect can draw as separate jobs (see renderStrips)
+    enum StripJob : uint8_t {
+        STRIP_JOB_CORE,
+        STRIP_JOB_INNER,
+        STRIP_JOB_OUTER,
+        STRIP_JOB_RING,
+        STRIP_JOB_COUNT
+    };
+
     bool skipRing = false;
-    LEDController& leds;        // Reference to LED controller for drawing
+    bool frameDirty = true;     // Static effects: frame must be drawn on the next update
+    LEDController& leds;        // LED controller (brightness, masks, strip layout)
+    RenderTarget* target = nullptr; // Where the current frame is drawn (set by update)
+    bool frameSkipped = false;  // Set when this call keeps the last frame instead of drawing
     unsigned long lastUpdateTime;  // Time of last update in milliseconds
+    FastRandom rng;             // This effect's own random numbers (use instead of random())
+    float quality = 1.0f;       // Detail level set by the main loop (see setQuality)
+
+    // Common time step, set by beginFrame()
+    float frameStep = 1.0f;      // Reference frames elapsed since the last frame (multiply per-frame speeds by this)
+    float frameSeconds = 0.0f;   // Seconds elapsed since the last frame
+    float tickCarry = 0.0f;      // Unused part of a simulation tick, see frameTicks()
+
+    // Longest gap still treated as animation time - anything longer (effect was
+    // not running, or just switched to) advances by a single reference frame
+    static const unsigned long MAX_FRAME_GAP_MS = 250;
+
+    /**
+     * Draw one frame into 'target' - must be implemented by child classes
+     * Called from update(); use beginFrame() for timing and frameStep for motion
+     */
+    virtual void render() = 0;
+
+    /**
+     * Call from reset() in effects that can be baked
+     * A reset while the loop is still being recorded would bake the jump
+     * into it, so the recording starts over from the reset state. A
+     * finished loop just keeps playing.
+     */
+    void resetBakedLoop();
+
+    /**
+     * Keep the last frame - update() then reports that nothing new was drawn
+     */
+    void skipFrame() { frameSkipped = true; }
+
+    /**
+     * Advance the simulation by one warm-up step without drawing - see warmUp()
+     * Start with setTimeStep(stepMs, ...) where render() would call beginFrame(),
+     * and use now() instead of millis() for anything the step times
+     * @param stepMs Length of the step (coarser than a frame)
+     */
+    virtual void simulate(unsigned long stepMs) {}
 
     /**
-     * Get time elapsed since last update in milliseconds
-     * Use this for frame rate independent animations
-     * @return Milliseconds elapsed since last update call
+     * Draw one strip of the current frame - override together with hasStripJobs()
+     * The strips may be drawn on both cores at the same time, so this must only
+     * write its own strip and only read state that render() set up before
+     * calling renderStrips() (no rng, no scratch buffers shared between strips)
+     * @param strip Which strip to draw
      */
-    unsigned long getDeltaTime() {
-        unsigned long currentTime = millis();
-        unsigned long deltaTime = currentTime - lastUpdateTime;
+    virtual void renderStrip(StripJob strip) {}
+
+    /**
+     * Draw all four strips with renderStrip(), on both cores when the strip
+     * worker is free - returns once every strip is drawn
+     */
+    void renderStrips();
+
+    /**
+     * Current animation time - use instead of millis() in effects that can be baked or warmed up
+     * While a baked loop is recorded or the effect warms up, this is the time
+     * of the frame being recorded or simulated
+     * @return Time in milliseconds
+     */
+    unsigned long now() const { return loopClockActive ? loopClock : millis(); }
+
+    /**
+     * Start a new frame and measure the common time step
+     * @param minIntervalMs Frame rate cap - no new frame until this many ms have passed
+     * @param referenceFrameMs Frame length the effect's per-frame speeds were tuned for
+     * @return True if a new frame should be drawn, false to keep the current one
+     */
+    bool beginFrame(unsigned long minIntervalMs, float referenceFrameMs) {
+        unsigned long currentTime = now();
+        unsigned long elapsed = currentTime - lastUpdateTime;
+        if (elapsed < minIntervalMs) {
+            skipFrame();
+            return false;
+        }
         lastUpdateTime = currentTime;
-        return deltaTime;
+
+        if (elapsed > MAX_FRAME_GAP_MS) {
+            elapsed = (unsigned long)referenceFrameMs;
+        }
+        setTimeStep(elapsed, referenceFrameMs);
+        return true;
     }
 
     /**
-     * Check if enough time has passed for next animation step
-     * @param intervalMs Minimum milliseconds between animation steps
-     * @return True if enough time has passed, false otherwise
+     * Set the common time step directly (beginFrame() does this for frames)
+     * @param elapsedMs Length of the step
+     * @param referenceFrameMs Frame length the effect's per-frame speeds were tuned for
      */
-    bool shouldUpdate(unsigned long intervalMs) {
-        unsigned long currentTime = millis();
-        if (currentTime - lastUpdateTime >= intervalMs) {
-            lastUpdateTime = currentTime;
-            return true;
-        }
-        return false;
+    void setTimeStep(unsigned long elapsedMs, float referenceFrameMs) {
+        frameSeconds = elapsedMs / 1000.0f;
+        frameStep = elapsedMs / referenceFrameMs;
+    }
+
+    /**
+     * Scale a particle budget by the current quality
+     * @param fullBudget Number of particles at full quality
+     * @return Number of particles allowed right now (always at least 1)
+     */
+    int qualityBudget(int fullBudget) const {
+        return max(1, (int)(fullBudget * quality + 0.5f));
+    }
+
+    /**
+     * Split this frame's time into whole ticks of a fixed-rate simulation
+     * For simulations that have to move in fixed steps (like the fire heat),
+     * a longer frame runs more ticks instead of bigger ones
+     * @param tickMs Length of one simulation tick in milliseconds
+     * @return Number of ticks to run this frame (the leftover time carries over to the next frame)
+     */
+    int frameTicks(float tickMs) {
+        tickCarry += frameSeconds * 1000.0f / tickMs;
+        int ticks = (int)tickCarry;
+        tickCarry -= ticks;
+        return ticks;
+    }
+
+    /**
+     * Roll for an event that used to have a fixed chance every frame
+     * The chance is scaled by the time step, so events happen equally often at any frame rate
+     * @param chancePerFrame Chance (0.0-1.0) per reference frame
+     * @return True if the event happens this frame
+     */
+    bool frameChance(float chancePerFrame) {
+        return rng.unit() < chancePerFrame * frameStep;
+    }
+
+    /**
+     * Convert a per-frame keep factor (for example a trail fade) to this frame's time step
+     * @param keepPerFrame Fraction (0.0-1.0) that survives one reference frame
+     * @return Fraction that survives this frame
+     */
+    float frameDecay(float keepPerFrame) const {
+        return powf(keepPerFrame, frameStep);
+    }
+
+private:
+    // Baked loop (see setBaked)
+    BakedLoop* bakedLoop = nullptr;     // Recorded period in PSRAM (nullptr = draw live)
+    OffscreenTarget* loopFrame = nullptr; // Where frames are drawn before they are stored
+    bool loopStale = false;             // invalidate() was called - record the loop again
+    unsigned long loopStartTime = 0;    // When the loop recording started (millis)
+    unsigned long lastPlayTime = 0;     // Last playBakedLoop() call - a long gap means recording was interrupted
+    bool loopClockActive = false;       // True while a loop frame is recorded or a warm-up runs (see now())
+    unsigned long loopClock = 0;        // Time of the loop frame being recorded or the step being simulated
+    bool warmedUp = false;              // warmUp() has run since the effect was built
+    static size_t bakedBytes;           // PSRAM held by all baked loops (see getBakedBytes)
+
+    /**
+     * Free the baked loop and its scratch frame
+     */
+    void dropBakedLoop();
+
+    /**
+     * update() for a baked effect - records what is missing, then draws the loop
+     */
+    void playBakedLoop();
+
+    static RenderWorker* stripWorker;   // Shared by all effects (see setStripWorker)
+    std::atomic<uint8_t> nextStripJob{0}; // Next strip to take - both cores pull from it
+
+    /**
+     * Take strips until none are left - runs on both cores at once
+     */
+    void runStripJobs();
+
+    /**
+     * RenderWorker entry point for runStripJobs()
+     * @param effect The effect
+     * @return Always true
+     */
+    static bool stripJobRunner(void* effect);
+
+    /**
+     * Give every new effect a different (but repeatable) starting seed
+     * SmartLantern reseeds all effects in begin() - see EFFECT_RANDOM_SEED
+     */
+    static uint32_t nextDefaultSeed() {
+        static uint32_t effectsCreated = 0;
+        return ++effectsCreated;
     }
 };
 
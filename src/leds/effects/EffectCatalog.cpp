@@ -0,0 +1,283 @@
+// src/leds/effects/EffectCatalog.cpp
+#include "EffectCatalog.h"
+#include "../../LanternMode.h"
+
+#include "RainbowEffect.h"
+#include "FireEffect.h"
+#include "MatrixEffect.h"
+#include "GradientEffect.h"
+#include "WaterfallEffect.h"
+#include "CodeRedEffect.h"
+#include "RegalEffect.h"
+#include "RainbowTranceEffect.h"
+#include "PartyFireEffect.h"
+#include "TemperatureColorEffect.h"
+#include "CandleFlickerEffect.h"
+#include "AuraEffect.h"
+#include "FutureEffect.h"
+#include "FutureRainbowEffect.h"
+#include "RgbPatternEffect.h"
+#include "EmeraldCityEffect.h"
+#include "SuspendedFireEffect.h"
+#include "SuspendedPartyFireEffect.h"
+#include "LustEffect.h"
+#include "DarkEnergyEffect.h"
+#include "FlashAnimationEffect.h"
+
+// Factories - each builds one catalog entry with its default parameters
+
+static Effect* createIncandescent(LEDController& leds) {
+    return new TemperatureColorEffect(
+        leds,
+        2700,   // Warm incandescent
+        false,  // Core off
+        true,   // Inner on
+        true,   // Outer on (with fade)
+        false   // Ring off
+    );
+}
+
+static Effect* createDaylight(LEDController& leds) {
+    return new TemperatureColorEffect(
+        leds,
+        5500,   // Natural daylight
+        false,  // Core off
+        true,   // Inner on
+        true,   // Outer on (with fade)
+        false   // Ring off
+    );
+}
+
+static Effect* createCandle(LEDController& leds) {
+    return new CandleFlickerEffect(leds);
+}
+
+// Sunset gradient on inner and outer
+static Effect* createSunsetGradient(LEDController& leds) {
+    return new GradientEffect(
+        leds,
+        Gradient(),
+        GradientEffect::createSunsetGradient(),
+        GradientEffect::reverseGradient(GradientEffect::createSunsetGradient()),
+        Gradient()
+    );
+}
+
+// Purple-Blue opposing gradients (inner purple→blue, outer blue→purple, others off)
+static Effect* createPurpleBlueGradient(LEDController& leds) {
+    return new GradientEffect(
+        leds,
+        Gradient(), // Core off
+        GradientEffect::createPurpleToBlueGradient(),
+        GradientEffect::createBlueToPurpleGradient(),
+        Gradient() // Ring off
+    );
+}
+
+static Effect* createSplitRainbowGradient(LEDController& leds) {
+    return new GradientEffect(
+        leds,
+        Gradient(),                                      // Core off
+        GradientEffect::createFirstHalfRainbowGradient(), // Inner: Red to Cyan
+        GradientEffect::createSecondHalfRainbowGradient(), // Outer: Cyan to Red
+        Gradient()                                       // Ring off
+    );
+}
+
+static Effect* createChristmasGradient(LEDController& leds) {
+    return new GradientEffect(
+        leds,
+        GradientEffect::createCoreChristmasGradient(),
+        GradientEffect::reverseGradient(GradientEffect::createOuterChristmasGradient()),
+        GradientEffect::createOuterChristmasGradient(),
+        Gradient()
+    );
+}
+
+// Rainbow but flipped directions for inner and outer
+static Effect* createOpposingRainbowGradient(LEDController& leds) {
+    Gradient rainbowGradient = GradientEffect::createRainbowGradient();
+    return new GradientEffect(
+        leds,
+        Gradient(),
+        rainbowGradient,
+        GradientEffect::reverseGradient(rainbowGradient),
+        Gradient() // Ring off
+    );
+}
+
+static Effect* createBavariaGradient(LEDController& leds) {
+    return new GradientEffect(
+        leds,
+        Gradient(),
+        GradientEffect::createBlueToWhiteGradient(),
+        GradientEffect::reverseGradient(GradientEffect::createBlueToWhiteGradient()),
+        Gradient()
+    );
+}
+
+static Effect* createDarkEnergy(LEDController& leds) {
+    return new DarkEnergyEffect(leds);
+}
+
+static Effect* createSuspendedFire(LEDController& leds) {
+    return new SuspendedFireEffect(leds);
+}
+
+static Effect* createWaterfall(LEDController& leds) {
+    return new WaterfallEffect(leds);
+}
+
+// Rainbow with core and ring disabled (for animated mode)
+static Effect* createRainbowNoCore(LEDController& leds) {
+    return new RainbowEffect(
+        leds,
+        false,  // core disabled
+        true,   // inner enabled
+        true,   // outer enabled
+        false   // ring disabled
+    );
+}
+
+static Effect* createAura(LEDController& leds) {
+    return new AuraEffect(
+        leds,
+        false,   // Core off
+        true,    // Inner on
+        true,    // Outer on
+        false    // Ring off
+    );
+}
+
+// Long-trail party effects use decay buffers so trail cost scales with heads, not length
+static Effect* createCoreGrow(LEDController& leds) {
+    CodeRedEffect* effect = new CodeRedEffect(leds);
+    effect->setPersistentTrails(true);
+    return effect;
+}
+
+static Effect* createRainbowTrance(LEDController& leds) {
+    RainbowTranceEffect* effect = new RainbowTranceEffect(leds);
+    effect->setPersistentTrails(true);
+    return effect;
+}
+
+static Effect* createLust(LEDController& leds) {
+    return new LustEffect(leds);
+}
+
+static Effect* createEmeraldCity(LEDController& leds) {
+    return new EmeraldCityEffect(leds);
+}
+
+static Effect* createRgbPattern(LEDController& leds) {
+    return new RgbPatternEffect(leds);
+}
+
+static Effect* createFuture(LEDController& leds) {
+    return new FutureEffect(leds);
+}
+
+// All strips enabled (for party mode)
+static Effect* createRainbow(LEDController& leds) {
+    return new RainbowEffect(leds);
+}
+
+static Effect* createTechnoOrange(LEDController& leds) {
+    return new RegalEffect(leds);
+}
+
+static Effect* createFutureRainbow(LEDController& leds) {
+    return new FutureRainbowEffect(leds);
+}
+
+static Effect* createMatrix(LEDController& leds) {
+    return new MatrixEffect(leds);
+}
+
+static Effect* createSuspendedPartyFire(LEDController& leds) {
+    return new SuspendedPartyFireEffect(leds);
+}
+
+static Effect* createFire(LEDController& leds) {
+    return new FireEffect(leds);
+}
+
+static Effect* createPartyFire(LEDController& leds) {
+    return new PartyFireEffect(leds);
+}
+
+static Effect* createFlashAnimation(LEDController& leds) {
+    return new FlashAnimationEffect(leds);
+}
+
+// The catalog - each mode shows its effects in this order
+static const EffectDescriptor ENTRIES[] = {
+    // name                       mode           strips                                     static  flags                   color     factory
+
+    // MODE_AMBIENT
+    {"Incandescent",               MODE_AMBIENT,  STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0xFFA54F, createIncandescent},
+    {"Daylight",                   MODE_AMBIENT,  STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0xFFF4E5, createDaylight},
+    {"Candle Flicker",             MODE_AMBIENT,  STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0xFF8C1A, createCandle},
+
+    // MODE_GRADIENT
+    {"Sunset Gradient",            MODE_GRADIENT, STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0xFF5E3A, createSunsetGradient},
+    {"Purple Blue Gradient",       MODE_GRADIENT, STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0x6A0DAD, createPurpleBlueGradient},
+    {"Split Rainbow Gradient",     MODE_GRADIENT, STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0x00FFFF, createSplitRainbowGradient},
+    {"Christmas Gradient",         MODE_GRADIENT, STRIPS_CORE | STRIPS_INNER | STRIPS_OUTER, true,   0,                      0xFF0000, createChristmasGradient},
+
+    // MODE_ANIMATED
+    {"Dark Energy",                MODE_ANIMATED, STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0x4B0082, createDarkEnergy},
+    {"Suspended Fire",             MODE_ANIMATED, STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0xFF4500, createSuspendedFire},
+    {"Waterfall",                  MODE_ANIMATED, STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0x1E90FF, createWaterfall},
+    {"Rainbow (No Core)",          MODE_ANIMATED, STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0xFFFF00, createRainbowNoCore},
+    {"Aura",                       MODE_ANIMATED, STRIPS_INNER | STRIPS_OUTER,               false,  0,                      0x7FFFD4, createAura},
+    {"Flash Animation",            MODE_ANIMATED, STRIPS_ALL,                                false,  EFFECT_NEEDS_ANIMATION, 0xFFFFFF, createFlashAnimation},
+
+    // MODE_PARTY - the cycle first, then the effects it runs through in cycle order
+    {"Party Cycle",                MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_PARTY_CYCLE,     0xFFFFFF, nullptr},
+    {"Core Grow",                  MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xDC143C, createCoreGrow},
+    {"Lust",                       MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xFF1493, createLust},
+    {"Emerald City",               MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0x00FF7F, createEmeraldCity},
+    {"Rainbow Trance",             MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0x8A2BE2, createRainbowTrance},
+    {"RGB Pattern",                MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0x800080, createRgbPattern},
+    {"Future",                     MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0x00BFFF, createFuture},
+    {"Rainbow",                    MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xFFFF00, createRainbow},
+    {"Techno Orange",              MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xFF8C00, createTechnoOrange},
+    {"Future Rainbow",             MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xFF00FF, createFutureRainbow},
+    {"Matrix",                     MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0x00FF00, createMatrix},
+    {"Suspended Party Fire",       MODE_PARTY,    STRIPS_ALL,                                false,  EFFECT_IN_PARTY_CYCLE,  0xFF4500, createSuspendedPartyFire},
+
+    // Not in any mode
+    {"Fire",                       MODE_OFF,      STRIPS_INNER | STRIPS_OUTER,               false,  EFFECT_FIRE_OVERRIDE,   0xFF2200, createFire},
+    {"Opposing Rainbow Gradient",  MODE_OFF,      STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0xFF00FF, createOpposingRainbowGradient},
+    {"Bavaria Gradient",           MODE_OFF,      STRIPS_INNER | STRIPS_OUTER,               true,   0,                      0x0066CC, createBavariaGradient},
+    {"Party Fire",                 MODE_OFF,      STRIPS_ALL,                                false,  0,                      0xFF0000, createPartyFire},
+};
+
+static const int ENTRY_COUNT = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+int EffectCatalog::count() {
+    return ENTRY_COUNT;
+}
+
+const EffectDescriptor& EffectCatalog::get(int index) {
+    return ENTRIES[index];
+}
+
+int EffectCatalog::countWith(uint8_t flag) {
+    int matches = 0;
+    for (int i = 0; i < ENTRY_COUNT; i++) {
+        if (ENTRIES[i].flags & flag) matches++;
+    }
+    return matches;
+}
+
+int EffectCatalog::findWith(uint8_t flag, int nth) {
+    for (int i = 0; i < ENTRY_COUNT; i++) {
+        if ((ENTRIES[i].flags & flag) && nth-- == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
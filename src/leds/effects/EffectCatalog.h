@@ -0,0 +1,82 @@
+// src/leds/effects/EffectCatalog.h
+#ifndef EFFECT_CATALOG_H
+#define EFFECT_CATALOG_H
+
+#include <Arduino.h>
+#include "Effect.h"
+
+// Special roles (EffectDescriptor::flags)
+enum EffectFlags : uint8_t {
+    EFFECT_PARTY_CYCLE    = 0x01,  // The party cycle itself (built by SmartLantern)
+    EFFECT_IN_PARTY_CYCLE = 0x02,  // One of the effects the party cycle runs through
+    EFFECT_FIRE_OVERRIDE  = 0x04,  // Shown instead of everything when it gets cold
+    EFFECT_NEEDS_ANIMATION = 0x08  // Only listed in its mode while ANIMATION_PARTITION holds an animation
+};
+
+// Strips an effect lights (EffectDescriptor::strips) - it keeps the others black
+enum EffectStrips : uint8_t {
+    STRIPS_CORE  = 0x01,
+    STRIPS_INNER = 0x02,
+    STRIPS_OUTER = 0x04,
+    STRIPS_RING  = 0x08,
+    STRIPS_ALL   = 0x0F
+};
+
+/**
+ * Everything known about one effect without building it
+ * The strings are literals and the table lives in flash, so looking an
+ * effect up never allocates. SmartLantern plans with strips and isStatic
+ * before the effect exists, so both have to match what the effect draws
+ * with its default parameters (the create hook warns when isStatic doesn't).
+ */
+struct EffectDescriptor {
+    const char* name;        // Name for logs and reports
+    uint8_t mode;            // LanternMode it is listed under (MODE_OFF = not in any mode)
+    uint8_t strips;          // EffectStrips it lights
+    bool isStatic;           // Draws the same frame until a setting changes (see Effect::isStatic)
+    uint8_t flags;           // EffectFlags
+    uint32_t color;          // Representative color (0xRRGGBB) for the ring displays
+
+    // Builds the effect with its default parameters (nullptr = SmartLantern builds it)
+    Effect* (*create)(LEDController& leds);
+};
+
+/**
+ * EffectCatalog - The static list of every effect in the lantern
+ *
+ * Each mode lists its effects in catalog order, so adding an effect to a
+ * mode is one new line in the table in EffectCatalog.cpp. SmartLantern
+ * registers every entry with the EffectRegistry, which builds it the
+ * first time it is selected.
+ */
+class EffectCatalog {
+public:
+    /**
+     * Number of effects in the catalog
+     */
+    static int count();
+
+    /**
+     * Get one entry
+     * @param index 0 to count() - 1
+     * @return The entry
+     */
+    static const EffectDescriptor& get(int index);
+
+    /**
+     * Count the entries that have a flag
+     * @param flag EffectFlags value to look for
+     * @return Number of entries with that flag
+     */
+    static int countWith(uint8_t flag);
+
+    /**
+     * Find an entry by flag
+     * @param flag EffectFlags value to look for
+     * @param nth Which match to return (0 = first)
+     * @return Catalog index, or -1 if there are not that many matches
+     */
+    static int findWith(uint8_t flag, int nth = 0);
+};
+
+#endif // EFFECT_CATALOG_H
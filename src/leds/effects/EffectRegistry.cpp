@@ -0,0 +1,138 @@
+// src/leds/effects/EffectRegistry.cpp
+#include "EffectRegistry.h"
+#include <esp_heap_caps.h>
+
+// Internal RAM and PSRAM are measured apart - ESP.getFreeHeap() only sees
+// internal RAM, and with PSRAM enabled large allocations may go there
+static const uint32_t INTERNAL_CAPS = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+static const uint32_t PSRAM_CAPS = MALLOC_CAP_SPIRAM;
+
+EffectRegistry::~EffectRegistry() {
+    for (auto& slot : slots) {
+        delete slot.effect;
+    }
+}
+
+int EffectRegistry::add(Factory factory, const EffectDescriptor* descriptor) {
+    slots.push_back({factory, descriptor, nullptr, 0, 0, 0});
+    return slots.size() - 1;
+}
+
+Effect* EffectRegistry::get(int id) {
+    if (id < 0 || id >= (int)slots.size()) {
+        return nullptr;
+    }
+
+    Slot& slot = slots[id];
+    if (slot.effect == nullptr) {
+        // Build it now and remember what that cost
+        uint32_t freeBefore = heap_caps_get_free_size(INTERNAL_CAPS);
+        uint32_t psramBefore = heap_caps_get_free_size(PSRAM_CAPS);
+        unsigned long start = micros();
+
+        slot.effect = slot.factory();
+
+        slot.buildMicros = micros() - start;
+        uint32_t freeAfter = heap_caps_get_free_size(INTERNAL_CAPS);
+        uint32_t psramAfter = heap_caps_get_free_size(PSRAM_CAPS);
+        slot.heapBytes = (freeBefore > freeAfter) ? freeBefore - freeAfter : 0;
+        slot.psramBytes = (psramBefore > psramAfter) ? psramBefore - psramAfter : 0;
+
+        if (createHook) {
+            createHook(slot.effect, id);
+        }
+
+        Serial.print("Built ");
+        Serial.print(slot.descriptor != nullptr ? slot.descriptor->name : slot.effect->getName());
+        Serial.print(" (");
+        Serial.print(slot.heapBytes);
+        Serial.print(" bytes RAM, ");
+        Serial.print(slot.psramBytes);
+        Serial.print(" bytes PSRAM, ");
+        Serial.print(slot.buildMicros);
+        Serial.println("us)");
+    }
+    return slot.effect;
+}
+
+Effect* EffectRegistry::peek(int id) const {
+    if (id < 0 || id >= (int)slots.size()) {
+        return nullptr;
+    }
+    return slots[id].effect;
+}
+
+const EffectDescriptor* EffectRegistry::describe(int id) const {
+    if (id < 0 || id >= (int)slots.size()) {
+        return nullptr;
+    }
+    return slots[id].descriptor;
+}
+
+const EffectDescriptor* EffectRegistry::describe(const Effect* effect) const {
+    if (effect == nullptr) {
+        return nullptr;
+    }
+    for (const auto& slot : slots) {
+        if (slot.effect == effect) {
+            return slot.descriptor;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t EffectRegistry::releaseUnused(InUseCheck inUse) {
+    uint32_t freed = 0;
+    uint32_t freedPsram = 0;
+    int released = 0;
+
+    for (auto& slot : slots) {
+        if (slot.effect == nullptr || inUse(slot.effect)) {
+            continue;
+        }
+
+        delete slot.effect;
+        slot.effect = nullptr;
+        freed += slot.heapBytes;
+        freedPsram += slot.psramBytes;
+        released++;
+    }
+
+    if (released > 0) {
+        Serial.println("Released " + String(released) + " idle effects (" + String(freed) + " bytes RAM, " +
+                       String(freedPsram) + " bytes PSRAM)");
+    }
+    return freed;
+}
+
+int EffectRegistry::builtCount() const {
+    int count = 0;
+    for (const auto& slot : slots) {
+        if (slot.effect != nullptr) count++;
+    }
+    return count;
+}
+
+uint32_t EffectRegistry::builtBytes() const {
+    uint32_t bytes = 0;
+    for (const auto& slot : slots) {
+        if (slot.effect != nullptr) bytes += slot.heapBytes;
+    }
+    return bytes;
+}
+
+uint32_t EffectRegistry::builtPsramBytes() const {
+    uint32_t bytes = 0;
+    for (const auto& slot : slots) {
+        if (slot.effect != nullptr) bytes += slot.psramBytes;
+    }
+    return bytes;
+}
+
+unsigned long EffectRegistry::builtMicros() const {
+    unsigned long total = 0;
+    for (const auto& slot : slots) {
+        if (slot.effect != nullptr) total += slot.buildMicros;
+    }
+    return total;
+}
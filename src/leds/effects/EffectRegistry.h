@@ -0,0 +1,131 @@
+// src/leds/effects/EffectRegistry.h
+#ifndef EFFECT_REGISTRY_H
+#define EFFECT_REGISTRY_H
+
+#include <Arduino.h>
+#include <vector>
+#include <functional>
+#include "Effect.h"
+#include "EffectCatalog.h"
+
+/**
+ * EffectRegistry - Builds effects the first time they are needed
+ *
+ * Instead of creating every effect at boot, SmartLantern registers a
+ * factory for each one and keeps the returned id. get() builds the effect
+ * on first use. Effects that are not running can be deleted again with
+ * releaseUnused() when memory gets low - the next get() simply builds a
+ * fresh one.
+ *
+ * Never keep an Effect* from get() across frames unless you can tell
+ * releaseUnused() that it is still in use. Keep the id and call get()
+ * again instead - it is just a vector lookup once the effect exists.
+ *
+ * The heap used and time taken by each build are measured, so the saving
+ * over building everything at boot can be reported.
+ */
+class EffectRegistry {
+public:
+    // Creates one effect
+    typedef std::function<Effect*()> Factory;
+
+    // Called right after an effect is built (seeding, ring and quality settings)
+    typedef std::function<void(Effect* effect, int id)> CreateHook;
+
+    // Tells releaseUnused() which effects must stay
+    typedef std::function<bool(const Effect* effect)> InUseCheck;
+
+    /**
+     * Destructor - deletes every built effect
+     */
+    ~EffectRegistry();
+
+    /**
+     * Register an effect without building it
+     * @param factory Function that creates the effect
+     * @param descriptor Catalog entry describing it (nullptr = none)
+     * @return Id to pass to get()
+     */
+    int add(Factory factory, const EffectDescriptor* descriptor = nullptr);
+
+    /**
+     * Get an effect, building it first if needed
+     * @param id Id returned by add()
+     * @return The effect (nullptr for an unknown id)
+     */
+    Effect* get(int id);
+
+    /**
+     * Get an effect only if it is already built
+     * @param id Id returned by add()
+     * @return The effect, or nullptr if it has not been built
+     */
+    Effect* peek(int id) const;
+
+    /**
+     * Get the catalog entry of an effect without building it
+     * @param id Id returned by add()
+     * @return The entry, or nullptr for an unknown id or an effect added without one
+     */
+    const EffectDescriptor* describe(int id) const;
+
+    /**
+     * Get the catalog entry of a built effect
+     * @param effect Effect returned by get()
+     * @return The entry, or nullptr if the effect is not from this registry or has none
+     */
+    const EffectDescriptor* describe(const Effect* effect) const;
+
+    /**
+     * Set the function called after every build
+     * @param hook Function to call (receives the new effect and its id)
+     */
+    void setCreateHook(CreateHook hook) { createHook = hook; }
+
+    /**
+     * Delete every built effect that is not in use
+     * @param inUse Returns true for effects that must stay
+     * @return Internal RAM freed, as measured when the effects were built (bytes)
+     */
+    uint32_t releaseUnused(InUseCheck inUse);
+
+    /**
+     * Number of registered effects
+     */
+    int size() const { return slots.size(); }
+
+    /**
+     * Number of effects built right now
+     */
+    int builtCount() const;
+
+    /**
+     * Internal RAM used by the effects built right now (bytes, measured at build time)
+     */
+    uint32_t builtBytes() const;
+
+    /**
+     * PSRAM used by the effects built right now (bytes, measured at build time)
+     */
+    uint32_t builtPsramBytes() const;
+
+    /**
+     * Time spent building the effects built right now (microseconds)
+     */
+    unsigned long builtMicros() const;
+
+private:
+    struct Slot {
+        Factory factory;                    // Creates the effect
+        const EffectDescriptor* descriptor; // Catalog entry (nullptr = none)
+        Effect* effect;                     // The effect, or nullptr when not built
+        uint32_t heapBytes;                 // Internal RAM the last build used
+        uint32_t psramBytes;                // PSRAM the last build used (large buffers can land there)
+        unsigned long buildMicros;          // Time the last build took
+    };
+
+    std::vector<Slot> slots;
+    CreateHook createHook;
+};
+
+#endif // EFFECT_REGISTRY_H
@@ -4,8 +4,7 @@
 
 EmeraldCityEffect::EmeraldCityEffect(LEDController& ledController) :
     Effect(ledController),
-    lastSparkleUpdate(0),
-    lastUpdateTime(0),
+    sparkles(MAX_SPARKLES),
     coreWavePosition(0.0f)  // Initialize wave position
 {
     // Initialize green color palette with various shades of green
@@ -29,49 +28,23 @@ EmeraldCityEffect::EmeraldCityEffect(LEDController& ledController) :
         }
     }
 
-    // Allocate memory for sparkle arrays
-    innerSparkleValues = new float[LED_STRIP_INNER_COUNT];
-    outerSparkleValues = new float[LED_STRIP_OUTER_COUNT];
-    ringSparkleValues = new float[LED_STRIP_RING_COUNT];
-
-    // Allocate memory for sparkle color arrays
-    innerSparkleColors = new uint8_t[LED_STRIP_INNER_COUNT];
-    outerSparkleColors = new uint8_t[LED_STRIP_OUTER_COUNT];
-    ringSparkleColors = new uint8_t[LED_STRIP_RING_COUNT];
-
-    // Allocate memory for sparkle brightness arrays
-    innerSparkleBrightness = new float[LED_STRIP_INNER_COUNT];
-    outerSparkleBrightness = new float[LED_STRIP_OUTER_COUNT];
-    ringSparkleBrightness = new float[LED_STRIP_RING_COUNT];
-
-    // Allocate memory for sparkle speed arrays
-    innerSparkleSpeed = new float[LED_STRIP_INNER_COUNT];
-    outerSparkleSpeed = new float[LED_STRIP_OUTER_COUNT];
-    ringSparkleSpeed = new float[LED_STRIP_RING_COUNT];
-
-    // Initialize all sparkle values to 0.0 (no sparkle initially)
-    for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        innerSparkleValues[i] = 0.0f;
-        innerSparkleColors[i] = random(2);  // Random color (0=white, 1=light green)
-        innerSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // Random brightness 20% to 100%
-        // Random speed: 50% to 200% of base speed
-        innerSparkleSpeed[i] = BASE_SPARKLE_SPEED * (MIN_SPEED_MULTIPLIER + (random(150) / 100.0f));
-    }
-    for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        outerSparkleValues[i] = 0.0f;
-        outerSparkleColors[i] = random(2);  // Random color
-        outerSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // Random brightness 20% to 100%
-        // Random speed: 50% to 200% of base speed
-        outerSparkleSpeed[i] = BASE_SPARKLE_SPEED * (MIN_SPEED_MULTIPLIER + (random(150) / 100.0f));
-    }
-    for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        ringSparkleValues[i] = 0.0f;
-        // Ring sparkles: 75% green, 25% white
-        ringSparkleColors[i] = (random(100) < 75) ? 1 : 0;  // 75% chance for green (1), 25% for white (0)
-        ringSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // Random brightness 20% to 100%
-        // Ring sparkles are slower (twice as long): 25% to 100% of base speed
-        ringSparkleSpeed[i] = BASE_SPARKLE_SPEED * RING_SPEED_MULTIPLIER * (MIN_SPEED_MULTIPLIER + (random(100) / 100.0f));
-    }
+    // Sparkle layers: inner/outer are half white, half light green,
+    // the ring is 75% light green and sparkles about twice as long
+    const CRGB white(255, 255, 255);
+    const CRGB lightGreen(77, 255, 128);
+
+    innerSparkleLayer = sparkles.addLayer(LED_STRIP_INNER_COUNT, INNER_OUTER_SPARKLE_RATE,
+                                          BASE_SPARKLE_SPEED * MIN_SPEED_MULTIPLIER,
+                                          BASE_SPARKLE_SPEED * MAX_SPEED_MULTIPLIER,
+                                          white, lightGreen, 50);
+    outerSparkleLayer = sparkles.addLayer(LED_STRIP_OUTER_COUNT, INNER_OUTER_SPARKLE_RATE,
+                                          BASE_SPARKLE_SPEED * MIN_SPEED_MULTIPLIER,
+                                          BASE_SPARKLE_SPEED * MAX_SPEED_MULTIPLIER,
+                                          white, lightGreen, 50);
+    ringSparkleLayer = sparkles.addLayer(LED_STRIP_RING_COUNT, RING_SPARKLE_RATE,
+                                         BASE_SPARKLE_SPEED * RING_SPEED_MULTIPLIER * MIN_SPEED_MULTIPLIER,
+                                         BASE_SPARKLE_SPEED * RING_SPEED_MULTIPLIER * (MIN_SPEED_MULTIPLIER + 1.0f),
+                                         white, lightGreen, 75);
 
     Serial.println("EmeraldCityEffect created - green trails with white sparkles");
 
@@ -79,22 +52,6 @@ EmeraldCityEffect::EmeraldCityEffect(LEDController& ledController) :
     initializeStartupTrails();
 }
 
-EmeraldCityEffect::~EmeraldCityEffect() {
-    // Clean up allocated memory
-    delete[] innerSparkleValues;
-    delete[] outerSparkleValues;
-    delete[] ringSparkleValues;
-    delete[] innerSparkleColors;
-    delete[] outerSparkleColors;
-    delete[] ringSparkleColors;
-    delete[] innerSparkleBrightness;
-    delete[] outerSparkleBrightness;
-    delete[] ringSparkleBrightness;
-    delete[] innerSparkleSpeed;
-    delete[] outerSparkleSpeed;
-    delete[] ringSparkleSpeed;
-}
-
 void EmeraldCityEffect::initializeGreenPalette() {
     // Create a palette focused on blue-green tones (even more blue-dominant)
     // FastLED uses 0-255 for hue, pushing further toward blue-green/cyan spectrum
@@ -113,7 +70,7 @@ void EmeraldCityEffect::initializeStartupTrails() {
     // Initialize trails for inner strips
     for (int stripIndex = 0; stripIndex < NUM_INNER_STRIPS; stripIndex++) {
         // Create 3-5 trails per strip at startup
-        int numStartupTrails = 3 + random(3);  // 3 to 5 trails
+        int numStartupTrails = 3 + rng.range(3);  // 3 to 5 trails
 
         for (int trailIndex = 0; trailIndex < numStartupTrails && trailIndex < MAX_TRAILS_PER_STRIP; trailIndex++) {
             EmeraldTrail& trail = innerTrails[stripIndex][trailIndex];
@@ -123,19 +80,19 @@ void EmeraldCityEffect::initializeStartupTrails() {
 
             // Random position throughout the strip height
             int stripLength = getStripLength(1);
-            trail.position = random(stripLength * 0.2f, stripLength * 0.8f);  // 20% to 80% up the strip
+            trail.position = rng.range(stripLength * 0.2f, stripLength * 0.8f);  // 20% to 80% up the strip
 
             // Random speed within normal range
-            trail.speed = MIN_TRAIL_SPEED + (random(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
+            trail.speed = MIN_TRAIL_SPEED + (rng.range(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
             trail.greenHue = getRandomGreenHue();
-            trail.brightness = TRAIL_BRIGHTNESS + random(75);  // Add brightness variation
+            trail.brightness = TRAIL_BRIGHTNESS + rng.range(75);  // Add brightness variation
         }
     }
 
     // Initialize trails for outer strips
     for (int stripIndex = 0; stripIndex < NUM_OUTER_STRIPS; stripIndex++) {
         // Create 2-4 trails per strip at startup (slightly fewer than inner)
-        int numStartupTrails = 2 + random(3);  // 2 to 4 trails
+        int numStartupTrails = 2 + rng.range(3);  // 2 to 4 trails
 
         for (int trailIndex = 0; trailIndex < numStartupTrails && trailIndex < MAX_TRAILS_PER_STRIP; trailIndex++) {
             EmeraldTrail& trail = outerTrails[stripIndex][trailIndex];
@@ -145,12 +102,12 @@ void EmeraldCityEffect::initializeStartupTrails() {
 
             // Random position throughout the strip height
             int stripLength = getStripLength(2);
-            trail.position = random(stripLength * 0.2f, stripLength * 0.8f);  // 20% to 80% up the strip
+            trail.position = rng.range(stripLength * 0.2f, stripLength * 0.8f);  // 20% to 80% up the strip
 
             // Random speed within normal range
-            trail.speed = MIN_TRAIL_SPEED + (random(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
+            trail.speed = MIN_TRAIL_SPEED + (rng.range(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
             trail.greenHue = getRandomGreenHue();
-            trail.brightness = TRAIL_BRIGHTNESS + random(75);  // Add brightness variation
+            trail.brightness = TRAIL_BRIGHTNESS + rng.range(75);  // Add brightness variation
         }
     }
 }
@@ -169,16 +126,8 @@ void EmeraldCityEffect::reset() {
         }
     }
 
-    // Reset sparkle values
-    for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        innerSparkleValues[i] = 0.0f;
-    }
-    for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        outerSparkleValues[i] = 0.0f;
-    }
-    for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        ringSparkleValues[i] = 0.0f;
-    }
+    // Turn off all sparkles
+    sparkles.clear();
 
     // Reset wave position
     coreWavePosition = 0.0f;
@@ -186,14 +135,14 @@ void EmeraldCityEffect::reset() {
     Serial.println("EmeraldCityEffect reset");
 }
 
-void EmeraldCityEffect::update() {
+void EmeraldCityEffect::render() {
     // Target smooth frame rate (~60 FPS)
-    if (!shouldUpdate(16)) {  // 16ms = ~62 FPS
+    if (!beginFrame(16, REFERENCE_FRAME_MS)) {  // 16ms = ~62 FPS
         return;
     }
 
     // Clear all strips before drawing
-    leds.clearAll();
+    target->clearAll();
 
     // Update and draw green trails on inner and outer strips
     updateInnerTrails();
@@ -213,9 +162,6 @@ void EmeraldCityEffect::update() {
 
     // Apply moving black fade to inner strips that follows the core wave
     applyInnerWaveFade();
-
-    // Show all LED updates
-    leds.showAll();
 }
 
 void EmeraldCityEffect::applyRingGreenOverlay() {
@@ -248,7 +194,7 @@ void EmeraldCityEffect::applyRingGreenOverlay() {
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
         // Set the base green glow color
         // Sparkles will be added on top of this in updateSparkles()
-        leds.getRing()[i] = glowColor;
+        target->getRing()[i] = glowColor;
     }
 }
 
@@ -297,7 +243,7 @@ void EmeraldCityEffect::applyInnerWaveFade() {
 
             // Apply the fade (darken the existing color)
             int ledIndex = stripStartIndex + i;
-            leds.getInner()[ledIndex].nscale8_video((uint8_t)(255 * (1.0f - fadeIntensity)));
+            target->getInner()[ledIndex].nscale8_video((uint8_t)(255 * (1.0f - fadeIntensity)));
         }
     }
 }
@@ -321,7 +267,7 @@ void EmeraldCityEffect::updateStripTrails(int stripType, int subStrip) {
     }
 
     // Random chance to create a new trail
-    if (random(100) < TRAIL_CREATE_CHANCE) {
+    if (frameChance(TRAIL_CREATE_CHANCE / 100.0f)) {
         createTrail(stripType, subStrip);
     }
 
@@ -329,7 +275,7 @@ void EmeraldCityEffect::updateStripTrails(int stripType, int subStrip) {
     for (auto& trail : *trails) {
         if (trail.isActive) {
             // Move the trail upward
-            trail.position += trail.speed;
+            trail.position += trail.speed * frameStep;
 
             // Deactivate if trail has moved completely off the top
             if (trail.position > stripLength + TRAIL_LENGTH) {
@@ -353,15 +299,24 @@ void EmeraldCityEffect::createTrail(int stripType, int subStrip) {
         trails = &outerTrails[subStrip];
     }
 
+    // Fewer trails per strip at reduced quality - the ones already running still finish
+    int activeTrails = 0;
+    for (const auto& trail : *trails) {
+        if (trail.isActive) activeTrails++;
+    }
+    if (activeTrails >= qualityBudget(MAX_TRAILS_PER_STRIP)) {
+        return;
+    }
+
     // Find an inactive trail to reuse
     for (auto& trail : *trails) {
         if (!trail.isActive) {
             // Initialize the new trail
             trail.isActive = true;
             trail.position = -TRAIL_LENGTH;  // Start below the strip
-            trail.speed = MIN_TRAIL_SPEED + (random(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
+            trail.speed = MIN_TRAIL_SPEED + (rng.range(100) / 100.0f) * (MAX_TRAIL_SPEED - MIN_TRAIL_SPEED);
             trail.greenHue = getRandomGreenHue();
-            trail.brightness = TRAIL_BRIGHTNESS + random(75);  // Add some brightness variation
+            trail.brightness = TRAIL_BRIGHTNESS + rng.range(75);  // Add some brightness variation
             trail.stripType = stripType;
             trail.subStrip = subStrip;
             break;
@@ -396,186 +351,26 @@ void EmeraldCityEffect::renderTrail(EmeraldTrail& trail, int stripType, int subS
 
             // BLEND with existing color instead of replacing (additive blending for overlaps)
             if (stripType == 1) {  // Inner
-                leds.getInner()[physicalPos] += greenColor;  // Additive blending
+                target->getInner()[physicalPos] += greenColor;  // Additive blending
             } else if (stripType == 2) {  // Outer
-                leds.getOuter()[physicalPos] += greenColor;  // Additive blending
+                target->getOuter()[physicalPos] += greenColor;  // Additive blending
             }
         }
     }
 }
 
 void EmeraldCityEffect::updateSparkles() {
-    unsigned long currentTime = millis();
+    // Age the lit sparkles and start any new ones that are due
+    sparkles.update(millis(), rng);
 
-    // Only update sparkles at specified intervals for smooth animation
-    if (currentTime - lastSparkleUpdate < SPARKLE_UPDATE_INTERVAL) {
-        return;
-    }
-
-    lastSparkleUpdate = currentTime;
-
-    // Update sparkles for inner strips
-    for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        // If not currently sparkling, random chance to start (50% less for inner/outer)
-        if (innerSparkleValues[i] <= 0.0f) {
-            if (random(1000) < (INNER_OUTER_SPARKLE_CHANCE * 1000)) {
-                innerSparkleValues[i] = 0.01f;  // Start the fade cycle
-                innerSparkleColors[i] = random(2);  // Random color: 0=white, 1=light green
-                innerSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // New random brightness 20% to 100%
-                // New random speed for this sparkle: 50% to 200% of base speed
-                innerSparkleSpeed[i] = BASE_SPARKLE_SPEED * (MIN_SPEED_MULTIPLIER + (random(150) / 100.0f));
-            }
-        }
-        // If currently sparkling, use individual speed for fade
-        else {
-            innerSparkleValues[i] += innerSparkleSpeed[i];  // Use individual sparkle's speed
-
-            // Use sine wave for smooth fade in and out with more gradual curves
-            float phase = innerSparkleValues[i];
-            float sineValue;
-
-            // Create a more gradual fade by using a modified sine curve
-            if (phase <= PI) {
-                // Use a smoother curve: sin^2 for more gradual fade in/out
-                float baseSine = sin(phase);
-                sineValue = baseSine * baseSine;  // Squaring makes the fade more gradual
-            } else {
-                // Sparkle cycle complete, turn off
-                innerSparkleValues[i] = 0.0f;
-                sineValue = 0.0f;
-            }
-
-            // Apply sparkle color if active
-            if (sineValue > 0.0f) {
-                CRGB sparkleColor;
-                // Use the individual sparkle's random brightness level
-                float intensity = sineValue * innerSparkleBrightness[i];
-
-                if (innerSparkleColors[i] == 0) {
-                    // White sparkle
-                    uint8_t brightValue = (uint8_t)(255 * intensity);
-                    sparkleColor = CRGB(brightValue, brightValue, brightValue);
-                } else {
-                    // Light green sparkle (pale green)
-                    uint8_t brightValue = (uint8_t)(255 * intensity);
-                    sparkleColor = CRGB(brightValue * 0.3f, brightValue, brightValue * 0.5f);
-                }
+    // Sparkles go on top of the trails and the ring glow
+    sparkles.render(innerSparkleLayer, target->getInner());
+    sparkles.render(outerSparkleLayer, target->getOuter());
 
-                // Blend with existing color (additive)
-                leds.getInner()[i] += sparkleColor;
-            }
-        }
-    }
-
-    // Update sparkles for outer strips - same smooth sine logic
-    for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        // If not currently sparkling, random chance to start (50% less for inner/outer)
-        if (outerSparkleValues[i] <= 0.0f) {
-            if (random(1000) < (INNER_OUTER_SPARKLE_CHANCE * 1000)) {
-                outerSparkleValues[i] = 0.01f;  // Start the fade cycle
-                outerSparkleColors[i] = random(2);  // Random color: 0=white, 1=light green
-                outerSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // New random brightness 20% to 100%
-                // New random speed for this sparkle: 50% to 200% of base speed
-                outerSparkleSpeed[i] = BASE_SPARKLE_SPEED * (MIN_SPEED_MULTIPLIER + (random(150) / 100.0f));
-            }
-        }
-        // If currently sparkling, use individual speed for fade
-        else {
-            outerSparkleValues[i] += outerSparkleSpeed[i];  // Use individual sparkle's speed
-
-            // Use sine wave for smooth fade in and out with more gradual curves
-            float phase = outerSparkleValues[i];
-            float sineValue;
-
-            // Create a more gradual fade by using a modified sine curve
-            if (phase <= PI) {
-                // Use a smoother curve: sin^2 for more gradual fade in/out
-                float baseSine = sin(phase);
-                sineValue = baseSine * baseSine;  // Squaring makes the fade more gradual
-            } else {
-                // Sparkle cycle complete, turn off
-                outerSparkleValues[i] = 0.0f;
-                sineValue = 0.0f;
-            }
-
-            // Apply sparkle color if active
-            if (sineValue > 0.0f) {
-                CRGB sparkleColor;
-                // Use the individual sparkle's random brightness level
-                float intensity = sineValue * outerSparkleBrightness[i];
-
-                if (outerSparkleColors[i] == 0) {
-                    // White sparkle
-                    uint8_t brightValue = (uint8_t)(255 * intensity);
-                    sparkleColor = CRGB(brightValue, brightValue, brightValue);
-                } else {
-                    // Light green sparkle (pale green)
-                    uint8_t brightValue = (uint8_t)(255 * intensity);
-                    sparkleColor = CRGB(brightValue * 0.3f, brightValue, brightValue * 0.5f);
-                }
-
-                // Blend with existing color (additive)
-                leds.getOuter()[i] += sparkleColor;
-            }
-        }
-    }
-
-    // Update sparkles for ring strip - same smooth sine logic
     // Skip ring updates if button feedback is active to avoid conflicts
     if (!skipRing) {
-        for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-            // If not currently sparkling, random chance to start (unchanged for ring)
-            if (ringSparkleValues[i] <= 0.0f) {
-                if (random(1000) < (RING_SPARKLE_CHANCE * 1000)) {
-                    ringSparkleValues[i] = 0.01f;  // Start the fade cycle
-                    // Ring sparkles: 75% green, 25% white
-                    ringSparkleColors[i] = (random(100) < 75) ? 1 : 0;  // 75% chance for green (1), 25% for white (0)
-                    ringSparkleBrightness[i] = 0.2f + (random(80) / 100.0f);  // New random brightness 20% to 100%
-                    // New random speed for ring sparkle: slower (25% to 50% of base speed)
-                    ringSparkleSpeed[i] = BASE_SPARKLE_SPEED * RING_SPEED_MULTIPLIER * (MIN_SPEED_MULTIPLIER + (random(100) / 100.0f));
-                }
-            }
-            // If currently sparkling, use individual speed for fade (slower for ring)
-            else {
-                ringSparkleValues[i] += ringSparkleSpeed[i];  // Use individual sparkle's slower speed
-
-                // Use sine wave for smooth fade in and out with more gradual curves
-                float phase = ringSparkleValues[i];
-                float sineValue;
-
-                // Create a more gradual fade by using a modified sine curve
-                if (phase <= PI) {
-                    // Use a smoother curve: sin^2 for more gradual fade in/out
-                    float baseSine = sin(phase);
-                    sineValue = baseSine * baseSine;  // Squaring makes the fade more gradual
-                } else {
-                    // Sparkle cycle complete, turn off
-                    ringSparkleValues[i] = 0.0f;
-                    sineValue = 0.0f;
-                }
-
-                // Apply sparkle color if active
-                if (sineValue > 0.0f) {
-                    CRGB sparkleColor;
-                    // Use the individual sparkle's random brightness level
-                    float intensity = sineValue * ringSparkleBrightness[i];
-
-                    if (ringSparkleColors[i] == 0) {
-                        // White sparkle
-                        uint8_t brightValue = (uint8_t)(255 * intensity);
-                        sparkleColor = CRGB(brightValue, brightValue, brightValue);
-                    } else {
-                        // Light green sparkle (pale green)
-                        uint8_t brightValue = (uint8_t)(255 * intensity);
-                        sparkleColor = CRGB(brightValue * 0.3f, brightValue, brightValue * 0.5f);
-                    }
-
-                    // Blend with existing color (additive)
-                    leds.getRing()[i] += sparkleColor;
-                }
-            }
-        }
-    } // End of skipRing check for ring sparkles
+        sparkles.render(ringSparkleLayer, target->getRing());
+    }
 }
 
 void EmeraldCityEffect::applyOuterFadeOverlay() {
@@ -607,7 +402,7 @@ void EmeraldCityEffect::applyOuterFadeOverlay() {
 
             // Apply the fade to the existing LED color
             int ledIndex = stripStartIndex + i;
-            leds.getOuter()[ledIndex].nscale8_video((uint8_t)(255 * fadeIntensity));
+            target->getOuter()[ledIndex].nscale8_video((uint8_t)(255 * fadeIntensity));
         }
     }
 }
@@ -617,7 +412,7 @@ void EmeraldCityEffect::applyCoreWaveEffect() {
     // Each of the 3 core segments displays the same wave pattern
 
     // Update wave position
-    coreWavePosition += CORE_WAVE_SPEED;
+    coreWavePosition += CORE_WAVE_SPEED * frameStep;
 
     // Calculate segment length (core strip divided into 3 equal segments)
     int segmentLength = LED_STRIP_CORE_COUNT / 3;
@@ -679,14 +474,14 @@ void EmeraldCityEffect::applyCoreWaveEffect() {
                 uint8_t blue = (uint8_t)(120 * waveIntensity);  // Reduced blue for emerald tone
 
                 // Set the LED color (overwrites any existing color for this effect)
-                leds.getCore()[physicalIndex] = CRGB(red, green, blue);
+                target->getCore()[physicalIndex] = CRGB(red, green, blue);
             }
         }
     }
 }
 uint8_t EmeraldCityEffect::getRandomGreenHue() {
     // Return a random green hue from the palette
-    return greenHues[random(6)];  // 6 green hues in the palette
+    return greenHues[rng.range(6)];  // 6 green hues in the palette
 }
 
 int EmeraldCityEffect::getStripLength(int stripType) {
@@ -4,6 +4,7 @@
 #define EMERALD_CITY_EFFECT_H
 
 #include "Effect.h"
+#include "SparkleEngine.h"
 #include <vector>
 
 /**
@@ -34,22 +35,11 @@ struct EmeraldTrail {
 class EmeraldCityEffect : public Effect {
 public:
     /**
-     * Constructor - initializes the effect with sparkle arrays
+     * Constructor - initializes the effect and its sparkle layers
      * @param ledController Reference to the LED controller for managing LEDs
      */
     EmeraldCityEffect(LEDController& ledController);
 
-    /**
-     * Destructor - cleans up allocated memory for sparkle arrays
-     */
-    ~EmeraldCityEffect();
-
-    /**
-     * Update the effect each frame
-     * Handles trail movement, creation, and sparkle effects
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Clears all active trails and resets sparkle values
@@ -60,13 +50,22 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Emerald City Effect"; }
+    const char* getName() const override { return "Emerald City Effect"; }
 
 private:
+    /**
+     * Update the effect each frame
+     * Handles trail movement, creation, and sparkle effects
+     */
+    void render() override;
+
     // Collection of all green trails (both active and inactive)
     std::vector<EmeraldTrail> innerTrails[NUM_INNER_STRIPS];  // Trails for each inner strip
     std::vector<EmeraldTrail> outerTrails[NUM_OUTER_STRIPS];  // Trails for each outer strip
 
+    // Per-frame chances and speeds below are tuned for 16ms frames and scaled by frameStep
+    static constexpr float REFERENCE_FRAME_MS = 16.0f;
+
     // Effect parameters for green trails
     static const int MAX_TRAILS_PER_STRIP = 12;        // Maximum trails per strip (half the amount: 25 -> 12)
     static const int TRAIL_CREATE_CHANCE = 37;         // Chance per frame to create new trail (half the frequency: 75 -> 37)
@@ -81,40 +80,23 @@ private:
     static const int NUM_GREEN_COLORS = 6;
     uint8_t greenHues[NUM_GREEN_COLORS];               // Array of green hue values
 
-    // White sparkle effect variables for inner, outer, and ring strips
-    float* innerSparkleValues;          // Array to store sparkle intensity for each inner LED (0.0 to 1.0)
-    float* outerSparkleValues;          // Array to store sparkle intensity for each outer LED (0.0 to 1.0)
-    float* ringSparkleValues;           // Array to store sparkle intensity for each ring LED (0.0 to 1.0)
-
-    // Sparkle color tracking (0 = white, 1 = light green)
-    uint8_t* innerSparkleColors;        // Array to store sparkle color type for each inner LED
-    uint8_t* outerSparkleColors;        // Array to store sparkle color type for each outer LED
-    uint8_t* ringSparkleColors;         // Array to store sparkle color type for each ring LED
-
-    // Sparkle brightness tracking (random brightness levels from 20% to 100%)
-    float* innerSparkleBrightness;      // Array to store random max brightness for each inner LED
-    float* outerSparkleBrightness;      // Array to store random max brightness for each outer LED
-    float* ringSparkleBrightness;       // Array to store random max brightness for each ring LED
-
-    // Sparkle speed tracking (random fade speeds for each sparkle)
-    float* innerSparkleSpeed;           // Array to store random fade speed for each inner LED
-    float* outerSparkleSpeed;           // Array to store random fade speed for each outer LED
-    float* ringSparkleSpeed;            // Array to store random fade speed for each ring LED (slower)
-
-    // Sparkle timing and parameters
-    unsigned long lastSparkleUpdate;    // When sparkles were last updated
-    static constexpr unsigned long SPARKLE_UPDATE_INTERVAL = 10;   // Update sparkles every 10ms (ultra smooth)
-    static constexpr float INNER_OUTER_SPARKLE_CHANCE = 0.0033f;   // 0.33% chance for inner/outer (50% less: 0.67% -> 0.33%)
-    static constexpr float RING_SPARKLE_CHANCE = 0.0067f;         // 0.67% chance for ring (unchanged)
-    static constexpr float BASE_SPARKLE_SPEED = 0.1f;             // Base fade speed for inner/outer sparkles
+    // White and light green sparkles on inner, outer, and ring strips
+    // Only lit sparkles are stored - see SparkleEngine
+    SparkleEngine sparkles;
+    int innerSparkleLayer;              // Sparkle layer index for the inner strips
+    int outerSparkleLayer;              // Sparkle layer index for the outer strips
+    int ringSparkleLayer;               // Sparkle layer index for the ring strip
+
+    // Sparkle parameters
+    static const int MAX_SPARKLES = 96;                           // Most sparkles lit at once (all strips together)
+    static constexpr float INNER_OUTER_SPARKLE_RATE = 0.25f;      // Sparkles per idle LED per second (0.4% per 16ms frame)
+    static constexpr float RING_SPARKLE_RATE = 0.44f;             // Sparkles per idle ring LED per second (0.7% per 16ms frame)
+    static constexpr float BASE_SPARKLE_SPEED = 0.1f / 16.0f;     // Base fade speed in radians per ms (0.1 per 16ms frame)
     static constexpr float MIN_SPEED_MULTIPLIER = 0.5f;           // Minimum speed multiplier (50% of base)
     static constexpr float MAX_SPEED_MULTIPLIER = 2.0f;           // Maximum speed multiplier (200% of base)
     static constexpr float RING_SPEED_MULTIPLIER = 0.5f;          // Ring sparkles are 50% slower (twice as long)
     static constexpr float MAX_SPARKLE_BRIGHTNESS = 0.6f;         // Maximum sparkle brightness
 
-    // Timing variables
-    unsigned long lastUpdateTime;       // For frame rate control
-
     // Fade parameters for outer strips (fade to black from bottom to top)
     static constexpr float FADE_START_POSITION = 0.3f;        // Start fading at 30% up the strip
     static constexpr float FADE_END_POSITION = 0.9f;          // Complete fade by 90% up the strip
@@ -177,7 +159,7 @@ private:
 
     /**
      * Update white sparkle effects for inner, outer, and ring strips
-     * Creates random white sparkles that fade over time (much slower than before)
+     * Starts new sparkles when they are due and draws the lit ones on top
      */
     void updateSparkles();
 
@@ -199,7 +181,6 @@ private:
      */
     void applyInnerWaveFade();
 
-
     /**
      * Get a random green hue from the palette
      * @return A green hue value for trail coloring
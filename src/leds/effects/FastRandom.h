@@ -0,0 +1,130 @@
+// src/leds/effects/FastRandom.h
+#ifndef FAST_RANDOM_H
+#define FAST_RANDOM_H
+
+#include <Arduino.h>
+
+/**
+ * FastRandom - Small seedable random number generator for effects
+ *
+ * Arduino's random() goes through the C library on every call and shares one
+ * global state between all effects, so the sequence an effect sees depends on
+ * what every other effect did before it. This is a xorshift32 generator:
+ * three shifts and three XORs per 32-bit number, no division, and one
+ * independent state per effect. Seeding it with a fixed value makes an
+ * effect produce exactly the same frames every run, which is what benchmark
+ * and comparison runs need.
+ *
+ * The helpers keep the same meaning as the Arduino calls they replace:
+ * range(max) works like random(max) and range(min, max) like random(min, max).
+ */
+class FastRandom {
+public:
+    /**
+     * Constructor
+     * @param seed Starting seed (any value, 0 is replaced by a fixed constant)
+     */
+    explicit FastRandom(uint32_t seed = 1) { this->seed(seed); }
+
+    /**
+     * Restart the sequence from a seed
+     * The seed is mixed first so neighbouring seeds (1, 2, 3...) still give
+     * unrelated sequences
+     * @param value Seed value
+     */
+    void seed(uint32_t value) {
+        value ^= value >> 16;
+        value *= 0x7FEB352Du;
+        value ^= value >> 15;
+        value *= 0x846CA68Bu;
+        value ^= value >> 16;
+
+        // xorshift gets stuck on 0, so never start there
+        state = value ? value : 0x9E3779B9u;
+    }
+
+    /**
+     * Get the next 32-bit random number
+     */
+    uint32_t next() {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state = x;
+        return x;
+    }
+
+    /**
+     * Get a random byte (0-255)
+     */
+    uint8_t next8() { return next() >> 24; }
+
+    /**
+     * Random number from 0 to max-1 (same as Arduino random(max))
+     * Uses a multiply instead of a modulo, so there is no division
+     * @param max Upper bound (exclusive), returns 0 if max <= 0
+     */
+    int32_t range(int32_t max) {
+        if (max <= 0) return 0;
+        return (int32_t)(((uint64_t)next() * (uint32_t)max) >> 32);
+    }
+
+    /**
+     * Random number from min to max-1 (same as Arduino random(min, max))
+     * @param min Lower bound (inclusive, may be negative)
+     * @param max Upper bound (exclusive), returns min if max <= min
+     */
+    int32_t range(int32_t min, int32_t max) {
+        if (max <= min) return min;
+        return min + range(max - min);
+    }
+
+    /**
+     * Roll a chance of numerator in denominator
+     * rng.chance(15, 100) is the same test as random(100) < 15
+     * @param numerator How many outcomes count as a hit
+     * @param denominator Total number of outcomes
+     * @return True on a hit
+     */
+    bool chance(int32_t numerator, int32_t denominator) {
+        return range(denominator) < numerator;
+    }
+
+    /**
+     * Random float from 0.0 up to (not including) 1.0
+     */
+    float unit() {
+        // Top 24 bits fit exactly in a float mantissa
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * Fill a buffer with random bytes, four bytes per generated number
+     * Use this when a loop needs one random byte per LED or per cell
+     * @param out Destination buffer
+     * @param count Number of bytes to write
+     */
+    void fill(uint8_t* out, int count) {
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            uint32_t bits = next();
+            out[i] = bits;
+            out[i + 1] = bits >> 8;
+            out[i + 2] = bits >> 16;
+            out[i + 3] = bits >> 24;
+        }
+        if (i < count) {
+            uint32_t bits = next();
+            for (; i < count; i++) {
+                out[i] = bits;
+                bits >>= 8;
+            }
+        }
+    }
+
+private:
+    uint32_t state;  // Current xorshift state (never 0)
+};
+
+#endif // FAST_RANDOM_H
@@ -7,16 +7,21 @@ FireEffect::FireEffect(LEDController& ledController) :
     heatCore(nullptr),
     heatInner(nullptr),
     heatOuter(nullptr),
-    lastUpdateTime(0),
-    intensity(70)
+    intensity(100),             // Full intensity keeps the original fire colors
+    heatPalette(FirePalette::get(100))
 {
     // Allocate memory for heat arrays
     heatCore = new byte[LED_STRIP_CORE_COUNT];
     heatInner = new byte[LED_STRIP_INNER_COUNT];
     heatOuter = new byte[LED_STRIP_OUTER_COUNT];
 
-    // Initialize with default values
-    reset();
+    // Cooling ranges only depend on strip geometry, so build them once
+    buildCoolingTable(innerCoolRange, INNER_LEDS_PER_STRIP);
+    buildCoolingTable(outerCoolRange, OUTER_LEDS_PER_STRIP);
+
+    // Starting heat only - update() warms the fire up on the first frame,
+    // after SmartLantern has seeded and set up the new effect
+    initHeat();
 }
 
 FireEffect::~FireEffect() {
@@ -27,13 +32,20 @@ FireEffect::~FireEffect() {
 }
 
 void FireEffect::reset() {
+    initHeat();
+
+    // Skip the first moments, so the fire is already burning when it appears
+    warmUp(warmUpMs());
+}
+
+void FireEffect::initHeat() {
     // Initialize all arrays to zero
     memset(heatCore, 0, LED_STRIP_CORE_COUNT);
     memset(heatInner, 0, LED_STRIP_INNER_COUNT);
     memset(heatOuter, 0, LED_STRIP_OUTER_COUNT);
 
     // Debug print
-    Serial.println("FireEffect reset - initializing all strips");
+    Serial.println("FireEffect - initializing all strips");
     Serial.print("NUM_INNER_STRIPS: ");
     Serial.println(NUM_INNER_STRIPS);
     Serial.print("NUM_OUTER_STRIPS: ");
@@ -58,11 +70,11 @@ void FireEffect::reset() {
             // Heat decreases as we go up
             if (percentHeight < 0.2) {
                 // Very hot base with white-hot elements
-                heatInner[index] = random(230, 255);  // Higher heat for white-hot appearance
+                heatInner[index] = rng.range(230, 255);  // Higher heat for white-hot appearance
             }
             else if (percentHeight < 0.4) {
                 // Hot base
-                heatInner[index] = random(200, 230);
+                heatInner[index] = rng.range(200, 230);
             }
             else if (percentHeight < 0.7) {
                 // Medium middle
@@ -87,11 +99,11 @@ void FireEffect::reset() {
             // Heat decreases as we go up - use slightly higher values than inner
             if (percentHeight < 0.2) {
                 // Very hot base with white-hot elements
-                heatOuter[index] = random(240, 255);  // Higher heat for white-hot appearance
+                heatOuter[index] = rng.range(240, 255);  // Higher heat for white-hot appearance
             }
             else if (percentHeight < 0.4) {
                 // Hot base
-                heatOuter[index] = random(210, 240);
+                heatOuter[index] = rng.range(210, 240);
             }
             else if (percentHeight < 0.7) {
                 // Medium middle
@@ -107,136 +119,49 @@ void FireEffect::reset() {
     lastUpdateTime = millis();
 }
 
-void FireEffect::update() {
+void FireEffect::render() {
     // Target 120 FPS for ultra-smooth fire animation but slow down the simulation more
-    if (!shouldUpdate(20)) {  // Changed from 16ms to 20ms = 50 FPS (25% slower than 62.5 FPS)
+    if (!beginFrame(20, FIRE_STEP_MS)) {  // Changed from 16ms to 20ms = 50 FPS (25% slower than 62.5 FPS)
         return;
     }
 
-    // Update the fire simulation
-    updateFireBase();
+    // Update the fire simulation - one tick per 20ms that passed, so the flames
+    // move at the same speed even when frames come late
+    for (int ticks = frameTicks(FIRE_STEP_MS); ticks > 0; ticks--) {
+        updateFireBase();
+    }
 
     // Render the fire
     renderFire();
-
-    // Show the changes
-    leds.showAll();
 }
 
-void FireEffect::updateFireBase() {
-    // Adjusted fire parameters for higher flames
-    int cooling = 12;  // Reduced cooling further to keep heat longer (was 15)
-    int sparking = 110; // Increased spark chance for more activity (was 90)
-
-    // ====== INNER STRIPS ======
-    // Process each inner strip segment separately
-    for (int segment = 0; segment < NUM_INNER_STRIPS; segment++) {
-        int segmentStart = segment * INNER_LEDS_PER_STRIP;
-
-        // Create temporary array for this segment
-        byte tempHeat[INNER_LEDS_PER_STRIP];
-        memset(tempHeat, 0, INNER_LEDS_PER_STRIP);
-
-        // Copy current data
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            tempHeat[i] = heatInner[segmentStart + i];
-        }
-
-        // Cool down every cell a little - reduced cooling for higher flames
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            // Less cooling at all levels to preserve heat higher up
-            int coolAmount;
-            if (i < INNER_LEDS_PER_STRIP * 0.4) {
-                coolAmount = random(0, cooling / 6); // Even less cooling for hotter base (was /5)
-            } else if (i < INNER_LEDS_PER_STRIP * 0.8) {
-                coolAmount = random(0, cooling / 4); // Less cooling in middle (was /3)
-            } else {
-                coolAmount = random(0, cooling / 3); // Less cooling at top (was /2)
-            }
-
-            if (tempHeat[i] > coolAmount) {
-                tempHeat[i] = tempHeat[i] - coolAmount;
-            } else {
-                tempHeat[i] = 0;
-            }
-        }
-
-        // Heat rises upward - stronger mixing for higher flames
-        for (int i = INNER_LEDS_PER_STRIP - 1; i >= 2; i--) {
-            tempHeat[i] = (tempHeat[i] * 1 + tempHeat[i-1] * 4 + tempHeat[i-2] * 3) / 8; // Stronger upward heat flow (was /6)
-        }
-
-        // Randomly ignite new sparks at the bottom - more and bigger sparks
-        if (random8() < sparking) {
-            int y = random8(7); // Slightly more bottom LEDs can spark (was 5)
-            tempHeat[y] = tempHeat[y] + random8(80, 160); // Even larger sparks (was 60-140)
-
-            // More frequent white-hot sparks
-            if (random8() < 40) {  // 40% chance for an extra hot spark (was 30%)
-                tempHeat[y] = min(255, tempHeat[y] + random8(40, 80)); // Bigger white-hot sparks (was 30-60)
-            }
-        }
-
-        // Copy back to main array
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            heatInner[segmentStart + i] = tempHeat[i];
-        }
+void FireEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, FIRE_STEP_MS);
+    for (int ticks = frameTicks(FIRE_STEP_MS); ticks > 0; ticks--) {
+        updateFireBase();
     }
+}
 
-    // ====== OUTER STRIPS ======
-    // Process each outer strip segment separately (same changes as inner strips)
-    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        int segmentStart = segment * OUTER_LEDS_PER_STRIP;
-
-        // Create temporary array for this segment
-        byte tempHeat[OUTER_LEDS_PER_STRIP];
-        memset(tempHeat, 0, OUTER_LEDS_PER_STRIP);
-
-        // Copy current data
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            tempHeat[i] = heatOuter[segmentStart + i];
-        }
-
-        // Cool down every cell a little - reduced cooling for higher flames
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            // Less cooling at all levels to preserve heat higher up
-            int coolAmount;
-            if (i < OUTER_LEDS_PER_STRIP * 0.4) {
-                coolAmount = random(0, cooling / 6); // Even less cooling for hotter base (was /5)
-            } else if (i < OUTER_LEDS_PER_STRIP * 0.8) {
-                coolAmount = random(0, cooling / 4); // Less cooling in middle (was /3)
-            } else {
-                coolAmount = random(0, cooling / 3); // Less cooling at top (was /2)
-            }
-
-            if (tempHeat[i] > coolAmount) {
-                tempHeat[i] = tempHeat[i] - coolAmount;
-            } else {
-                tempHeat[i] = 0;
-            }
-        }
-
-        // Heat rises upward - stronger mixing for higher flames
-        for (int i = OUTER_LEDS_PER_STRIP - 1; i >= 2; i--) {
-            tempHeat[i] = (tempHeat[i] * 1 + tempHeat[i-1] * 4 + tempHeat[i-2] * 3) / 8; // Stronger upward heat flow (was /6)
-        }
-
-        // Randomly ignite new sparks at the bottom - more and bigger sparks
-        if (random8() < sparking) {
-            int y = random8(7); // Slightly more bottom LEDs can spark (was 5)
-            tempHeat[y] = tempHeat[y] + random8(80, 160); // Even larger sparks (was 60-140)
-
-            // More frequent white-hot sparks
-            if (random8() < 40) {  // 40% chance for an extra hot spark (was 30%)
-                tempHeat[y] = min(255, tempHeat[y] + random8(40, 80)); // Bigger white-hot sparks (was 30-60)
-            }
-        }
-
-        // Copy back to main array
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            heatOuter[segmentStart + i] = tempHeat[i];
+void FireEffect::buildCoolingTable(uint8_t* table, int segmentLength) {
+    // Less cooling at all levels to preserve heat higher up
+    for (int i = 0; i < segmentLength; i++) {
+        if (i < segmentLength * 0.4) {
+            table[i] = FIRE_COOLING / 6; // Even less cooling for hotter base
+        } else if (i < segmentLength * 0.8) {
+            table[i] = FIRE_COOLING / 4; // Less cooling in middle
+        } else {
+            table[i] = FIRE_COOLING / 3; // Less cooling at top
         }
     }
+}
+
+void FireEffect::updateFireBase() {
+    // Cool, rise and spark all inner and outer segments in one kernel pass
+    FireField fields[] = {
+        { heatInner, NUM_INNER_STRIPS, INNER_LEDS_PER_STRIP, innerCoolRange },
+        { heatOuter, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, outerCoolRange }
+    };
+    FireKernel::step(fields, 2, FireKernel::FLOW_UP, FIRE_SPARKING, rng);
 
     // Force fade to black at the top of strips - reduce heat values based on position
     for (int segment = 0; segment < NUM_INNER_STRIPS; segment++) {
@@ -313,45 +238,9 @@ void FireEffect::updateFireBase() {
     }
 }
 
-uint32_t FireEffect::heatToColor(unsigned char heat) {
-    // Convert heat value to fire colors (white-yellow-orange-red)
-    CRGB color;
-
-    if (heat <= 0) {
-        // No heat = black
-        color = CRGB(0, 0, 0);
-    }
-    else if (heat < 70) {
-        // Low heat = dark red
-        uint8_t red = map(heat, 0, 70, 0, 160);
-        color = CRGB(red, 0, 0);
-    }
-    else if (heat < 140) {
-        // Medium heat = red
-        uint8_t red = map(heat, 70, 140, 160, 255);
-        uint8_t green = map(heat, 70, 140, 0, 40);
-        color = CRGB(red, green, 0);
-    }
-    else if (heat < 210) {
-        // High heat = orange-yellow
-        uint8_t red = 255;
-        uint8_t green = map(heat, 140, 210, 40, 120);
-        color = CRGB(red, green, 0);
-    }
-    else {
-        // Very high heat = white-hot core
-        uint8_t red = 255;
-        uint8_t green = map(heat, 210, 255, 120, 255);
-        uint8_t blue = map(heat, 210, 255, 0, 220);  // Add blue to make it whiter
-        color = CRGB(red, green, blue);
-    }
-
-    return (uint32_t)color.r << 16 | (uint32_t)color.g << 8 | color.b;
-}
-
 void FireEffect::renderFire() {
     // Clear all strips first
-    leds.clearAll();
+    target->clearAll();
 
     // Core strip remains off intentionally
 
@@ -371,37 +260,8 @@ void FireEffect::renderFire() {
 
                 // Make sure we're in bounds
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-                    // Set the LED color
-                    uint32_t colorVal = heatToColor(heatInner[idx]);
-                    CRGB color = leds.neoColorToCRGB(colorVal);
-
-                    // Apply fade to black starting at 45% up the strip (was 60% - much lower for more black)
-                    float fadeStartPosition = INNER_LEDS_PER_STRIP * 0.45f;
-
-                    if (i >= fadeStartPosition) {
-                        // Calculate fade factor with very aggressive fading
-                        float fadeProgress = (float(i) - fadeStartPosition) / (INNER_LEDS_PER_STRIP - fadeStartPosition);
-
-                        // Apply double exponential fade for extremely dramatic effect
-                        fadeProgress = fadeProgress * fadeProgress * fadeProgress; // Cube for very aggressive fade
-
-                        float fadeFactor = 1.0f - fadeProgress; // 1.0 at start, 0.0 at top
-
-                        // Apply fade by reducing all color components
-                        color.r = color.r * fadeFactor;
-                        color.g = color.g * fadeFactor;
-                        color.b = color.b * fadeFactor;
-
-                        // Force more of the top to be completely black
-                        if (i >= INNER_LEDS_PER_STRIP * 0.90f) { // Top 10% of strip forced black (was 1%)
-                            color.r = 0;
-                            color.g = 0;
-                            color.b = 0;
-                        }
-                    }
-                    // If i < fadeStartPosition, use original color (no fade)
-
-                    leds.getInner()[physicalPos] = color;
+                    // Set the LED color (the top fade is applied below)
+                    target->getInner()[physicalPos] = heatPalette[heatInner[idx]];
                 }
             }
         }
@@ -423,44 +283,16 @@ void FireEffect::renderFire() {
 
                 // Make sure we're in bounds
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-                    // Set the LED color
-                    uint32_t colorVal = heatToColor(heatOuter[idx]);
-                    CRGB color = leds.neoColorToCRGB(colorVal);
-
-                    // Apply fade to black starting at 45% up the strip (was 60% - much lower for more black)
-                    float fadeStartPosition = OUTER_LEDS_PER_STRIP * 0.45f;
-
-                    if (i >= fadeStartPosition) {
-                        // Calculate fade factor with very aggressive fading
-                        float fadeProgress = (float(i) - fadeStartPosition) / (OUTER_LEDS_PER_STRIP - fadeStartPosition);
-
-                        // Apply double exponential fade for extremely dramatic effect
-                        fadeProgress = fadeProgress * fadeProgress * fadeProgress; // Cube for very aggressive fade
-
-                        float fadeFactor = 1.0f - fadeProgress; // 1.0 at start, 0.0 at top
-
-                        // Apply fade by reducing all color components
-                        color.r = color.r * fadeFactor;
-                        color.g = color.g * fadeFactor;
-                        color.b = color.b * fadeFactor;
-
-                        // Force more of the top to be completely black
-                        if (i >= OUTER_LEDS_PER_STRIP * 0.90f) { // Top 10% of strip forced black (was 1%)
-                            color.r = 0;
-                            color.g = 0;
-                            color.b = 0;
-                        }
-                    }
-                    // If i < fadeStartPosition, use original color (no fade)
-
-                    leds.getOuter()[physicalPos] = color;
+                    // Set the LED color (the top fade is applied below)
+                    target->getOuter()[physicalPos] = heatPalette[heatOuter[idx]];
                 }
             }
         }
     }
 
-    // FORCE-ON TEST for third outer strip with updated fade
-
+    // Fade to black starting at 45% up the strip, top 10% forced black
+    leds.applyMask(target->getInner(), LEDController::MASK_INNER_FIRE_FADE);
+    leds.applyMask(target->getOuter(), LEDController::MASK_OUTER_FIRE_FADE);
 }
 
 int FireEffect::mapLEDPosition(int stripType, int position, int subStrip) {
@@ -473,4 +305,7 @@ int FireEffect::mapLEDPosition(int stripType, int position, int subStrip) {
 void FireEffect::setIntensity(byte newIntensity) {
     // Clamp intensity to 0-100
     intensity = constrain(newIntensity, 0, 100);
+
+    // Switch to the pre-scaled palette for this intensity
+    heatPalette = FirePalette::get(intensity);
 }
\ No newline at end of file
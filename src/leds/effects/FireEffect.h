@@ -4,6 +4,8 @@
 #define FIRE_EFFECT_H
 
 #include "Effect.h"
+#include "FireKernel.h"
+#include "FirePalette.h"
 #include <Arduino.h>
 
 /**
@@ -28,12 +30,6 @@ public:
      */
     ~FireEffect();
 
-    /**
-     * Update the fire effect animation
-     * Called on each animation frame
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      */
@@ -45,24 +41,58 @@ public:
      */
     void setIntensity(unsigned char intensity);
 
-    String getName() const override { return "Fire Effect"; }
+    /**
+     * The flames need a moment to climb out of the starting heat pattern
+     */
+    unsigned long warmUpMs() const override { return FIRE_WARM_UP_MS; }
+
+    const char* getName() const override { return "Fire Effect"; }
 
 protected:
+    /**
+     * Update the fire effect animation
+     * Called on each animation frame
+     */
+    void render() override;
+
+    /**
+     * Run the heat simulation for a warm-up step, without drawing
+     */
+    void simulate(unsigned long stepMs) override;
+
+    /**
+     * Set up the starting heat pattern - the constructor and reset() share it
+     * Only reset() warms up from it; a new effect warms up on its first update()
+     */
+    void initHeat();
+
     // Heat simulation arrays for each strip
     unsigned char* heatCore;
     unsigned char* heatInner;
     unsigned char* heatOuter;
 
-    // Animation timing
-    unsigned long lastUpdateTime;
+    // The heat simulation always runs in fixed 20ms ticks (50 per second), whatever the frame rate
+    static constexpr float FIRE_STEP_MS = 20.0f;
+    static const unsigned long FIRE_WARM_UP_MS = 1500;  // Long enough for sparks to reach the top
 
     // Fire intensity (0-100)
     unsigned char intensity;
 
+    // Heat-to-color table for the current intensity (shared, owned by FirePalette)
+    const CRGB* heatPalette;
+
+    // Per-height cooling ranges for the fire kernel (each cell cools by 0..range-1)
+    uint8_t innerCoolRange[INNER_LEDS_PER_STRIP];
+    uint8_t outerCoolRange[OUTER_LEDS_PER_STRIP];
+
+    // Fire parameters for higher flames
+    static const int FIRE_COOLING = 12;   // Reduced cooling to keep heat longer
+    static const int FIRE_SPARKING = 110; // Spark chance per segment per step (out of 255)
+
     // Helper methods
+    void buildCoolingTable(uint8_t* table, int segmentLength);
     void updateFireBase();
     void renderFire();
-    uint32_t heatToColor(unsigned char heat);
     int mapLEDPosition(int stripType, int position, int subStrip = 0);
 };
 
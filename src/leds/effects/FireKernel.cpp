@@ -0,0 +1,105 @@
+// src/leds/effects/FireKernel.cpp
+
+#include "FireKernel.h"
+
+void FireKernel::step(FireField* fields, int numFields, Direction direction, uint8_t sparking, FastRandom& rng) {
+    // Count how many random bytes this step needs
+    int totalCells = 0;
+    int totalSegments = 0;
+    for (int f = 0; f < numFields; f++) {
+        totalCells += fields[f].numSegments * fields[f].segmentLength;
+        totalSegments += fields[f].numSegments;
+    }
+
+    if (totalCells > MAX_CELLS || totalSegments > MAX_SEGMENTS) {
+        Serial.println("ERROR: FireKernel fields are larger than the LED layout");
+        return;
+    }
+
+    // Generate all random bytes for this step in one batch (4 bytes per draw)
+    uint8_t noise[MAX_CELLS + MAX_SEGMENTS * SPARK_BYTES];
+    int noiseCount = totalCells + totalSegments * SPARK_BYTES;
+    rng.fill(noise, noiseCount);
+
+    const uint8_t* coolNoise = noise;
+    const uint8_t* sparkNoise = noise + totalCells;
+
+    for (int f = 0; f < numFields; f++) {
+        FireField& field = fields[f];
+        int length = field.segmentLength;
+
+        for (int segment = 0; segment < field.numSegments; segment++) {
+            uint8_t* cells = field.heat + segment * length;
+
+            // Cool down every cell - scale the random byte into 0..coolRange-1
+            for (int i = 0; i < length; i++) {
+                uint8_t coolAmount = ((uint16_t)coolNoise[i] * field.coolRange[i]) >> 8;
+                cells[i] = qsub8(cells[i], coolAmount);
+            }
+            coolNoise += length;
+
+            // Heat flows along the segment
+            flow(cells, length, direction);
+
+            // Randomly ignite new sparks at the hot end
+            if (sparkNoise[0] < sparking) {
+                int y = scale8(sparkNoise[1], 7); // One of the 7 cells nearest the hot end
+                if (direction == FLOW_DOWN) {
+                    y = length - 1 - y;
+                }
+
+                cells[y] = qadd8(cells[y], 80 + scale8(sparkNoise[2], 80)); // 80-159
+
+                // Extra white-hot spark
+                if (sparkNoise[3] < 40) {
+                    cells[y] = qadd8(cells[y], 40 + scale8(sparkNoise[4], 40)); // 40-79
+                }
+            }
+            sparkNoise += SPARK_BYTES;
+        }
+    }
+}
+
+inline uint32_t FireKernel::flow4(uint32_t a, uint32_t b, uint32_t c) {
+    // Split into even and odd bytes so each lane has 16 bits of headroom
+    // (max lane value is 255 * 8 = 2040, so lanes never carry into each other)
+    const uint32_t mask = 0x00FF00FF;
+
+    uint32_t even = (a & mask) + ((b & mask) << 2) + (c & mask) * 3;
+    uint32_t odd = ((a >> 8) & mask) + (((b >> 8) & mask) << 2) + ((c >> 8) & mask) * 3;
+
+    return ((even >> 3) & mask) | (((odd >> 3) & mask) << 8);
+}
+
+void FireKernel::flow(uint8_t* cells, int length, Direction direction) {
+    uint32_t a, b, c, result;
+
+    if (direction == FLOW_UP) {
+        // new[i] = (old[i] + 4*old[i-1] + 3*old[i-2]) / 8, working down from the top
+        // Each block only reads cells below the blocks already written, so it stays in place
+        int i = length - 1;
+        for (; i - 3 >= 2; i -= 4) {
+            memcpy(&a, cells + i - 3, 4);
+            memcpy(&b, cells + i - 4, 4);
+            memcpy(&c, cells + i - 5, 4);
+            result = flow4(a, b, c);
+            memcpy(cells + i - 3, &result, 4);
+        }
+        for (; i >= 2; i--) {
+            cells[i] = (cells[i] + cells[i - 1] * 4 + cells[i - 2] * 3) / 8;
+        }
+    } else {
+        // new[i] = (old[i] + 4*old[i+1] + 3*old[i+2]) / 8, working up from the bottom
+        int i = 0;
+        for (; i + 3 <= length - 3; i += 4) {
+            memcpy(&a, cells + i, 4);
+            memcpy(&b, cells + i + 1, 4);
+            memcpy(&c, cells + i + 2, 4);
+            result = flow4(a, b, c);
+            memcpy(cells + i, &result, 4);
+        }
+        for (; i <= length - 3; i++) {
+            cells[i] = (cells[i] + cells[i + 1] * 4 + cells[i + 2] * 3) / 8;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+// src/leds/effects/FireKernel.h
+
+#ifndef FIRE_KERNEL_H
+#define FIRE_KERNEL_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+#include "FastRandom.h"
+
+/**
+ * FireField - One group of equally sized strip segments sharing a heat array
+ *
+ * Heat is stored segment after segment (segment 0 cells, then segment 1, ...),
+ * which is the same layout the fire effects already use for heatInner/heatOuter.
+ */
+struct FireField {
+    uint8_t* heat;           // numSegments * segmentLength heat cells
+    int numSegments;         // Number of segments in this field
+    int segmentLength;       // Cells per segment (0 = bottom of the strip)
+    const uint8_t* coolRange; // Per-height cooling range: each cell cools by 0..coolRange-1
+};
+
+/**
+ * FireKernel - Shared integer heat-diffusion step for all fire effects
+ *
+ * Runs one fire simulation step in place on every segment of every field:
+ * 1. Random cooling, using one batch of random bytes for all cells
+ * 2. 3-tap heat flow (old[i] + 4*old[i-1] + 3*old[i-2]) / 8, processed four
+ *    cells at a time with packed 32-bit math
+ * 3. Random sparks at the hot end of each segment
+ *
+ * FireEffect rises from the bottom, SuspendedFireEffect hangs from the top.
+ * Both (and the party variants that inherit from them) use this kernel.
+ */
+class FireKernel {
+public:
+    // Which way heat flows along a segment
+    enum Direction : uint8_t {
+        FLOW_UP = 0,    // Heat rises from index 0 (FireEffect)
+        FLOW_DOWN = 1   // Heat hangs from the top index (SuspendedFireEffect)
+    };
+
+    /**
+     * Run one simulation step on all fields
+     * @param fields Array of heat fields to update (inner, outer, ...)
+     * @param numFields Number of entries in fields
+     * @param direction Direction heat flows in every field
+     * @param sparking Chance (0-255) that a segment ignites a spark this step
+     * @param rng Random number generator of the effect running the fire
+     */
+    static void step(FireField* fields, int numFields, Direction direction, uint8_t sparking, FastRandom& rng);
+
+private:
+    // Largest field the kernel handles in one step (all inner + all outer cells)
+    static const int MAX_CELLS = LED_STRIP_INNER_COUNT + LED_STRIP_OUTER_COUNT;
+
+    // Largest number of segments across all fields
+    static const int MAX_SEGMENTS = NUM_INNER_STRIPS + NUM_OUTER_STRIPS;
+
+    // Random bytes used per segment for sparks (chance, position, size, white-hot chance, white-hot size)
+    static const int SPARK_BYTES = 5;
+
+    /**
+     * Apply the 3-tap heat flow filter in place on one segment
+     * @param cells First cell of the segment
+     * @param length Cells in the segment
+     * @param direction Direction heat flows
+     */
+    static void flow(uint8_t* cells, int length, Direction direction);
+
+    /**
+     * Filter four neighbouring cells at once
+     * Each byte lane gets (a + 4*b + 3*c) / 8 using two 16-bit lanes per half
+     */
+    static inline uint32_t flow4(uint32_t a, uint32_t b, uint32_t c);
+};
+
+#endif // FIRE_KERNEL_H
@@ -0,0 +1,59 @@
+// src/leds/effects/FirePalette.cpp
+
+#include "FirePalette.h"
+
+CRGB* FirePalette::variants[FirePalette::NUM_VARIANTS] = { nullptr };
+
+const CRGB* FirePalette::get(uint8_t intensity) {
+    int variant = (min((int)intensity, 100) + INTENSITY_STEP / 2) / INTENSITY_STEP;
+
+    if (variants[variant] == nullptr) {
+        variants[variant] = new CRGB[256];
+        build(variants[variant], (variant * INTENSITY_STEP * 255) / 100);
+    }
+
+    return variants[variant];
+}
+
+void FirePalette::build(CRGB* table, uint8_t scale) {
+    // Convert heat value to fire colors (white-yellow-orange-red)
+    for (int heat = 0; heat < 256; heat++) {
+        CRGB color;
+
+        if (heat <= 0) {
+            // No heat = black
+            color = CRGB(0, 0, 0);
+        }
+        else if (heat < 70) {
+            // Low heat = dark red
+            uint8_t red = map(heat, 0, 70, 0, 160);
+            color = CRGB(red, 0, 0);
+        }
+        else if (heat < 140) {
+            // Medium heat = red
+            uint8_t red = map(heat, 70, 140, 160, 255);
+            uint8_t green = map(heat, 70, 140, 0, 40);
+            color = CRGB(red, green, 0);
+        }
+        else if (heat < 210) {
+            // High heat = orange-yellow
+            uint8_t red = 255;
+            uint8_t green = map(heat, 140, 210, 40, 120);
+            color = CRGB(red, green, 0);
+        }
+        else {
+            // Very high heat = white-hot core
+            uint8_t red = 255;
+            uint8_t green = map(heat, 210, 255, 120, 255);
+            uint8_t blue = map(heat, 210, 255, 0, 220);  // Add blue to make it whiter
+            color = CRGB(red, green, blue);
+        }
+
+        // Full intensity keeps the exact colors
+        if (scale < 255) {
+            color.nscale8_video(scale);
+        }
+
+        table[heat] = color;
+    }
+}
@@ -0,0 +1,43 @@
+// src/leds/effects/FirePalette.h
+
+#ifndef FIRE_PALETTE_H
+#define FIRE_PALETTE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * FirePalette - Precomputed 256-entry heat-to-color tables for the fire effects
+ *
+ * Converting heat to a fire color used to take a chain of branches and map()
+ * calls per pixel, plus packing into a uint32_t and unpacking it again.
+ * Now each pixel is a single table lookup: palette[heat].
+ *
+ * Tables are built the first time they are requested and then shared by every
+ * fire effect. Each intensity level (0-100%, in 10% steps) gets its own
+ * pre-scaled table, so setIntensity() costs nothing per pixel.
+ */
+class FirePalette {
+public:
+    /**
+     * Get the heat palette for a fire intensity
+     * @param intensity Fire intensity percentage (0-100), rounded to the nearest 10%
+     * @return Pointer to 256 colors indexed by heat (never nullptr)
+     */
+    static const CRGB* get(uint8_t intensity);
+
+private:
+    static const int INTENSITY_STEP = 10;                     // Percent between palette variants
+    static const int NUM_VARIANTS = 100 / INTENSITY_STEP + 1; // 0%, 10%, ... 100%
+
+    static CRGB* variants[NUM_VARIANTS];  // Built on first use
+
+    /**
+     * Fill a table with the white-yellow-orange-red fire gradient
+     * @param table Output table of 256 colors
+     * @param scale Brightness scale applied to every entry (255 = full)
+     */
+    static void build(CRGB* table, uint8_t scale);
+};
+
+#endif // FIRE_PALETTE_H
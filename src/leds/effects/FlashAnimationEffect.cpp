@@ -0,0 +1,76 @@
+// src/leds/effects/FlashAnimationEffect.cpp
+#include "FlashAnimationEffect.h"
+
+FlashAnimationEffect::FlashAnimationEffect(LEDController& ledController, const char* partitionLabel) :
+    Effect(ledController),
+    startTime(now()),
+    shownFrame(NO_FRAME),
+    shownTarget(nullptr),
+    ringShown(false)
+{
+    animation.open(partitionLabel);
+}
+
+void FlashAnimationEffect::reset() {
+    Effect::reset();
+    startTime = now();  // Same clock as the frame index in render()
+    shownFrame = NO_FRAME;
+}
+
+void FlashAnimationEffect::render() {
+    bool drawRing = !skipRing;
+    bool sameTarget = (target == shownTarget && drawRing == ringShown);
+
+    if (!animation.isOpen()) {
+        // Nothing to play - clear the target once and keep it dark
+        if (sameTarget && shownFrame == NO_FRAME) {
+            skipFrame();
+            return;
+        }
+        fill_solid(target->getCore(), LED_STRIP_CORE_COUNT, CRGB::Black);
+        fill_solid(target->getInner(), LED_STRIP_INNER_COUNT, CRGB::Black);
+        fill_solid(target->getOuter(), LED_STRIP_OUTER_COUNT, CRGB::Black);
+        if (drawRing) {
+            fill_solid(target->getRing(), LED_STRIP_RING_COUNT, CRGB::Black);
+        }
+        shownTarget = target;
+        ringShown = drawRing;
+        shownFrame = NO_FRAME;
+        return;
+    }
+
+    // Which frame belongs to this moment
+    uint32_t frameCount = animation.getFrameCount();
+    uint32_t tick = (now() - startTime) / animation.getFrameMs();
+    uint32_t frame = animation.loops() ? tick % frameCount : min(tick, frameCount - 1);
+
+    bool inPlace = sameTarget && shownFrame != NO_FRAME;
+    if (inPlace && frame == shownFrame) {
+        // Still the same frame - nothing to decode and nothing new to show
+        skipFrame();
+        return;
+    }
+
+    bool ok = true;
+    if (inPlace && frame > shownFrame) {
+        // Carry on from the frame already in the target (usually just the next one)
+        for (uint32_t f = shownFrame + 1; f <= frame && ok; f++) {
+            ok = animation.decode(f, *target, drawRing);
+        }
+    } else {
+        // Looped, or the target holds something else
+        ok = animation.seek(frame, *target, drawRing);
+    }
+
+    if (!ok) {
+        Serial.println("Animation frame is damaged - stopping playback");
+        animation.close();
+        shownFrame = NO_FRAME;
+        shownTarget = nullptr;
+        return;
+    }
+
+    shownFrame = frame;
+    shownTarget = target;
+    ringShown = drawRing;
+}
@@ -0,0 +1,62 @@
+// src/leds/effects/FlashAnimationEffect.h
+#ifndef FLASH_ANIMATION_EFFECT_H
+#define FLASH_ANIMATION_EFFECT_H
+
+#include "Effect.h"
+#include "../FlashAnimation.h"
+
+/**
+ * FlashAnimationEffect - Plays a pre-rendered animation from flash
+ *
+ * Show pieces too heavy to simulate live are recorded once (see
+ * tools/animation), encoded and written to the animation partition. This
+ * effect only decodes them: each frame costs a few hundred bytes of
+ * flash reads, whatever the original effect cost to draw.
+ *
+ * Frames are decoded straight into the target. Most frames are deltas
+ * that only change a few LEDs, so as long as the same target is used the
+ * effect just carries on from the frame already in it. A new target (a
+ * transition starting, the ring coming back from button feedback) is
+ * brought up to date from the nearest key frame.
+ *
+ * SmartLantern only lists it in Animated mode while the partition holds an
+ * animation (EFFECT_NEEDS_ANIMATION). Built anyway without one - or once
+ * a damaged frame stops playback - it stays dark.
+ */
+class FlashAnimationEffect : public Effect {
+public:
+    /**
+     * Constructor - maps the animation
+     * @param ledController Reference to the LED controller
+     * @param partitionLabel Flash partition holding the animation
+     */
+    FlashAnimationEffect(LEDController& ledController, const char* partitionLabel = ANIMATION_PARTITION);
+
+    /**
+     * Reset the effect - plays from the first frame again
+     */
+    void reset() override;
+
+    /**
+     * Get the name of this effect
+     * @return Effect name for display/debugging
+     */
+    const char* getName() const override { return "Flash Animation"; }
+
+private:
+    /**
+     * Decode the frame for the current time, if it is not the one already shown
+     */
+    void render() override;
+
+    // No frame in the target yet
+    static const uint32_t NO_FRAME = 0xFFFFFFFF;
+
+    FlashAnimation animation;
+    unsigned long startTime;         // When playback started (ms)
+    uint32_t shownFrame;             // Frame currently in shownTarget
+    RenderTarget* shownTarget;       // Target the last frame was decoded into
+    bool ringShown;                  // Whether the ring was decoded along with it
+};
+
+#endif // FLASH_ANIMATION_EFFECT_H
@@ -4,7 +4,6 @@
 
 FutureEffect::FutureEffect(LEDController& ledController) :
     Effect(ledController),
-    lastUpdateTime(0),
     breathingPhase(0.0f),
     colorFadePhase(0.0f),  // Initialize color fade phase
     unpredictableBreathingPhase(0.0f),
@@ -117,23 +116,23 @@ void FutureEffect::reset() {
     Serial.println("FutureEffect reset - all trails cleared");
 }
 
-void FutureEffect::update() {
+void FutureEffect::render() {
     // Target 120 FPS for ultra-smooth trail animation
-    if (!shouldUpdate(8)) {  // 8ms = 125 FPS
+    if (!beginFrame(8, REFERENCE_FRAME_MS)) {  // 8ms = 125 FPS
         return;
     }
 
     // Clear all strips first
-    leds.clearAll();
+    target->clearAll();
 
     // Update breathing phase for core (predictable)
-    breathingPhase += BREATHING_SPEED;
+    breathingPhase += BREATHING_SPEED * frameStep;
     if (breathingPhase > 2.0f * PI) {
         breathingPhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
     }
 
     // Update color fade phase (slower than breathing for subtle effect)
-    colorFadePhase += COLOR_FADE_SPEED;
+    colorFadePhase += COLOR_FADE_SPEED * frameStep;
     if (colorFadePhase > 2.0f * PI) {
         colorFadePhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
     }
@@ -142,7 +141,7 @@ void FutureEffect::update() {
     updateUnpredictableBreathing();
 
     // Randomly create new trails
-    if (random(100) < TRAIL_CREATE_CHANCE) {
+    if (frameChance(TRAIL_CREATE_CHANCE / 100.0f)) {
         createNewTrail();
     }
 
@@ -154,9 +153,6 @@ void FutureEffect::update() {
 
     // Apply breathing effect on top of trails
     applyBreathingEffect();
-
-    // Show all the changes
-    leds.showAll();
 }
 
 CRGB FutureEffect::getCurrentBlueColor() {
@@ -164,21 +160,8 @@ CRGB FutureEffect::getCurrentBlueColor() {
     float sineValue = sin(colorFadePhase);          // -1.0 to 1.0
     float normalizedSine = (sineValue + 1.0f) / 2.0f;  // 0.0 to 1.0
 
-    // Extract color components from both blues
-    uint8_t electricR = (ELECTRIC_BLUE_RGB >> 16) & 0xFF;  // 3
-    uint8_t electricG = (ELECTRIC_BLUE_RGB >> 8) & 0xFF;   // 215
-    uint8_t electricB = ELECTRIC_BLUE_RGB & 0xFF;          // 252
-
-    uint8_t deepR = (DEEP_BLUE_RGB >> 16) & 0xFF;  // 0
-    uint8_t deepG = (DEEP_BLUE_RGB >> 8) & 0xFF;   // 128
-    uint8_t deepB = DEEP_BLUE_RGB & 0xFF;          // 255
-
     // Interpolate between the two colors
-    uint8_t currentR = electricR + (deepR - electricR) * normalizedSine;
-    uint8_t currentG = electricG + (deepG - electricG) * normalizedSine;
-    uint8_t currentB = electricB + (deepB - electricB) * normalizedSine;
-
-    return CRGB(currentR, currentG, currentB);
+    return Colors::mix(Colors::fromHex(ELECTRIC_BLUE_RGB), Colors::fromHex(DEEP_BLUE_RGB), normalizedSine);
 }
 
 void FutureEffect::updateUnpredictableBreathing() {
@@ -190,19 +173,19 @@ void FutureEffect::updateUnpredictableBreathing() {
 
         // Randomly change breathing speed
         unpredictableBreathingSpeed = MIN_BREATHING_SPEED +
-            (random(100) / 100.0f) * (MAX_BREATHING_SPEED - MIN_BREATHING_SPEED);
+            (rng.range(100) / 100.0f) * (MAX_BREATHING_SPEED - MIN_BREATHING_SPEED);
 
         // Randomly set a new target brightness (25% to 90% - INCREASED RANGE)
-        unpredictableBreathingTarget = 0.25f + (random(66) / 100.0f); // 0.25 to 0.90
+        unpredictableBreathingTarget = 0.25f + (rng.range(66) / 100.0f); // 0.25 to 0.90
 
         // Occasionally add a "glitch" - sudden jump to random brightness
-        if (random(100) < 20) { // 20% chance of glitch
-            unpredictableBreathingCurrent = 0.25f + (random(66) / 100.0f);
+        if (rng.chance(20, 100)) { // 20% chance of glitch
+            unpredictableBreathingCurrent = 0.25f + (rng.range(66) / 100.0f);
         }
     }
 
     // Update breathing phase with current speed
-    unpredictableBreathingPhase += unpredictableBreathingSpeed;
+    unpredictableBreathingPhase += unpredictableBreathingSpeed * frameStep;
     if (unpredictableBreathingPhase > 2.0f * PI) {
         unpredictableBreathingPhase -= 2.0f * PI;
     }
@@ -219,7 +202,7 @@ void FutureEffect::updateUnpredictableBreathing() {
                               ((0.25f + normalizedSine * 0.65f) * sineInfluence);
 
     // Smooth transition to desired brightness
-    float transitionSpeed = 0.05f;
+    float transitionSpeed = 0.05f * frameStep;
     if (unpredictableBreathingCurrent < desiredBrightness) {
         unpredictableBreathingCurrent += transitionSpeed;
         if (unpredictableBreathingCurrent > desiredBrightness) {
@@ -237,30 +220,39 @@ void FutureEffect::updateUnpredictableBreathing() {
 }
 
 void FutureEffect::createNewTrail() {
+    // Fewer trails at reduced quality - the ones already running still finish
+    int activeTrails = 0;
+    for (const auto& trail : trails) {
+        if (trail.isActive) activeTrails++;
+    }
+    if (activeTrails >= qualityBudget(MAX_TRAILS)) {
+        return;
+    }
+
     // Find an inactive trail slot to use
     for (auto& trail : trails) {
         if (!trail.isActive) {
             // Initialize this trail with random properties
 
             // Randomly choose inner (1) or outer (2) strips
-            trail.stripType = random(1, 3);  // 1 or 2
+            trail.stripType = rng.range(1, 3);  // 1 or 2
 
             // Randomly choose which segment (0, 1, or 2)
-            trail.subStrip = random(3);
+            trail.subStrip = rng.range(3);
 
             // Start at the bottom of the strip
             trail.position = 0.0f;
 
             // Random initial speed (all trails start relatively slow)
             trail.speed = MIN_INITIAL_SPEED +
-                         (random(100) / 100.0f) * (MAX_INITIAL_SPEED - MIN_INITIAL_SPEED);
+                         (rng.range(100) / 100.0f) * (MAX_INITIAL_SPEED - MIN_INITIAL_SPEED);
 
             // Random acceleration (determines how quickly it speeds up)
             trail.acceleration = MIN_ACCELERATION +
-                               (random(100) / 100.0f) * (MAX_ACCELERATION - MIN_ACCELERATION);
+                               (rng.range(100) / 100.0f) * (MAX_ACCELERATION - MIN_ACCELERATION);
 
             // Random trail length
-            trail.trailLength = random(MIN_TRAIL_LENGTH, MAX_TRAIL_LENGTH + 1);
+            trail.trailLength = rng.range(MIN_TRAIL_LENGTH, MAX_TRAIL_LENGTH + 1);
 
             // Activate the trail
             trail.isActive = true;
@@ -277,7 +269,7 @@ void FutureEffect::updateTrails() {
         if (!trail.isActive) continue;
 
         // Apply acceleration to speed (physics!)
-        trail.speed += trail.acceleration;
+        trail.speed += trail.acceleration * frameStep;
 
         // Cap the maximum speed to prevent trails from becoming too fast
         if (trail.speed > MAX_SPEED) {
@@ -285,7 +277,7 @@ void FutureEffect::updateTrails() {
         }
 
         // Move the trail upward by its current speed
-        trail.position += trail.speed;
+        trail.position += trail.speed * frameStep;
 
         // Get strip length to check if trail has gone off the top
         int stripLength = getStripLength(trail.stripType);
@@ -385,13 +377,13 @@ void FutureEffect::drawTrails() {
                 // Inner strip
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
                     // Add color to existing color for blending
-                    leds.getInner()[physicalPos] += color;
+                    target->getInner()[physicalPos] += color;
                 }
             } else {
                 // Outer strip
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
                     // Add color to existing color for blending
-                    leds.getOuter()[physicalPos] += color;
+                    target->getOuter()[physicalPos] += color;
                 }
             }
         }
@@ -402,7 +394,7 @@ void FutureEffect::drawTrails() {
 
     // Limit inner strip brightness MORE aggressively
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        CRGB& pixel = leds.getInner()[i];
+        CRGB& pixel = target->getInner()[i];
         // Find the maximum color component
         uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
         // If any component is oversaturated, scale all components down proportionally
@@ -416,7 +408,7 @@ void FutureEffect::drawTrails() {
 
     // Limit outer strip brightness MORE aggressively
     for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        CRGB& pixel = leds.getOuter()[i];
+        CRGB& pixel = target->getOuter()[i];
         // Find the maximum color component
         uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
         // If any component is oversaturated, scale all components down proportionally
@@ -467,7 +459,7 @@ void FutureEffect::applyBreathingEffect() {
             currentBlueColor.b * finalIntensity
         );
 
-        leds.getCore()[i] = coreColor;
+        target->getCore()[i] = coreColor;
     }
 
     // Apply unpredictable breathing overlay to inner strips (25% to 90% - INCREASED)
@@ -489,7 +481,7 @@ void FutureEffect::applyBreathingEffect() {
         );
 
         // Use more aggressive blending - REPLACE more than ADD
-        CRGB& pixel = leds.getInner()[i];
+        CRGB& pixel = target->getInner()[i];
 
         // Blend with higher weight on the blue overlay
         float blueWeight = 0.7f;  // 70% blue overlay
@@ -525,7 +517,7 @@ void FutureEffect::applyBreathingEffect() {
         );
 
         // Use more aggressive blending - REPLACE more than ADD
-        CRGB& pixel = leds.getOuter()[i];
+        CRGB& pixel = target->getOuter()[i];
 
         // Blend with higher weight on the blue overlay
         float blueWeight = 0.7f;  // 70% blue overlay
@@ -568,7 +560,7 @@ void FutureEffect::applyBreathingEffect() {
                 currentBlueColor.b * finalIntensity
             );
 
-            leds.getRing()[i] = ringColor;
+            target->getRing()[i] = ringColor;
         }
     }
 }
@@ -586,7 +578,7 @@ void FutureEffect::updateRingSparkles() {
     // Update each LED's sparkle state
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
         // Random chance to start a new sparkle
-        if (ringSparkleValues[i] < 0.1f && random(1000) < (SPARKLE_CHANCE * 1000)) {
+        if (ringSparkleValues[i] < 0.1f && rng.range(1000) < (SPARKLE_CHANCE * 1000)) {
             // Start a new sparkle at full sparkle value
             ringSparkleValues[i] = 1.0f;
         } else {
@@ -614,14 +606,14 @@ void FutureEffect::updateShimmer() {
     // Update shimmer values for each core LED
     for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
         // Higher chance for each LED to shimmer (50% instead of 30%)
-        if (random(100) < 50) {  // 50% chance per frame for each LED to change
+        if (rng.chance(50, 100)) {  // 50% chance per frame for each LED to change
             // Create more dramatic shimmer effect with values between 0.4 and 1.6
             // This creates a ±60% brightness variation (much more noticeable)
-            coreShimmerValues[i] = 0.4f + (random(120) / 100.0f);  // 0.4 to 1.6
+            coreShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);  // 0.4 to 1.6
 
             // Occasionally create super bright flashes (10% chance)
-            if (random(100) < 10) {
-                coreShimmerValues[i] = 1.8f + (random(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
+            if (rng.chance(10, 100)) {
+                coreShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
             }
         } else {
             // Faster return to normal brightness for more active shimmering
@@ -638,13 +630,13 @@ void FutureEffect::updateShimmer() {
     // Update shimmer values for each inner LED
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
         // Same shimmer behavior as core but for inner strips
-        if (random(100) < 50) {  // 50% chance per frame for each LED to change
+        if (rng.chance(50, 100)) {  // 50% chance per frame for each LED to change
             // Create shimmer effect with values between 0.4 and 1.6
-            innerShimmerValues[i] = 0.4f + (random(120) / 100.0f);  // 0.4 to 1.6
+            innerShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);  // 0.4 to 1.6
 
             // Occasionally create super bright flashes (10% chance)
-            if (random(100) < 10) {
-                innerShimmerValues[i] = 1.8f + (random(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
+            if (rng.chance(10, 100)) {
+                innerShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
             }
         } else {
             // Return to normal brightness
@@ -661,13 +653,13 @@ void FutureEffect::updateShimmer() {
     // Update shimmer values for each outer LED
     for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
         // Same shimmer behavior as core but for outer strips
-        if (random(100) < 50) {  // 50% chance per frame for each LED to change
+        if (rng.chance(50, 100)) {  // 50% chance per frame for each LED to change
             // Create shimmer effect with values between 0.4 and 1.6
-            outerShimmerValues[i] = 0.4f + (random(120) / 100.0f);  // 0.4 to 1.6
+            outerShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);  // 0.4 to 1.6
 
             // Occasionally create super bright flashes (10% chance)
-            if (random(100) < 10) {
-                outerShimmerValues[i] = 1.8f + (random(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
+            if (rng.chance(10, 100)) {
+                outerShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
             }
         } else {
             // Return to normal brightness
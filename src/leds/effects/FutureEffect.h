@@ -45,12 +45,6 @@ public:
      */
     ~FutureEffect();
 
-    /**
-     * Update the effect animation each frame
-     * Handles trail creation, movement, and rendering
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Clears all active trails
@@ -61,9 +55,15 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Future Effect"; }
+    const char* getName() const override { return "Future Effect"; }
 
 private:
+    /**
+     * Update the effect animation each frame
+     * Handles trail creation, movement, and rendering
+     */
+    void render() override;
+
     // Collection of all trails (both active and inactive)
     std::vector<FutureTrail> trails;
 
@@ -83,11 +83,12 @@ private:
     static constexpr float MAX_SPEED = 0.9f;             // Terminal velocity
 
     // Color definitions - two blues to fade between
-    static const uint32_t ELECTRIC_BLUE_RGB = 0x03d7fc;  // Electric blue color (original)
-    static const uint32_t DEEP_BLUE_RGB = 0x0080ff;      // Deeper, more saturated blue
+    static constexpr uint32_t ELECTRIC_BLUE_RGB = 0x03d7fc;  // Electric blue color (original)
+    static constexpr uint32_t DEEP_BLUE_RGB = 0x0080ff;      // Deeper, more saturated blue
 
-    // Timing
-    unsigned long lastUpdateTime;
+    // Timing - the per-frame chances, speeds and accelerations here are tuned for
+    // 8ms frames and scaled by frameStep, so other frame rates give the same motion
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;
 
     // Core breathing effect variables (predictable)
     float breathingPhase;               // Current phase of breathing cycle (0.0 to 2*PI)
@@ -1,10 +1,10 @@
 // src/leds/effects/FutureRainbowEffect.cpp
 
 #include "FutureRainbowEffect.h"
+#include "../HSVKernel.h"
 
 FutureRainbowEffect::FutureRainbowEffect(LEDController& ledController) :
     Effect(ledController),
-    lastUpdateTime(0),
     rainbowPhase(0.0f),
     saturationPhase(0.0f),
     effectStartTime(millis()),
@@ -111,14 +111,14 @@ void FutureRainbowEffect::reset() {
     Serial.println("FutureRainbowEffect reset - all trails cleared");
 }
 
-void FutureRainbowEffect::update() {
+void FutureRainbowEffect::render() {
     // Target 120 FPS for ultra-smooth trail animation
-    if (!shouldUpdate(8)) {  // 8ms = 125 FPS
+    if (!beginFrame(8, REFERENCE_FRAME_MS)) {  // 8ms = 125 FPS
         return;
     }
 
     // Clear all strips first
-    leds.clearAll();
+    target->clearAll();
 
     // Update rainbow phase based on elapsed time (30-second cycle)
     unsigned long currentTime = millis();
@@ -130,7 +130,7 @@ void FutureRainbowEffect::update() {
     saturationPhase = (saturationElapsed / SATURATION_CYCLE_TIME) * 2.0f * PI;
 
     // Update breathing phase for core (predictable)
-    breathingPhase += BREATHING_SPEED;
+    breathingPhase += BREATHING_SPEED * frameStep;
     if (breathingPhase > 2.0f * PI) {
         breathingPhase -= 2.0f * PI;
     }
@@ -139,7 +139,7 @@ void FutureRainbowEffect::update() {
     updateUnpredictableBreathing();
 
     // Randomly create new trails
-    if (random(100) < TRAIL_CREATE_CHANCE) {
+    if (frameChance(TRAIL_CREATE_CHANCE / 100.0f)) {
         createNewTrail();
     }
 
@@ -154,9 +154,6 @@ void FutureRainbowEffect::update() {
 
     // Apply white wave overlay on top of breathing effect
     applyWhiteWaveOverlay();
-
-    // Show all the changes
-    leds.showAll();
 }
 
 CRGB FutureRainbowEffect::getCurrentRainbowColor() {
@@ -164,7 +161,7 @@ CRGB FutureRainbowEffect::getCurrentRainbowColor() {
     uint8_t hue = (uint8_t)(rainbowPhase * 255);
 
     // Return full saturation, full brightness rainbow color
-    return CHSV(hue, 255, 255);
+    return HSVKernel::rainbow(hue);
 }
 
 uint8_t FutureRainbowEffect::getCurrentOuterSaturation() {
@@ -178,18 +175,27 @@ uint8_t FutureRainbowEffect::getCurrentOuterSaturation() {
 }
 
 void FutureRainbowEffect::createNewTrail() {
+    // Fewer trails at reduced quality - the ones already running still finish
+    int activeTrails = 0;
+    for (const auto& trail : trails) {
+        if (trail.isActive) activeTrails++;
+    }
+    if (activeTrails >= qualityBudget(MAX_TRAILS)) {
+        return;
+    }
+
     // Find an inactive trail slot to use
     for (auto& trail : trails) {
         if (!trail.isActive) {
             // Initialize this trail with random properties
-            trail.stripType = random(1, 3);  // 1 or 2
-            trail.subStrip = random(3);
+            trail.stripType = rng.range(1, 3);  // 1 or 2
+            trail.subStrip = rng.range(3);
             trail.position = 0.0f;
             trail.speed = MIN_INITIAL_SPEED +
-                         (random(100) / 100.0f) * (MAX_INITIAL_SPEED - MIN_INITIAL_SPEED);
+                         (rng.range(100) / 100.0f) * (MAX_INITIAL_SPEED - MIN_INITIAL_SPEED);
             trail.acceleration = MIN_ACCELERATION +
-                               (random(100) / 100.0f) * (MAX_ACCELERATION - MIN_ACCELERATION);
-            trail.trailLength = random(MIN_TRAIL_LENGTH, MAX_TRAIL_LENGTH + 1);
+                               (rng.range(100) / 100.0f) * (MAX_ACCELERATION - MIN_ACCELERATION);
+            trail.trailLength = rng.range(MIN_TRAIL_LENGTH, MAX_TRAIL_LENGTH + 1);
             trail.creationTime = rainbowPhase; // Store current rainbow phase when created
             trail.isActive = true;
 
@@ -204,7 +210,7 @@ void FutureRainbowEffect::updateTrails() {
         if (!trail.isActive) continue;
 
         // Apply acceleration to speed
-        trail.speed += trail.acceleration;
+        trail.speed += trail.acceleration * frameStep;
 
         // Cap the maximum speed
         if (trail.speed > MAX_SPEED) {
@@ -212,7 +218,7 @@ void FutureRainbowEffect::updateTrails() {
         }
 
         // Move the trail upward
-        trail.position += trail.speed;
+        trail.position += trail.speed * frameStep;
 
         // Get strip length to check if trail has gone off the top
         int stripLength = getStripLength(trail.stripType);
@@ -291,12 +297,12 @@ void FutureRainbowEffect::drawTrails() {
             if (trail.stripType == 1) { // Inner strips
                 int globalIndex = trail.subStrip * INNER_LEDS_PER_STRIP + pixelPos;
                 if (globalIndex < LED_STRIP_INNER_COUNT) {
-                    leds.getInner()[globalIndex] = color;
+                    target->getInner()[globalIndex] = color;
                 }
             } else if (trail.stripType == 2) { // Outer strips
                 int globalIndex = trail.subStrip * OUTER_LEDS_PER_STRIP + pixelPos;
                 if (globalIndex < LED_STRIP_OUTER_COUNT) {
-                    leds.getOuter()[globalIndex] = color;
+                    target->getOuter()[globalIndex] = color;
                 }
             }
         }
@@ -322,6 +328,9 @@ void FutureRainbowEffect::applyBreathingEffect() {
     // Calculate base hue for the gradient (0-255 range)
     uint8_t baseHue = (uint8_t)(rainbowPhase * 255);
 
+    // Full-saturation rainbow colors come straight from the shared palette
+    const CRGB* rainbowColors = HSVKernel::rainbowPalette();
+
     // Calculate core breathing intensity using sine wave (predictable)
     float sineValue = sin(breathingPhase);
     float normalizedSine = (sineValue + 1.0f) / 2.0f; // 0.0 to 1.0
@@ -336,7 +345,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
         uint8_t pixelHue = baseHue + hueOffset;
 
         // Create color for this pixel
-        CRGB rainbowColor = CHSV(pixelHue, 255, 255);
+        CRGB rainbowColor = rainbowColors[pixelHue];
 
         // Apply shimmer and breathing
         float shimmerMultiplier = coreShimmerValues[i];
@@ -349,7 +358,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
             rainbowColor.b * finalIntensity
         );
 
-        leds.getCore()[i] = coreColor;
+        target->getCore()[i] = coreColor;
     }
 
     // Apply unpredictable breathing overlay to inner strips (25% to 90%)
@@ -369,7 +378,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
         uint8_t pixelHue = baseHue + hueOffset;
 
         // Create rainbow color for this pixel
-        CRGB innerRainbowColor = CHSV(pixelHue, 255, 255);
+        CRGB innerRainbowColor = rainbowColors[pixelHue];
 
         // Apply shimmer and breathing intensity
         float shimmerMultiplier = innerShimmerValues[i];
@@ -383,7 +392,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
         );
 
         // Blend with existing trail color
-        CRGB& pixel = leds.getInner()[i];
+        CRGB& pixel = target->getInner()[i];
         float rainbowWeight = 0.7f;  // 70% rainbow overlay
         float trailWeight = 0.3f;    // 30% original trail
 
@@ -416,7 +425,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
         uint8_t pixelHue = baseHue + hueOffset;
 
         // Create rainbow color with cycling saturation
-        CRGB outerRainbowColor = CHSV(pixelHue, outerSaturation, 255);
+        CRGB outerRainbowColor = HSVKernel::hsv(pixelHue, outerSaturation, 255);
 
         // Apply shimmer and breathing intensity
         float shimmerMultiplier = outerShimmerValues[i];
@@ -430,7 +439,7 @@ void FutureRainbowEffect::applyBreathingEffect() {
         );
 
         // Blend with existing trail color
-        CRGB& pixel = leds.getOuter()[i];
+        CRGB& pixel = target->getOuter()[i];
         float rainbowWeight = 0.7f;  // 70% rainbow overlay
         float trailWeight = 0.3f;    // 30% original trail
 
@@ -457,14 +466,14 @@ void FutureRainbowEffect::applyBreathingEffect() {
     // Apply sparkles with random gradient colors to ring
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
         // Generate a random position in the gradient range for this LED
-        float randomPosition = (float)random(100) / 100.0f; // 0.0 to 1.0
+        float randomPosition = (float)rng.range(100) / 100.0f; // 0.0 to 1.0
 
         // Calculate hue for this random position (matching the gradient pattern)
         uint8_t hueOffset = (uint8_t)((1.0f - randomPosition) * 51); // 20% of 255, reversed
         uint8_t pixelHue = baseHue + hueOffset;
 
         // Create rainbow color for this pixel
-        CRGB rainbowColor = CHSV(pixelHue, 255, 255);
+        CRGB rainbowColor = rainbowColors[pixelHue];
 
         // Apply sparkle multiplier AND breathing intensity
         float sparkleMultiplier = ringSparkleValues[i];
@@ -482,13 +491,13 @@ void FutureRainbowEffect::applyBreathingEffect() {
             rainbowColor.b * finalIntensity
         );
 
-        leds.getRing()[i] = ringColor;
+        target->getRing()[i] = ringColor;
     }
 }
 
 void FutureRainbowEffect::applyWhiteWaveOverlay() {
     // Update white wave position
-    whiteWavePosition += WHITE_WAVE_SPEED;
+    whiteWavePosition += WHITE_WAVE_SPEED * frameStep;
 
     // Reset wave when it completely passes off the end of the strip
     if (whiteWavePosition >= LED_STRIP_CORE_COUNT + WHITE_WAVE_LENGTH) {
@@ -496,7 +505,8 @@ void FutureRainbowEffect::applyWhiteWaveOverlay() {
     }
 
     // Apply rainbow gradient wave overlay to core strip
-    CRGB* coreStrip = leds.getCore();
+    CRGB* coreStrip = target->getCore();
+    const CRGB* rainbowColors = HSVKernel::rainbowPalette();
 
     // Calculate base hue for the gradient (same as inner/outer strips)
     uint8_t baseHue = (uint8_t)(rainbowPhase * 255);
@@ -540,7 +550,7 @@ void FutureRainbowEffect::applyWhiteWaveOverlay() {
         uint8_t pixelHue = baseHue + hueOffset;
 
         // Create rainbow color for this position (matching inner/outer gradient)
-        CRGB gradientColor = CHSV(pixelHue, 255, 255);
+        CRGB gradientColor = rainbowColors[pixelHue];
 
         // Get current LED color
         CRGB currentColor = coreStrip[ledIndex];
@@ -569,10 +579,10 @@ void FutureRainbowEffect::updateShimmer() {
 
     // Update shimmer values for each core LED
     for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-        if (random(100) < 50) {
-            coreShimmerValues[i] = 0.4f + (random(120) / 100.0f); // 0.4 to 1.6
-            if (random(100) < 10) {
-                coreShimmerValues[i] = 1.8f + (random(40) / 100.0f); // 1.8 to 2.2 for bright flashes
+        if (rng.chance(50, 100)) {
+            coreShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f); // 0.4 to 1.6
+            if (rng.chance(10, 100)) {
+                coreShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f); // 1.8 to 2.2 for bright flashes
             }
         } else {
             if (coreShimmerValues[i] < 1.0f) {
@@ -587,10 +597,10 @@ void FutureRainbowEffect::updateShimmer() {
 
     // Update shimmer values for inner and outer LEDs (same logic)
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        if (random(100) < 50) {
-            innerShimmerValues[i] = 0.4f + (random(120) / 100.0f);
-            if (random(100) < 10) {
-                innerShimmerValues[i] = 1.8f + (random(40) / 100.0f);
+        if (rng.chance(50, 100)) {
+            innerShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);
+            if (rng.chance(10, 100)) {
+                innerShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);
             }
         } else {
             if (innerShimmerValues[i] < 1.0f) {
@@ -604,10 +614,10 @@ void FutureRainbowEffect::updateShimmer() {
     }
 
     for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        if (random(100) < 50) {
-            outerShimmerValues[i] = 0.4f + (random(120) / 100.0f);
-            if (random(100) < 10) {
-                outerShimmerValues[i] = 1.8f + (random(40) / 100.0f);
+        if (rng.chance(50, 100)) {
+            outerShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);
+            if (rng.chance(10, 100)) {
+                outerShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);
             }
         } else {
             if (outerShimmerValues[i] < 1.0f) {
@@ -634,7 +644,7 @@ void FutureRainbowEffect::updateRingSparkles() {
     // Update each LED's sparkle state
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
         // Random chance to start a new sparkle (reduced chance)
-        if (ringSparkleValues[i] < 0.1f && random(1000) < (SPARKLE_CHANCE * 1000)) {
+        if (ringSparkleValues[i] < 0.1f && rng.range(1000) < (SPARKLE_CHANCE * 1000)) {
             // Start a new sparkle at full sparkle value (not full brightness anymore)
             ringSparkleValues[i] = 1.0f;
         } else {
@@ -658,19 +668,19 @@ void FutureRainbowEffect::updateUnpredictableBreathing() {
 
         // Randomly change breathing speed
         unpredictableBreathingSpeed = 0.005f +
-            (random(100) / 100.0f) * (0.02f - 0.005f); // MIN_BREATHING_SPEED to MAX_BREATHING_SPEED
+            (rng.range(100) / 100.0f) * (0.02f - 0.005f); // MIN_BREATHING_SPEED to MAX_BREATHING_SPEED
 
         // Randomly set a new target brightness (25% to 90%)
-        unpredictableBreathingTarget = 0.25f + (random(66) / 100.0f);
+        unpredictableBreathingTarget = 0.25f + (rng.range(66) / 100.0f);
 
         // Occasionally add a "glitch"
-        if (random(100) < 20) {
-            unpredictableBreathingCurrent = 0.25f + (random(66) / 100.0f);
+        if (rng.chance(20, 100)) {
+            unpredictableBreathingCurrent = 0.25f + (rng.range(66) / 100.0f);
         }
     }
 
     // Update breathing phase with current speed
-    unpredictableBreathingPhase += unpredictableBreathingSpeed;
+    unpredictableBreathingPhase += unpredictableBreathingSpeed * frameStep;
     if (unpredictableBreathingPhase > 2.0f * PI) {
         unpredictableBreathingPhase -= 2.0f * PI;
     }
@@ -687,7 +697,7 @@ void FutureRainbowEffect::updateUnpredictableBreathing() {
                               ((0.25f + normalizedSine * 0.65f) * sineInfluence);
 
     // Smooth transition to desired brightness
-    float transitionSpeed = 0.05f;
+    float transitionSpeed = 0.05f * frameStep;
     if (unpredictableBreathingCurrent < desiredBrightness) {
         unpredictableBreathingCurrent += transitionSpeed;
         if (unpredictableBreathingCurrent > desiredBrightness) {
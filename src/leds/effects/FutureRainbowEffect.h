@@ -47,12 +47,6 @@ public:
      */
     ~FutureRainbowEffect();
 
-    /**
-     * Update the effect animation each frame
-     * Handles trail creation, movement, and rendering
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Clears all active trails
@@ -63,9 +57,15 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Future Rainbow Effect"; }
+    const char* getName() const override { return "Future Rainbow Effect"; }
 
 private:
+    /**
+     * Update the effect animation each frame
+     * Handles trail creation, movement, and rendering
+     */
+    void render() override;
+
     // Collection of all trails (both active and inactive)
     std::vector<FutureRainbowTrail> trails;
 
@@ -93,8 +93,8 @@ private:
     float saturationPhase;                           // Current position in saturation cycle (0.0 to 2*PI)
     static constexpr float SATURATION_CYCLE_TIME = 4000.0f; // 4 seconds in milliseconds
 
-    // Timing
-    unsigned long lastUpdateTime;
+    // Timing - per-frame chances and speeds are tuned for 8ms frames and scaled by frameStep
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;
 
     // Core breathing effect variables (predictable)
     float breathingPhase;                            // Current phase of breathing cycle (0.0 to 2*PI)
@@ -127,7 +127,7 @@ private:
     // Rainbow gradient wave overlay parameters for core strip
     float whiteWavePosition;                         // Current position of the rainbow wave (0.0 to LED_STRIP_CORE_COUNT)
     static constexpr int WHITE_WAVE_LENGTH = 60;    // Length of the rainbow wave in pixels
-    static constexpr float WHITE_WAVE_SPEED = 0.4f; // Speed of the wave movement (pixels per frame)
+    static constexpr float WHITE_WAVE_SPEED = 0.4f; // Speed of the wave movement (pixels per 8ms frame)
     static constexpr float WHITE_WAVE_BRIGHTNESS = 0.8f; // Maximum brightness of the rainbow wave
 
     /**
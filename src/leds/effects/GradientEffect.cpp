@@ -8,7 +8,8 @@ GradientEffect::GradientEffect(LEDController &ledController,
                                bool applyToCore,
                                bool applyToInner,
                                bool applyToOuter,
-                               bool applyToRing) : Effect(ledController) {
+                               bool applyToRing) : Effect(ledController),
+                                                   tablesDirty(true) {
     // Apply gradient to selected strips, leave others empty
     if (applyToCore) coreGradient = gradient;
     if (applyToInner) innerGradient = gradient;
@@ -25,73 +26,57 @@ GradientEffect::GradientEffect(LEDController &ledController,
                                                                coreGradient(coreGradient),
                                                                innerGradient(innerGradient),
                                                                outerGradient(outerGradient),
-                                                               ringGradient(ringGradient) {
+                                                               ringGradient(ringGradient),
+                                                               tablesDirty(true) {
     // No additional initialization needed
 }
 
-void GradientEffect::reset() {
-    // Nothing to reset for gradient effects
+// Apply the same gradient to every strip
+void GradientEffect::setAllGradients(const Gradient &gradient) {
+    coreGradient = gradient;
+    innerGradient = gradient;
+    outerGradient = gradient;
+    ringGradient = gradient;
+    tablesDirty = true;
+    invalidate();
 }
 
-// Main update method that applies gradients and fade overlay
-void GradientEffect::update() {
-    // Apply gradients to each strip type
-    applyGradient(leds.getCore(), LED_STRIP_CORE_COUNT, coreGradient);
-    applyGradient(leds.getInner(), LED_STRIP_INNER_COUNT, innerGradient);
-    applyGradient(leds.getOuter(), LED_STRIP_OUTER_COUNT, outerGradient);
-    
-    // Skip ring if disabled
-    if (!skipRing) {
-        applyGradient(leds.getRing(), LED_STRIP_RING_COUNT, ringGradient);
-    }
-
-    // Apply fade overlay to outer strips (now fades to 90% black instead of complete black)
-    applyOuterBlackFadeOverlay();
-
-    // Display all LED changes
-    leds.showAll();
+void GradientEffect::reset() {
+    // Nothing to reset for gradient effects - just draw the frame again
+    invalidate();
 }
 
-// Apply black fade overlay to outer strips for ambient lighting effect
-// MODIFIED: Now fades to 90% black (10% brightness) instead of complete black
-void GradientEffect::applyOuterBlackFadeOverlay() {
-    // Only apply fade if outer gradient is not empty (outer strips are active)
-    if (outerGradient.empty()) {
-        return;
+// Main update method that copies the compiled gradients to the strips
+void GradientEffect::render() {
+    // Recompile only when a gradient changed
+    if (tablesDirty) {
+        compileTables();
     }
 
-    // Apply fade overlay to each outer strip segment
-    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        int segmentStart = segment * OUTER_LEDS_PER_STRIP;
-
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            int ledIndex = segmentStart + i;
-
-            // Start fade at 45% up the strip (same as fire effects for consistency)
-            float fadeStartPosition = OUTER_LEDS_PER_STRIP * 0.45f;
+    // Copy the finished colors to each strip type
+    memcpy(target->getCore(), coreTable, sizeof(coreTable));
+    memcpy(target->getInner(), innerTable, sizeof(innerTable));
+    memcpy(target->getOuter(), outerTable, sizeof(outerTable));
 
-            if (i >= fadeStartPosition) {
-                // Calculate fade progress from fade start to top of strip
-                float fadeProgress = (float(i) - fadeStartPosition) / (OUTER_LEDS_PER_STRIP - fadeStartPosition);
-
-                // Apply cubic fade for smooth dramatic transition
-                fadeProgress = fadeProgress * fadeProgress * fadeProgress;
-
-                // Calculate fade factor: 1.0 = full brightness, 0.1 = 90% black (10% brightness)
-                // CHANGED: Minimum brightness is now 0.1 instead of 0.0
-                float fadeFactor = 1.0f - (fadeProgress * 0.9f);  // Fade from 1.0 to 0.1
+    // Skip ring if disabled
+    if (!skipRing) {
+        memcpy(target->getRing(), ringTable, sizeof(ringTable));
+    }
+}
 
-                // Apply fade to the existing LED color
-                leds.getOuter()[ledIndex].nscale8_video((uint8_t)(255 * fadeFactor));
+// Render all gradients once into the strip tables
+void GradientEffect::compileTables() {
+    applyGradient(coreTable, LED_STRIP_CORE_COUNT, coreGradient);
+    applyGradient(innerTable, LED_STRIP_INNER_COUNT, innerGradient);
+    applyGradient(outerTable, LED_STRIP_OUTER_COUNT, outerGradient);
+    applyGradient(ringTable, LED_STRIP_RING_COUNT, ringGradient);
 
-                // MODIFIED: Top 10% of strip fades to 90% black instead of complete black
-                if (i >= OUTER_LEDS_PER_STRIP * 0.90f) {
-                    // Scale the current color to 10% brightness (90% black)
-                    leds.getOuter()[ledIndex].nscale8_video(26);  // 26/255 ≈ 10% brightness
-                }
-            }
-        }
+    // Bake the ambient fade into the outer strips (fades to 90% black at the top)
+    if (!outerGradient.empty()) {
+        leds.applyMask(outerTable, LEDController::MASK_OUTER_SOFT_FADE);
     }
+
+    tablesDirty = false;
 }
 
 // Apply a gradient to any LED strip (maintains original segmented approach)
@@ -104,7 +89,7 @@ void GradientEffect::applyGradient(CRGB* strip, int count, const Gradient& gradi
 
     // If only one color in gradient, fill with that color
     if (gradient.size() == 1) {
-        fill_solid(strip, count, leds.neoColorToCRGB(gradient[0].color));
+        fill_solid(strip, count, gradient[0].color);
         return;
     }
 
@@ -190,9 +175,8 @@ void GradientEffect::applyGradientToPosition(CRGB* strip, int index, float posit
         }
     }
 
-    // Convert colors from uint32_t to CRGB
-    CRGB color1 = leds.neoColorToCRGB(gradient[lowerIndex].color);
-    CRGB color2 = leds.neoColorToCRGB(gradient[upperIndex].color);
+    const CRGB& color1 = gradient[lowerIndex].color;
+    const CRGB& color2 = gradient[upperIndex].color;
 
     // Calculate interpolation ratio
     float lowerPos = gradient[lowerIndex].position;
@@ -364,16 +348,13 @@ Gradient GradientEffect::createRainbowGradient(int numPoints) {
         // Convert HSV to RGB (full saturation and value)
         CRGB rgbColor = CHSV(hue, 255, 255);
 
-        // Convert to uint32_t format expected by GradientPoint
-        uint32_t color = ((uint32_t)rgbColor.r << 16) | ((uint32_t)rgbColor.g << 8) | rgbColor.b;
-
-        gradient.push_back(GradientPoint(color, position));
+        gradient.push_back(GradientPoint(rgbColor, position));
     }
 
     return gradient;
 }
 
 // Get the name of this effect (required by Effect base class)
-String GradientEffect::getName() const {
+const char* GradientEffect::getName() const {
     return "Gradient Effect";
 }
\ No newline at end of file
@@ -8,11 +8,12 @@
 
 // Structure to define a color at a specific position in a gradient
 struct GradientPoint {
-    uint32_t color;      // The color at this point (in 0xRRGGBB format)
+    CRGB color;          // The color at this point
     float position;      // Position (0.0 to 1.0) along the strip
 
-    // Constructor for easy initialization
-    GradientPoint(uint32_t c, float pos) : color(c), position(pos) {}
+    // Constructors for easy initialization - from a 0xRRGGBB code or a CRGB
+    GradientPoint(uint32_t hex, float pos) : color(Colors::fromHex(hex)), position(pos) {}
+    GradientPoint(const CRGB& c, float pos) : color(c), position(pos) {}
 };
 
 // Define a Gradient as a vector of gradient points
@@ -26,6 +27,9 @@ typedef std::vector<GradientPoint> Gradient;
  * for each strip type. The outer strips automatically get a fade-to-black overlay
  * for ambient lighting effects.
  *
+ * Gradients are compiled into a CRGB table per strip whenever they change,
+ * with the outer fade already applied, so drawing a frame is just a copy.
+ *
  * Features:
  * - Smooth color interpolation between gradient points
  * - Individual gradient control for each strip type
@@ -51,29 +55,29 @@ public:
                   const Gradient& outerGradient,
                   const Gradient& ringGradient);
 
-    /**
-     * Update the effect - applies gradients and fade overlay
-     * Called every frame to render the gradient effect
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * For gradients, there's nothing to reset since they're static
      */
     void reset() override;
 
+    /**
+     * Gradients only change when a setter is called
+     * @return Always true
+     */
+    bool isStatic() const override { return true; }
+
     /**
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override;
+    const char* getName() const override;
 
     // Setters for individual strip gradients (allows runtime changes)
-    void setCoreGradient(const Gradient& gradient) { coreGradient = gradient; }
-    void setInnerGradient(const Gradient& gradient) { innerGradient = gradient; }
-    void setOuterGradient(const Gradient& gradient) { outerGradient = gradient; }
-    void setRingGradient(const Gradient& gradient) { ringGradient = gradient; }
+    void setCoreGradient(const Gradient& gradient) { coreGradient = gradient; tablesDirty = true; invalidate(); }
+    void setInnerGradient(const Gradient& gradient) { innerGradient = gradient; tablesDirty = true; invalidate(); }
+    void setOuterGradient(const Gradient& gradient) { outerGradient = gradient; tablesDirty = true; invalidate(); }
+    void setRingGradient(const Gradient& gradient) { ringGradient = gradient; tablesDirty = true; invalidate(); }
 
     // Setter to apply the same gradient to all strips
     void setAllGradients(const Gradient& gradient);
@@ -94,19 +98,34 @@ public:
     static Gradient reverseGradient(const Gradient& gradient);
 
 private:
+    /**
+     * Update the effect - copies the compiled gradient tables to the strips
+     * Only called when the frame was invalidated; gradients are recompiled after a change
+     */
+    void render() override;
+
     // Individual gradients for each strip type
     Gradient coreGradient;
     Gradient innerGradient;
     Gradient outerGradient;
     Gradient ringGradient;
 
+    // Compiled colors for every LED of each strip (outer fade already applied)
+    CRGB coreTable[LED_STRIP_CORE_COUNT];
+    CRGB innerTable[LED_STRIP_INNER_COUNT];
+    CRGB outerTable[LED_STRIP_OUTER_COUNT];
+    CRGB ringTable[LED_STRIP_RING_COUNT];
+    bool tablesDirty;  // True when a gradient changed since the tables were compiled
+
+    /**
+     * Render every gradient into its strip table and bake in the outer fade
+     */
+    void compileTables();
+
     // Core gradient application methods
     void applyGradient(CRGB* strip, int count, const Gradient& gradient);
     void applyGradientToPosition(CRGB* strip, int index, float position, const Gradient& gradient);
 
-    // Special effect for outer strips - fades to 90% black for ambient lighting
-    void applyOuterBlackFadeOverlay();
-
     // Color interpolation helper
     CRGB interpolateColors(const CRGB& color1, const CRGB& color2, float ratio);
 };
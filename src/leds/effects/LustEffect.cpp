@@ -5,87 +5,66 @@
 
 LustEffect::LustEffect(LEDController& ledController)
     : Effect(ledController),
-      cycleStartTime(0),
-      breathingPhase(0.0f),
-      isFirstHalf(true),
       gradientOffset(0.0f),
-      colorSetStartTime(0)
+      colorSetStartTime(0),
+      frameColorSetBlend(0)
 {
     // Constructor initializes timing variables
     // Note: Not calling leds.clear() as requested to avoid wrecking code
-}
-
-void LustEffect::update() {
-    unsigned long currentTime = millis();
-
-    // Initialize cycle start times on first run
-    if (cycleStartTime == 0) {
-        cycleStartTime = currentTime;
-        colorSetStartTime = currentTime;
-    }
 
-    // Calculate elapsed time in current cycle
-    unsigned long elapsedTime = currentTime - cycleStartTime;
+    // The wave shape never changes, so compute it once for both color sets
+    buildWaveTables();
 
-    // Handle cycle completion and restart
-    if (elapsedTime >= CYCLE_DURATION) {
-        cycleStartTime = currentTime;
-        elapsedTime = 0;
+    // Outer strips fade to black from bottom to top
+    for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
+        float fadePosition = (float)i / (float)(OUTER_LEDS_PER_STRIP - 1);
+        outerFade[i] = (uint8_t)(255 * (1.0f - fadePosition)); // 255 at bottom (i=0), 0 at top (i=max)
     }
+}
 
-    // Determine which half of the cycle we're in
-    isFirstHalf = (elapsedTime < HALF_CYCLE);
+void LustEffect::render() {
+    // No frame rate cap - just measure the time step for the gradient movement
+    beginFrame(0, REFERENCE_FRAME_MS);
 
-    // Calculate breathing intensity using smooth sine wave
-    float intensity = calculateBreathingIntensity();
+    unsigned long currentTime = now();
 
-    // Calculate current color set blend ratio
-    float colorSetRatio = calculateColorSetBlendRatio();
+    // Initialize the color set cycle on first run
+    if (colorSetStartTime == 0) {
+        colorSetStartTime = currentTime;
+    }
 
-    // Get current colors based on animation
-    uint32_t hotColor, coolColor;
-    getCurrentColorSet(colorSetRatio, hotColor, coolColor);
+    // Calculate current color set blend ratio (0-255 for the per-LED blend)
+    frameColorSetBlend = (uint8_t)(calculateColorSetBlendRatio() * 255.0f);
 
-    // Update gradient animation offset
-    gradientOffset += GRADIENT_SPEED;
+    // Update gradient animation offset, wrapped to one wave so it never loses precision
+    gradientOffset += GRADIENT_SPEED * frameStep;
+    if (gradientOffset >= WAVE_LENGTH) {
+        gradientOffset -= WAVE_LENGTH;
+    }
 
-    // Update each strip with breathing effect
-    updateCoreBreathing(intensity, hotColor, coolColor);
-    updateInnerBreathing(intensity, hotColor, coolColor);
-    updateOuterBreathing(intensity, hotColor, coolColor);
-    updateRingBreathing(intensity, hotColor, coolColor);
+    // Update each strip with breathing effect - the strips are independent, so on both cores
+    renderStrips();
+}
 
-    // Display the updated colors
-    leds.showAll();
+void LustEffect::renderStrip(StripJob strip) {
+    switch (strip) {
+        case STRIP_JOB_CORE:  updateCoreBreathing(frameColorSetBlend); break;
+        case STRIP_JOB_INNER: updateInnerBreathing(frameColorSetBlend); break;
+        case STRIP_JOB_OUTER: updateOuterBreathing(frameColorSetBlend); break;
+        case STRIP_JOB_RING:  updateRingBreathing(frameColorSetBlend); break;
+        default: break;
+    }
 }
 
 void LustEffect::reset() {
     // Reset animation to beginning of cycle
-    cycleStartTime = millis();
-    breathingPhase = 0.0f;
-    isFirstHalf = true;
     gradientOffset = 0.0f;
-    colorSetStartTime = millis();
-}
-
-float LustEffect::calculateBreathingIntensity() {
-    unsigned long currentTime = millis();
-    unsigned long elapsedTime = currentTime - cycleStartTime;
-
-    // Calculate position within the 4-second cycle (0.0 to 1.0)
-    float cyclePosition = (float)elapsedTime / (float)CYCLE_DURATION;
-
-    // Use sine wave for smooth breathing effect
-    // Sin goes from 0 to 1 to 0 over full cycle
-    float sineValue = sin(cyclePosition * 2.0f * PI);
-
-    // Convert sine wave (-1 to 1) to breathing intensity (0 to 1)
-    // Absolute value ensures we always breathe "outward"
-    return abs(sineValue);
+    colorSetStartTime = now();
+    resetBakedLoop();
 }
 
 float LustEffect::calculateColorSetBlendRatio() {
-    unsigned long currentTime = millis();
+    unsigned long currentTime = now();
     unsigned long elapsedTime = currentTime - colorSetStartTime;
 
     // Calculate position within the 8-second color set cycle (0.0 to 1.0)
@@ -98,128 +77,79 @@ float LustEffect::calculateColorSetBlendRatio() {
     return (sineValue + 1.0f) * 0.5f;
 }
 
-void LustEffect::getCurrentColorSet(float colorSetRatio, uint32_t& hotColor, uint32_t& coolColor) {
-    // Blend between the two color sets based on the ratio
-    CRGB hotColorRGB = blendColors(HOT_PINK_RED_SET1, HOT_PINK_RED_SET2, colorSetRatio);
-    CRGB coolColorRGB = blendColors(DEEP_PURPLE_BLUE_SET1, DEEP_PURPLE_BLUE_SET2, colorSetRatio);
-
-    // Convert back to uint32_t
-    hotColor = ((uint32_t)hotColorRGB.r << 16) | ((uint32_t)hotColorRGB.g << 8) | (uint32_t)hotColorRGB.b;
-    coolColor = ((uint32_t)coolColorRGB.r << 16) | ((uint32_t)coolColorRGB.g << 8) | (uint32_t)coolColorRGB.b;
+CRGB LustEffect::blendColors(uint32_t color1, uint32_t color2, float intensity) {
+    // Linear interpolation between colors (intensity is clamped to 0-1)
+    return Colors::mix(Colors::fromHex(color1), Colors::fromHex(color2), intensity);
 }
 
-CRGB LustEffect::blendColors(uint32_t color1, uint32_t color2, float intensity) {
-    // Extract RGB components from 32-bit colors
-    uint8_t r1 = (color1 >> 16) & 0xFF;
-    uint8_t g1 = (color1 >> 8) & 0xFF;
-    uint8_t b1 = color1 & 0xFF;
+void LustEffect::buildWaveTables() {
+    for (int i = 0; i < WAVE_TABLE_SIZE; i++) {
+        // Use sine wave to create smooth gradient transition
+        float waveValue = sin(i * 2.0f * PI / WAVE_TABLE_SIZE);
 
-    uint8_t r2 = (color2 >> 16) & 0xFF;
-    uint8_t g2 = (color2 >> 8) & 0xFF;
-    uint8_t b2 = color2 & 0xFF;
+        // Convert sine wave (-1 to 1) to blend ratio (0 to 1)
+        float blendRatio = (waveValue + 1.0f) * 0.5f;
 
-    // Clamp intensity to valid range
-    intensity = max(0.0f, min(1.0f, intensity));
+        // Blend between the hot and cool colors of each set
+        waveTableSet1[i] = blendColors(HOT_PINK_RED_SET1, DEEP_PURPLE_BLUE_SET1, blendRatio);
+        waveTableSet2[i] = blendColors(HOT_PINK_RED_SET2, DEEP_PURPLE_BLUE_SET2, blendRatio);
+    }
+}
+
+void LustEffect::fillGradientWave(CRGB* out, int count, float offset, bool reversed, uint8_t colorSetBlend) {
+    // Where LED 0 sits in the wave, as a fraction of one period
+    float start = (reversed ? -offset : offset) / WAVE_LENGTH;
+    start -= floorf(start);
 
-    // Linear interpolation between colors
-    uint8_t r = r1 + (uint8_t)((r2 - r1) * intensity);
-    uint8_t g = g1 + (uint8_t)((g2 - g1) * intensity);
-    uint8_t b = b1 + (uint8_t)((b2 - b1) * intensity);
+    // 16-bit phase: one full period is 65536, the top byte indexes the tables
+    uint16_t phase = (uint16_t)(start * 65536.0f);
 
-    return CRGB(r, g, b);
+    for (int i = 0; i < count; i++) {
+        uint8_t index = phase >> 8;
+        out[i] = blend(waveTableSet1[index], waveTableSet2[index], colorSetBlend);
+        phase += WAVE_STEP;
+    }
 }
 
-void LustEffect::updateCoreBreathing(float intensity, uint32_t hotColor, uint32_t coolColor) {
+void LustEffect::updateCoreBreathing(uint8_t colorSetBlend) {
     // Core has moving gradient wave
-    CRGB* coreStrip = leds.getCore();
-    for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-        coreStrip[i] = getGradientWaveColor(i, gradientOffset, intensity, false, hotColor, coolColor);
-    }
+    fillGradientWave(target->getCore(), LED_STRIP_CORE_COUNT, gradientOffset, false, colorSetBlend);
 }
 
-void LustEffect::updateInnerBreathing(float intensity, uint32_t hotColor, uint32_t coolColor) {
+void LustEffect::updateInnerBreathing(uint8_t colorSetBlend) {
     // Inner has opposing gradient wave, but each of the 3 strips shows the same pattern
     // Add 15% offset to create phase difference from core/outer strips
     float offsetGradient = gradientOffset + (WAVE_LENGTH * 0.15f);
-    CRGB* innerStrip = leds.getInner();
-
-    // Apply the same gradient pattern to each of the 3 inner strips
-    for (int segment = 0; segment < NUM_INNER_STRIPS; segment++) {
-        int segmentStart = segment * INNER_LEDS_PER_STRIP;
+    CRGB* innerStrip = target->getInner();
 
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            int ledIndex = segmentStart + i;
-            // Use local position 'i' with offset gradient (but still reversed direction)
-            innerStrip[ledIndex] = getGradientWaveColor(i, offsetGradient, intensity, true, hotColor, coolColor);
-        }
+    // Draw the first strip, then copy it to the others
+    fillGradientWave(innerStrip, INNER_LEDS_PER_STRIP, offsetGradient, true, colorSetBlend);
+    for (int segment = 1; segment < NUM_INNER_STRIPS; segment++) {
+        memcpy(&innerStrip[segment * INNER_LEDS_PER_STRIP], innerStrip, INNER_LEDS_PER_STRIP * sizeof(CRGB));
     }
 }
 
-void LustEffect::updateOuterBreathing(float intensity, uint32_t hotColor, uint32_t coolColor) {
+void LustEffect::updateOuterBreathing(uint8_t colorSetBlend) {
     // Outer has same gradient wave as core, but each of the 3 strips shows the same pattern
     // Plus fade to black overlay from bottom to top
-    CRGB* outerStrip = leds.getOuter();
-
-    // Apply the same gradient pattern to each of the 3 outer strips
-    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        int segmentStart = segment * OUTER_LEDS_PER_STRIP;
-
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            int ledIndex = segmentStart + i;
-
-            // Get the base gradient color
-            CRGB baseColor = getGradientWaveColor(i, gradientOffset, intensity, false, hotColor, coolColor);
-
-            // Calculate fade factor (0.0 at top, 1.0 at bottom)
-            float fadePosition = (float)i / (float)(OUTER_LEDS_PER_STRIP - 1);
-            float fadeFactor = 1.0f - fadePosition; // 1.0 at bottom (i=0), 0.0 at top (i=max)
-
-            // Apply fade to black by scaling the color components
-            baseColor.r = (uint8_t)(baseColor.r * fadeFactor);
-            baseColor.g = (uint8_t)(baseColor.g * fadeFactor);
-            baseColor.b = (uint8_t)(baseColor.b * fadeFactor);
+    CRGB* outerStrip = target->getOuter();
 
-            // Use local position 'i' instead of global position 'ledIndex'
-            // so all 3 strips show the same pattern with fade overlay
-            outerStrip[ledIndex] = baseColor;
-        }
+    // Draw and fade the first strip, then copy it to the others
+    fillGradientWave(outerStrip, OUTER_LEDS_PER_STRIP, gradientOffset, false, colorSetBlend);
+    for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
+        outerStrip[i].nscale8(outerFade[i]);
+    }
+    for (int segment = 1; segment < NUM_OUTER_STRIPS; segment++) {
+        memcpy(&outerStrip[segment * OUTER_LEDS_PER_STRIP], outerStrip, OUTER_LEDS_PER_STRIP * sizeof(CRGB));
     }
 }
 
-void LustEffect::updateRingBreathing(float intensity, uint32_t hotColor, uint32_t coolColor) {
+void LustEffect::updateRingBreathing(uint8_t colorSetBlend) {
     // Skip ring if button feedback is active
     if (skipRing) {
         return;
     }
 
     // Ring has same gradient wave as core and outer
-    CRGB* ringStrip = leds.getRing();
-    for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        ringStrip[i] = getGradientWaveColor(i, gradientOffset, intensity, false, hotColor, coolColor);
-    }
+    fillGradientWave(target->getRing(), LED_STRIP_RING_COUNT, gradientOffset, false, colorSetBlend);
 }
-
-CRGB LustEffect::getGradientWaveColor(int position, float offset, float intensity, bool reversed, uint32_t hotColor, uint32_t coolColor) {
-    // Calculate wave position with animation offset
-    float wavePosition = (float)position + (reversed ? -offset : offset);
-
-    // Use sine wave to create smooth gradient transition
-    float sineInput = wavePosition * 2.0f * PI / WAVE_LENGTH;
-    float waveValue = sin(sineInput);
-
-    // Convert sine wave (-1 to 1) to blend ratio (0 to 1)
-    float blendRatio = (waveValue + 1.0f) * 0.5f;
-
-    // No breathing modulation - just pure gradient wave
-    // Removed: float breathingModulation = sin(intensity * PI) * 0.2f;
-    // Removed: float finalBlendRatio = blendRatio + breathingModulation;
-
-    // Use pure blend ratio for smooth gradient
-    float finalBlendRatio = blendRatio;
-
-    // Clamp to valid range
-    finalBlendRatio = max(0.0f, min(1.0f, finalBlendRatio));
-
-    // Blend between the current hot and cool colors
-    return blendColors(hotColor, coolColor, finalBlendRatio);
-}
\ No newline at end of file
@@ -29,12 +29,6 @@ public:
      */
     LustEffect(LEDController& ledController);
 
-    /**
-     * Update the effect - animates the breathing color transition
-     * Called every frame to create smooth breathing animation
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Restarts the breathing cycle from the beginning
@@ -45,9 +39,34 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Lust Effect"; }
+    const char* getName() const override { return "Lust Effect"; }
+
+    // Each strip samples the wave tables on its own
+    bool hasStripJobs() const override { return true; }
+
+    /**
+     * Loop length for baking: 5 color set cycles and 20 breathing cycles.
+     * The gradient wave is 0.04 of a wave off after that, which the seam
+     * crossfade hides.
+     */
+    unsigned long loopPeriodMs() const override { return COLOR_SET_CYCLE * 5; }
+
+    // The colors drift slowly, so 12.5 stored frames a second are plenty
+    unsigned long loopFrameMs() const override { return 80; }
 
 private:
+    /**
+     * Update the effect - animates the breathing color transition
+     * Called every frame to create smooth breathing animation
+     */
+    void render() override;
+
+    /**
+     * Draw one strip of the frame set up by render()
+     * @param strip Which strip to draw
+     */
+    void renderStrip(StripJob strip) override;
+
     // Color definitions - two color sets that will animate between each other
     static constexpr uint32_t HOT_PINK_RED_SET1 = 0xFF4569;     // Hot pink with orange undertones (original)
     static constexpr uint32_t DEEP_PURPLE_BLUE_SET1 = 0x4A00B0; // More purple-blue (increased purple component)
@@ -59,27 +78,24 @@ private:
     static constexpr uint32_t DEEP_PURPLE_BLUE = 0x550058;     // Updated halfway blend with more purple
 
     // Animation timing constants
-    static constexpr unsigned long CYCLE_DURATION = 4000;  // Total cycle time (4 seconds)
-    static constexpr unsigned long HALF_CYCLE = CYCLE_DURATION / 2;  // Half cycle (2 seconds)
     static constexpr unsigned long COLOR_SET_CYCLE = 16000; // Color set transition cycle (16 seconds - doubled)
 
     // Gradient animation constants
-    static constexpr float GRADIENT_SPEED = 0.1152f;        // Speed of gradient wave movement (20% faster)
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;       // Frame length GRADIENT_SPEED is tuned for
+    static constexpr float GRADIENT_SPEED = 0.1152f;        // Speed of gradient wave movement in pixels per frame (20% faster)
     static constexpr float WAVE_LENGTH = 50.0f;             // Length of one complete gradient wave (longer for smoother)
 
-    // Breathing animation variables
-    unsigned long cycleStartTime;           // When current breathing cycle started
-    float breathingPhase;                   // Current phase (0.0 to 1.0)
-    bool isFirstHalf;                       // True for first half of cycle, false for second half
+    // Precomputed gradient wave - one full period per color set
+    static const int WAVE_TABLE_SIZE = 256;                 // Entries per period (indexed by the top byte of a 16-bit phase)
+    static constexpr uint16_t WAVE_STEP = (uint16_t)(65536.0f / WAVE_LENGTH + 0.5f); // Phase step from one LED to the next
+    CRGB waveTableSet1[WAVE_TABLE_SIZE];    // Hot-to-cool wave using the first color set
+    CRGB waveTableSet2[WAVE_TABLE_SIZE];    // Hot-to-cool wave using the second color set
+    uint8_t outerFade[OUTER_LEDS_PER_STRIP]; // Fade to black from bottom to top of each outer strip
+
+    // Animation variables
     float gradientOffset;                   // Current gradient animation offset
     unsigned long colorSetStartTime;       // When current color set cycle started
-
-    /**
-     * Calculate the current breathing intensity (0.0 to 1.0)
-     * Uses smooth sine wave for natural breathing feel
-     * @return Breathing intensity from 0.0 (start colors) to 1.0 (flipped colors)
-     */
-    float calculateBreathingIntensity();
+    uint8_t frameColorSetBlend;             // This frame's blend between the color sets, for the strip jobs
 
     /**
      * Blend between two colors based on intensity
@@ -90,41 +106,39 @@ private:
      */
     CRGB blendColors(uint32_t color1, uint32_t color2, float intensity);
 
+    /**
+     * Fill both wave tables with one period of the hot/cool sine gradient
+     * Called once from the constructor
+     */
+    void buildWaveTables();
+
     /**
      * Apply moving gradient to core strip
      * Core has gradient that moves upward
-     * @param intensity Current breathing intensity (0.0 to 1.0)
-     * @param hotColor Current hot color to use
-     * @param coolColor Current cool color to use
+     * @param colorSetBlend Current blend between the two color sets (0 = set 1, 255 = set 2)
      */
-    void updateCoreBreathing(float intensity, uint32_t hotColor, uint32_t coolColor);
+    void updateCoreBreathing(uint8_t colorSetBlend);
 
     /**
      * Apply moving gradient to inner strips
      * Inner has opposing gradient (offset by half pattern length)
-     * @param intensity Current breathing intensity (0.0 to 1.0)
-     * @param hotColor Current hot color to use
-     * @param coolColor Current cool color to use
+     * @param colorSetBlend Current blend between the two color sets (0 = set 1, 255 = set 2)
      */
-    void updateInnerBreathing(float intensity, uint32_t hotColor, uint32_t coolColor);
+    void updateInnerBreathing(uint8_t colorSetBlend);
 
     /**
      * Apply moving gradient to outer strips
      * Outer has same gradient pattern as core
-     * @param intensity Current breathing intensity (0.0 to 1.0)
-     * @param hotColor Current hot color to use
-     * @param coolColor Current cool color to use
+     * @param colorSetBlend Current blend between the two color sets (0 = set 1, 255 = set 2)
      */
-    void updateOuterBreathing(float intensity, uint32_t hotColor, uint32_t coolColor);
+    void updateOuterBreathing(uint8_t colorSetBlend);
 
     /**
      * Apply moving gradient to ring strip
      * Ring has same gradient pattern as core and outer
-     * @param intensity Current breathing intensity (0.0 to 1.0)
-     * @param hotColor Current hot color to use
-     * @param coolColor Current cool color to use
+     * @param colorSetBlend Current blend between the two color sets (0 = set 1, 255 = set 2)
      */
-    void updateRingBreathing(float intensity, uint32_t hotColor, uint32_t coolColor);
+    void updateRingBreathing(uint8_t colorSetBlend);
 
     /**
      * Calculate current color set blend ratio (0.0 to 1.0)
@@ -134,25 +148,15 @@ private:
     float calculateColorSetBlendRatio();
 
     /**
-     * Get the current blended colors based on color set animation
-     * @param colorSetRatio Blend ratio between color sets (0.0 to 1.0)
-     * @param hotColor Output parameter for the current hot color
-     * @param coolColor Output parameter for the current cool color
-     */
-    void getCurrentColorSet(float colorSetRatio, uint32_t& hotColor, uint32_t& coolColor);
-
-    /**
-     * Generate gradient wave color for a specific position and offset
-     * Creates a smooth wave that transitions between the current color set
-     * @param position LED position in the strip
+     * Write a run of LEDs from the wave tables
+     * Each LED is one table read per color set plus one 8-bit blend
+     * @param out First LED to write
+     * @param count Number of LEDs to write
      * @param offset Animation offset for wave movement
-     * @param intensity Breathing intensity for color blending
      * @param reversed True to reverse the wave direction (for inner strips)
-     * @param hotColor Current hot color to use
-     * @param coolColor Current cool color to use
-     * @return Color for this position
+     * @param colorSetBlend Blend between the two color sets (0 = set 1, 255 = set 2)
      */
-    CRGB getGradientWaveColor(int position, float offset, float intensity, bool reversed, uint32_t hotColor, uint32_t coolColor);
+    void fillGradientWave(CRGB* out, int count, float offset, bool reversed, uint8_t colorSetBlend);
 };
 
 #endif // LUST_EFFECT_H
\ No newline at end of file
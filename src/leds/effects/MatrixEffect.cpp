@@ -1,12 +1,11 @@
 // src/leds/effects/MatrixEffect.cpp
 
 #include "MatrixEffect.h"
+#include "../HSVKernel.h"
 
 MatrixEffect::MatrixEffect(LEDController &ledController) : Effect(ledController),
                                                            hueCounter(0),
                                                            baseHue(0),
-                                                           lastUpdate(0),
-                                                           lastHueUpdate(0),
                                                            lastRingTrailCreateTime(0) {
     // Initialize drops for each strip
     // Core strips - 3 segments
@@ -64,15 +63,12 @@ void MatrixEffect::reset() {
         }
     }
 
-    // Reset timing and hue counter
-    lastUpdate = millis();
-    lastHueUpdate = millis();
+    // Reset hue counter
     hueCounter = 0;
     baseHue = 0;
 
-    // Clear all LEDs
-    leds.clearAll();
-    leds.showAll();
+    // Start with drops already falling everywhere
+    warmUp(warmUpMs());
 }
 
 void MatrixEffect::updateColorPalette() {
@@ -95,14 +91,14 @@ void MatrixEffect::updateColorPalette() {
     }
 }
 
-void MatrixEffect::update() {
+void MatrixEffect::render() {
     // Target 120 FPS for ultra-smooth matrix drops
-    if (!shouldUpdate(8)) {  // 8ms = 125 FPS (close to 120)
+    if (!beginFrame(8, REFERENCE_FRAME_MS)) {  // 8ms = 125 FPS (close to 120)
         return;
     }
 
     // Clear all strips before drawing
-    leds.clearAll();
+    target->clearAll();
 
     // Update each strip type
     // Core - now process each segment separately
@@ -122,10 +118,13 @@ void MatrixEffect::update() {
         updateRingTrails(); // Use new continuous trail system
 
     // Update hue counter for precise 0.025 rotation speed (4x slower than 0.1)
-    hueCounter += HUE_ROTATION_SPEED;  // Add 1 each frame
+    hueCounter += HUE_ROTATION_SPEED * frameStep;  // Add 1 each 8ms frame
+    if (hueCounter >= 40.0f * 255.0f) {
+        hueCounter -= 40.0f * 255.0f;  // Keep the counter in the 0-255 hue range
+    }
 
     // Convert counter to hue (divide by 40 to get 0.025 effective speed)
-    uint8_t currentBaseHue = (hueCounter / 40) % 255;
+    uint8_t currentBaseHue = (uint8_t)(hueCounter / 40.0f);
 
     // Update color palette periodically
     static int paletteUpdateCounter = 0;
@@ -139,9 +138,20 @@ void MatrixEffect::update() {
         paletteUpdateCounter = 0;
         lastBaseHue = currentBaseHue;
     }
+}
 
-    // Show all updates
-    leds.showAll();
+void MatrixEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, REFERENCE_FRAME_MS);
+
+    for (int segment = 0; segment < 3; segment++) {
+        updateStrip(0, segment, false);
+    }
+    for (int i = 0; i < NUM_INNER_STRIPS; i++) {
+        updateStrip(1, i, false);
+    }
+    for (int i = 0; i < NUM_OUTER_STRIPS; i++) {
+        updateStrip(2, i, false);
+    }
 }
 
 void MatrixEffect::createDrop(int stripType, int subStrip) {
@@ -170,16 +180,25 @@ void MatrixEffect::createDrop(int stripType, int subStrip) {
             return; // Invalid strip type
     }
 
+    // Fewer drops per strip at reduced quality - the ones already falling still finish
+    int activeDrops = 0;
+    for (const auto &drop: *drops) {
+        if (drop.isActive) activeDrops++;
+    }
+    if (activeDrops >= qualityBudget(MAX_DROPS_PER_STRIP)) {
+        return;
+    }
+
     // Find an inactive drop slot
     for (auto &drop: *drops) {
         if (!drop.isActive) {
             // Initialize a new drop
             drop.position = stripLength - 1; // Start at the top
-            drop.speed = MIN_SPEED + ((float) random(100) / 100.0f) * (MAX_SPEED - MIN_SPEED);
+            drop.speed = MIN_SPEED + ((float) rng.range(100) / 100.0f) * (MAX_SPEED - MIN_SPEED);
 
             // Assign hue within 20% of color wheel around current rotating base hue
             // 20% of 255 = 51, so random range of ±25 around base hue
-            int hueVariation = random(51) - 25; // Random from -25 to +25
+            int hueVariation = rng.range(51) - 25; // Random from -25 to +25
             drop.hue = (baseHue + hueVariation) & 0xFF; // Keep within 0-255 range with wraparound
 
             drop.brightness = 255;
@@ -190,7 +209,7 @@ void MatrixEffect::createDrop(int stripType, int subStrip) {
     }
 }
 
-void MatrixEffect::updateStrip(int stripType, int subStrip) {
+void MatrixEffect::updateStrip(int stripType, int subStrip, bool draw) {
     std::vector<Drop> *drops;
     int stripLength;
 
@@ -217,7 +236,7 @@ void MatrixEffect::updateStrip(int stripType, int subStrip) {
     }
 
     // Random chance to create a new drop
-    if (random(20) == 0) {
+    if (frameChance(1.0f / 20.0f)) {
         createDrop(stripType, subStrip);
     }
 
@@ -225,15 +244,15 @@ void MatrixEffect::updateStrip(int stripType, int subStrip) {
     for (auto &drop: *drops) {
         if (drop.isActive) {
             // Update position
-            drop.position -= drop.speed;
+            drop.position -= drop.speed * frameStep;
 
             // Random chance to flicker (brightness only)
-            if (random(100) < FLICKER_CHANCE) {
-                drop.brightness = 255 - random(FLICKER_INTENSITY);
+            if (frameChance(FLICKER_CHANCE / 100.0f)) {
+                drop.brightness = 255 - rng.range(FLICKER_INTENSITY);
             } else {
                 // Gradually restore brightness
                 if (drop.brightness < 255) {
-                    drop.brightness = min(255, drop.brightness + 20);
+                    drop.brightness = min(255, drop.brightness + (int)(20 * frameStep + 0.5f));
                 }
             }
 
@@ -246,7 +265,9 @@ void MatrixEffect::updateStrip(int stripType, int subStrip) {
             }
 
             // Render this drop and its trail
-            renderDrop(drop, stripType, subStrip, stripLength);
+            if (draw) {
+                renderDrop(drop, stripType, subStrip, stripLength);
+            }
         }
     }
 }
@@ -272,24 +293,22 @@ void MatrixEffect::renderDrop(Drop &drop, int stripType, int subStrip, int strip
         }
 
         // Set the head color (colored drops only - no sparkles)
-        CRGB headColor;
-        // Colored drop with flicker - use HSV with the drop's assigned hue
-        CHSV hsvColor(drop.hue, 255, drop.brightness); // This uses flickering brightness
-        hsv2rgb_rainbow(hsvColor, headColor);
+        // Colored drop with flicker - use the drop's assigned hue with flickering brightness
+        CRGB headColor = HSVKernel::rainbow(drop.hue, drop.brightness);
 
         // Set the head pixel
         switch (stripType) {
             case 0: // Core
-                leds.getCore()[physicalPos] = headColor;
+                target->getCore()[physicalPos] = headColor;
                 break;
             case 1: // Inner
-                leds.getInner()[physicalPos] = headColor;
+                target->getInner()[physicalPos] = headColor;
                 break;
             case 2: // Outer
-                leds.getOuter()[physicalPos] = headColor;
+                target->getOuter()[physicalPos] = headColor;
                 break;
             case 3: // Ring
-                leds.getRing()[physicalPos] = headColor;
+                target->getRing()[physicalPos] = headColor;
                 break;
         }
     }
@@ -326,16 +345,16 @@ void MatrixEffect::renderDrop(Drop &drop, int stripType, int subStrip, int strip
             // Set trail pixel
             switch (stripType) {
                 case 0: // Core
-                    leds.getCore()[physicalPos] = trailColor;
+                    target->getCore()[physicalPos] = trailColor;
                     break;
                 case 1: // Inner
-                    leds.getInner()[physicalPos] = trailColor;
+                    target->getInner()[physicalPos] = trailColor;
                     break;
                 case 2: // Outer
-                    leds.getOuter()[physicalPos] = trailColor;
+                    target->getOuter()[physicalPos] = trailColor;
                     break;
                 case 3: // Ring
-                    leds.getRing()[physicalPos] = trailColor;
+                    target->getRing()[physicalPos] = trailColor;
                     break;
             }
         }
@@ -356,7 +375,7 @@ void MatrixEffect::updateRingTrails() {
         if (!trail.active) continue;
 
         // Move the trail around the ring
-        trail.position += trail.speed;
+        trail.position += trail.speed * frameStep;
 
         // Wrap around when we reach the end
         if (trail.position >= LED_STRIP_RING_COUNT) {
@@ -389,16 +408,16 @@ void MatrixEffect::createNewRingTrail() {
     MatrixRingTrail newTrail;
 
     // Random starting position around the ring
-    newTrail.position = random(LED_STRIP_RING_COUNT);
+    newTrail.position = rng.range(LED_STRIP_RING_COUNT);
 
     // Speed between 0.1 and 0.3 pixels per frame for smooth movement
-    newTrail.speed = 0.1f + (random(100) / 100.0f) * 0.2f;
+    newTrail.speed = 0.1f + (rng.range(100) / 100.0f) * 0.2f;
 
     // Set trail length
     newTrail.trailLength = RING_TRAIL_LENGTH;
 
     // Assign hue within 20% of color wheel around current rotating base hue
-    int hueVariation = random(51) - 25; // Random from -25 to +25
+    int hueVariation = rng.range(51) - 25; // Random from -25 to +25
     newTrail.hue = (baseHue + hueVariation) & 0xFF;
 
     // Set creation time
@@ -465,15 +484,14 @@ void MatrixEffect::drawRingTrails() {
 
                 if (i == 0) {
                     // Head of trail - colored (like drop heads on other strips)
-                    CHSV hsvColor(trail.hue, 255, brightness);
-                    hsv2rgb_rainbow(hsvColor, segmentColor);
+                    segmentColor = HSVKernel::rainbow(trail.hue, brightness);
                 } else {
                     // Trail segments - white (consistent with other strips)
                     segmentColor = CRGB(brightness, brightness, brightness);
                 }
 
                 // Add to existing ring LED (additive blending for overlapping trails)
-                leds.getRing()[ledIndex] += segmentColor;
+                target->getRing()[ledIndex] += segmentColor;
             }
         }
     }
@@ -31,11 +31,16 @@ public:
     MatrixEffect(LEDController& ledController);
     ~MatrixEffect();
 
-    void update() override;
     void reset() override;
 
-    String getName() const override { return "Matrix Effect"; }
+    // Long enough for the first drops to run down the longest strip
+    unsigned long warmUpMs() const override { return WARM_UP_MS; }
+
+    const char* getName() const override { return "Matrix Effect"; }
 private:
+    void render() override;
+    void simulate(unsigned long stepMs) override;  // Warm-up: drops fall, nothing is drawn
+
     // Constants for the effect
     static const uint8_t TRAIL_LENGTH = 15;            // Length of each drop's trail
     static const uint8_t TRAIL_BRIGHTNESS = 60;        // Base brightness of the trails
@@ -66,19 +71,22 @@ private:
     CRGB colorPalette[NUM_COLORS];
 
     // State variables
-    uint16_t hueCounter;    // Counter for precise hue rotation (scaled to achieve 0.3 speed)
+    float hueCounter;       // Counter for precise hue rotation (scaled to achieve 0.3 speed)
     uint8_t baseHue;        // Current base hue calculated from counter
-    unsigned long lastUpdate;
-    unsigned long lastHueUpdate;
 
-    // Speed range (in pixels per frame)
+    // Per-frame chances and speeds are tuned for 8ms frames and scaled by frameStep
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;
+
+    // Speed range (in pixels per 8ms frame)
     static constexpr float MIN_SPEED = 0.1f;
     static constexpr float MAX_SPEED = 0.3f;
 
+    static const unsigned long WARM_UP_MS = 3000;
+
     // Helper methods
     void updateColorPalette();
     void createDrop(int stripType, int subStrip = 0);
-    void updateStrip(int stripType, int subStrip = 0);
+    void updateStrip(int stripType, int subStrip = 0, bool draw = true);
     void renderDrop(Drop& drop, int stripType, int subStrip, int stripLength);
 
     // Ring-specific methods for continuous trails
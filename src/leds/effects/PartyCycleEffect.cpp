@@ -3,25 +3,28 @@
 #include "PartyCycleEffect.h"
 #include "FastLED.h"
 
-PartyCycleEffect::PartyCycleEffect(LEDController& ledController, const std::vector<Effect*>& partyEffects) :
+PartyCycleEffect::PartyCycleEffect(LEDController& ledController, EffectRegistry& registry, const std::vector<int>& partyEffectIds) :
     Effect(ledController),
-    partyEffects(partyEffects),
+    registry(registry),
+    partyEffectIds(partyEffectIds),
+    worker(nullptr),
     currentEffectIndex(0),
     nextEffectIndex(1),
     inTransition(false),
     effectStartTime(0),
-    transitionStartTime(0)
+    transitionStartTime(0),
+    transitionFrameCount(0)
 {
     effectStartTime = millis();
 
     // Calculate next effect index
-    if (partyEffects.size() > 1) {
+    if (partyEffectIds.size() > 1) {
         nextEffectIndex = 1;
     } else {
         nextEffectIndex = 0;
     }
 
-    Serial.println("PartyCycleEffect created with " + String(this->partyEffects.size()) + " effects");
+    Serial.println("PartyCycleEffect created with " + String(this->partyEffectIds.size()) + " effects");
 }
 
 PartyCycleEffect::~PartyCycleEffect() {
@@ -30,14 +33,47 @@ PartyCycleEffect::~PartyCycleEffect() {
 
 void PartyCycleEffect::reset() {
     currentEffectIndex = 0;
-    nextEffectIndex = (partyEffects.size() > 1) ? 1 : 0;
+    nextEffectIndex = (partyEffectIds.size() > 1) ? 1 : 0;
     inTransition = false;
     effectStartTime = millis();
     Serial.println("PartyCycleEffect reset");
 }
 
-void PartyCycleEffect::update() {
-    if (partyEffects.empty()) {
+void PartyCycleEffect::setQuality(float quality) {
+    Effect::setQuality(quality);
+
+    // Effects that are not built yet get the quality when they are built
+    for (int id : partyEffectIds) {
+        Effect* effect = registry.peek(id);
+        if (effect != nullptr) {
+            effect->setQuality(quality);
+        }
+    }
+}
+
+bool PartyCycleEffect::containsEffect(const Effect* effect) const {
+    if (effect == this) {
+        return true;
+    }
+
+    // Any built party effect may be drawn as soon as the cycle moves on
+    // (effects that are not built yet can't be the one asked about)
+    for (int id : partyEffectIds) {
+        const Effect* partyEffect = registry.peek(id);
+        if (partyEffect != nullptr && partyEffect->containsEffect(effect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* PartyCycleEffect::partyEffectName(int index) const {
+    const EffectDescriptor* descriptor = registry.describe(partyEffectIds[index]);
+    return descriptor != nullptr ? descriptor->name : "?";
+}
+
+void PartyCycleEffect::render() {
+    if (partyEffectIds.empty()) {
         Serial.println("WARNING: PartyCycleEffect has no party effects to cycle through");
         return;
     }
@@ -47,8 +83,10 @@ void PartyCycleEffect::update() {
     if (inTransition) {
         updateTransition();
     } else {
-        // Run the current effect normally
-        partyEffects[currentEffectIndex]->update();
+        // Run the current effect straight into our target
+        if (!partyEffect(currentEffectIndex)->update(*target)) {
+            skipFrame();
+        }
 
         // Check if it's time to start a transition
         if (currentTime - effectStartTime >= EFFECT_DURATION) {
@@ -56,8 +94,12 @@ void PartyCycleEffect::update() {
         }
     }
 
-    // Add rainbow notification to ring after effects update
-    addRainbowRingNotification();
+    // Add rainbow notification to ring after effects update - only over a
+    // ring drawn or blended just now. A skipped frame leaves the target as it
+    // was, last frame's notification included.
+    if (!frameSkipped) {
+        addRainbowRingNotification();
+    }
 }
 
 void PartyCycleEffect::startTransition() {
@@ -65,14 +107,21 @@ void PartyCycleEffect::startTransition() {
     transitionStartTime = millis();
 
     // Calculate next effect index
-    nextEffectIndex = (currentEffectIndex + 1) % partyEffects.size();
+    nextEffectIndex = (currentEffectIndex + 1) % partyEffectIds.size();
 
     // Reset the next effect so it starts fresh
-    partyEffects[nextEffectIndex]->reset();
-
-    Serial.println("PartyCycleEffect: Starting 8-second transition from '" +
-                   partyEffects[currentEffectIndex]->getName() + "' to '" +
-                   partyEffects[nextEffectIndex]->getName() + "'");
+    partyEffect(nextEffectIndex)->reset();
+
+    // The outgoing effect carries on from what is on screen, the incoming one starts dark
+    oldEffectFrame.copyFrom(*target);
+    newEffectFrame.clearAll();
+    transitionFrameCount = 0;
+
+    Serial.print("PartyCycleEffect: Starting 8-second transition from '");
+    Serial.print(partyEffectName(currentEffectIndex));
+    Serial.print("' to '");
+    Serial.print(partyEffectName(nextEffectIndex));
+    Serial.println("'");
 }
 
 void PartyCycleEffect::updateTransition() {
@@ -86,8 +135,13 @@ void PartyCycleEffect::updateTransition() {
         inTransition = false;
         effectStartTime = currentTime;
 
-        Serial.println("PartyCycleEffect: Transition complete, now showing '" +
-                       partyEffects[currentEffectIndex]->getName() + "'");
+        // Hand the incoming effect's own frame back to it, so effects that
+        // build on their previous frame (trails, fades) carry on smoothly
+        target->copyFrom(newEffectFrame, !skipRing);
+
+        Serial.print("PartyCycleEffect: Transition complete, now showing '");
+        Serial.print(partyEffectName(currentEffectIndex));
+        Serial.println("'");
         return;
     }
 
@@ -97,72 +151,35 @@ void PartyCycleEffect::updateTransition() {
     // Apply smooth S-curve for gradual fade
     float smoothProgress = fadeProgress * fadeProgress * (3.0f - 2.0f * fadeProgress);
 
-    // Update both effects but don't let them show LEDs yet
-    // Store current LED state first
-    CRGB tempCore[LED_STRIP_CORE_COUNT];
-    CRGB tempInner[LED_STRIP_INNER_COUNT];
-    CRGB tempOuter[LED_STRIP_OUTER_COUNT];
-    CRGB tempRing[LED_STRIP_RING_COUNT];
-
-    // Update old effect and capture
-    partyEffects[currentEffectIndex]->update();
-    memcpy(tempCore, leds.getCore(), LED_STRIP_CORE_COUNT * sizeof(CRGB));
-    memcpy(tempInner, leds.getInner(), LED_STRIP_INNER_COUNT * sizeof(CRGB));
-    memcpy(tempOuter, leds.getOuter(), LED_STRIP_OUTER_COUNT * sizeof(CRGB));
-    memcpy(tempRing, leds.getRing(), LED_STRIP_RING_COUNT * sizeof(CRGB));
-
-    // Store old effect state
-    memcpy(oldEffectLEDs.core, tempCore, LED_STRIP_CORE_COUNT * sizeof(CRGB));
-    memcpy(oldEffectLEDs.inner, tempInner, LED_STRIP_INNER_COUNT * sizeof(CRGB));
-    memcpy(oldEffectLEDs.outer, tempOuter, LED_STRIP_OUTER_COUNT * sizeof(CRGB));
-    memcpy(oldEffectLEDs.ring, tempRing, LED_STRIP_RING_COUNT * sizeof(CRGB));
-
-    // Update new effect and capture
-    partyEffects[nextEffectIndex]->update();
-    memcpy(newEffectLEDs.core, leds.getCore(), LED_STRIP_CORE_COUNT * sizeof(CRGB));
-    memcpy(newEffectLEDs.inner, leds.getInner(), LED_STRIP_INNER_COUNT * sizeof(CRGB));
-    memcpy(newEffectLEDs.outer, leds.getOuter(), LED_STRIP_OUTER_COUNT * sizeof(CRGB));
-    memcpy(newEffectLEDs.ring, leds.getRing(), LED_STRIP_RING_COUNT * sizeof(CRGB));
-
-    // Now manually blend the two captured states
-    uint8_t newWeight = (uint8_t)(smoothProgress * 255);
-    uint8_t oldWeight = 255 - newWeight;
-
-    // Blend and write directly to LED strips
-    for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-        leds.getCore()[i] = CRGB(
-            ((oldEffectLEDs.core[i].r * oldWeight) + (newEffectLEDs.core[i].r * newWeight)) >> 8,
-            ((oldEffectLEDs.core[i].g * oldWeight) + (newEffectLEDs.core[i].g * newWeight)) >> 8,
-            ((oldEffectLEDs.core[i].b * oldWeight) + (newEffectLEDs.core[i].b * newWeight)) >> 8
-        );
-    }
+    // Look both effects up here on the main core. If the registry released one,
+    // get() builds it again and its create hook seeds and bakes it - that
+    // touches shared state (bake budget, other effects' loops, Serial), so it
+    // must not happen on the worker.
+    Effect* outgoing = partyEffect(currentEffectIndex);
+    Effect* incoming = partyEffect(nextEffectIndex);
 
-    for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        leds.getInner()[i] = CRGB(
-            ((oldEffectLEDs.inner[i].r * oldWeight) + (newEffectLEDs.inner[i].r * newWeight)) >> 8,
-            ((oldEffectLEDs.inner[i].g * oldWeight) + (newEffectLEDs.inner[i].g * newWeight)) >> 8,
-            ((oldEffectLEDs.inner[i].b * oldWeight) + (newEffectLEDs.inner[i].b * newWeight)) >> 8
-        );
-    }
+    // Both effects keep running, each in its own frame. The incoming one goes to
+    // the render worker (if it is free) so the two are drawn at the same time.
+    // The outgoing one is fading away, so it may draw less often - its time
+    // step keeps the speed right.
+    bool parallel = worker != nullptr && worker->start(incoming, newEffectFrame);
 
-    for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        leds.getOuter()[i] = CRGB(
-            ((oldEffectLEDs.outer[i].r * oldWeight) + (newEffectLEDs.outer[i].r * newWeight)) >> 8,
-            ((oldEffectLEDs.outer[i].g * oldWeight) + (newEffectLEDs.outer[i].g * newWeight)) >> 8,
-            ((oldEffectLEDs.outer[i].b * oldWeight) + (newEffectLEDs.outer[i].b * newWeight)) >> 8
-        );
+    bool oldDrawn = false;
+    if (transitionFrameCount % PARTY_FADE_OUTGOING_DIVIDER == 0) {
+        oldDrawn = outgoing->update(oldEffectFrame);
     }
+    transitionFrameCount++;
+
+    bool newDrawn = parallel ? worker->finish() : incoming->update(newEffectFrame);
 
-    for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        leds.getRing()[i] = CRGB(
-            ((oldEffectLEDs.ring[i].r * oldWeight) + (newEffectLEDs.ring[i].r * newWeight)) >> 8,
-            ((oldEffectLEDs.ring[i].g * oldWeight) + (newEffectLEDs.ring[i].g * newWeight)) >> 8,
-            ((oldEffectLEDs.ring[i].b * oldWeight) + (newEffectLEDs.ring[i].b * newWeight)) >> 8
-        );
+    if (!oldDrawn && !newDrawn) {
+        // Neither has a new frame yet - keep the last blend
+        skipFrame();
+        return;
     }
 
-    // Finally show the blended result - only we control when LEDs update
-    leds.showAll();
+    // One pass over both frames writes the blend straight into our target
+    target->mixFrom(oldEffectFrame, newEffectFrame, (uint8_t)(smoothProgress * 255), !skipRing);
 
     // Debug: Print progress occasionally
     static unsigned long lastProgressPrint = 0;
@@ -172,76 +189,6 @@ void PartyCycleEffect::updateTransition() {
     }
 }
 
-void PartyCycleEffect::storeLEDState() {
-    // This method is called before we start manipulating LED states
-    // We don't need to store anything here as we'll capture after each effect update
-}
-
-void PartyCycleEffect::captureLEDState(LEDSnapshot& snapshot) {
-    // Capture current LED state for all strips - optimized
-    memcpy(snapshot.core, leds.getCore(), LED_STRIP_CORE_COUNT * sizeof(CRGB));
-    memcpy(snapshot.inner, leds.getInner(), LED_STRIP_INNER_COUNT * sizeof(CRGB));
-    memcpy(snapshot.outer, leds.getOuter(), LED_STRIP_OUTER_COUNT * sizeof(CRGB));
-    memcpy(snapshot.ring, leds.getRing(), LED_STRIP_RING_COUNT * sizeof(CRGB));
-}
-
-void PartyCycleEffect::blendEffectsOptimized(float fadeProgress) {
-    // Apply more aggressive smoothing curve to make fade even more gradual
-    // Using cubic smoothstep for very smooth transitions
-    float smoothProgress = fadeProgress * fadeProgress * fadeProgress * (fadeProgress * (fadeProgress * 6.0f - 15.0f) + 10.0f);
-
-    // Pre-calculate integer fade ratio for faster math
-    uint8_t newRatio = (uint8_t)(smoothProgress * 255);
-    uint8_t oldRatio = 255 - newRatio;
-
-    // Debug: Print progress occasionally
-    static unsigned long lastProgressPrint = 0;
-    if (millis() - lastProgressPrint > 2000) { // Every 2 seconds for less spam
-        Serial.println("Transition progress: " + String(fadeProgress * 100.0f, 1) + "% (smooth: " + String(smoothProgress * 100.0f, 1) + "%)");
-        lastProgressPrint = millis();
-    }
-
-    // Blend core LEDs - only if both effects use core
-    if (LED_STRIP_CORE_COUNT > 0) {
-        for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-            leds.getCore()[i] = CRGB(
-                ((oldEffectLEDs.core[i].r * oldRatio) + (newEffectLEDs.core[i].r * newRatio)) >> 8,
-                ((oldEffectLEDs.core[i].g * oldRatio) + (newEffectLEDs.core[i].g * newRatio)) >> 8,
-                ((oldEffectLEDs.core[i].b * oldRatio) + (newEffectLEDs.core[i].b * newRatio)) >> 8
-            );
-        }
-    }
-
-    // Blend inner LEDs
-    for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        leds.getInner()[i] = CRGB(
-            ((oldEffectLEDs.inner[i].r * oldRatio) + (newEffectLEDs.inner[i].r * newRatio)) >> 8,
-            ((oldEffectLEDs.inner[i].g * oldRatio) + (newEffectLEDs.inner[i].g * newRatio)) >> 8,
-            ((oldEffectLEDs.inner[i].b * oldRatio) + (newEffectLEDs.inner[i].b * newRatio)) >> 8
-        );
-    }
-
-    // Blend outer LEDs
-    for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        leds.getOuter()[i] = CRGB(
-            ((oldEffectLEDs.outer[i].r * oldRatio) + (newEffectLEDs.outer[i].r * newRatio)) >> 8,
-            ((oldEffectLEDs.outer[i].g * oldRatio) + (newEffectLEDs.outer[i].g * newRatio)) >> 8,
-            ((oldEffectLEDs.outer[i].b * oldRatio) + (newEffectLEDs.outer[i].b * newRatio)) >> 8
-        );
-    }
-
-    // Blend ring LEDs - only if both effects use ring
-    if (LED_STRIP_RING_COUNT > 0) {
-        for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-            leds.getRing()[i] = CRGB(
-                ((oldEffectLEDs.ring[i].r * oldRatio) + (newEffectLEDs.ring[i].r * newRatio)) >> 8,
-                ((oldEffectLEDs.ring[i].g * oldRatio) + (newEffectLEDs.ring[i].g * newRatio)) >> 8,
-                ((oldEffectLEDs.ring[i].b * oldRatio) + (newEffectLEDs.ring[i].b * newRatio)) >> 8
-            );
-        }
-    }
-}
-
 void PartyCycleEffect::addRainbowRingNotification() {
     // Skip ring updates if button feedback is active to avoid conflicts
     if (skipRing) {
@@ -253,25 +200,8 @@ void PartyCycleEffect::addRainbowRingNotification() {
     static const int NOTIFICATION_END = 22;
     static const int NOTIFICATION_COUNT = 12;
 
-    // Representative colors for each party effect (based on SmartLantern.cpp order)
-    // partyEffectsForCycling order: lust, emerald, suspendedPartyFire, codeRed, matrix,
-    // technoOrange, rainbowTrance, partyFire, rainbow, future, futureRainbow, rgbPattern
-    CRGB effectColors[] = {
-        CRGB(255, 20, 147),    // Lust Effect - Deep pink/magenta
-        CRGB(0, 255, 127),     // Emerald City - Emerald green
-        CRGB(255, 69, 0),      // Suspended Party Fire - Orange red
-        CRGB(220, 20, 60),     // Code Red - Crimson red
-        CRGB(0, 255, 0),       // Matrix - Bright green
-        CRGB(255, 140, 0),     // Techno Orange (Regal) - Dark orange
-        CRGB(138, 43, 226),    // Rainbow Trance - Blue violet
-        CRGB(255, 0, 0),       // Party Fire - Red
-        CRGB(255, 255, 0),     // Rainbow - Yellow (center of rainbow)
-        CRGB(0, 191, 255),     // Future - Deep sky blue
-        CRGB(255, 0, 255),     // Future Rainbow - Magenta
-        CRGB(128, 0, 128)      // RGB Pattern - Purple
-    };
-
-    int numEffects = sizeof(effectColors) / sizeof(effectColors[0]);
+    // Representative color of each party effect comes from its catalog entry
+    int numEffects = partyEffectIds.size();
 
     // Get current time for animation
     unsigned long currentTime = millis();
@@ -290,13 +220,14 @@ void PartyCycleEffect::addRainbowRingNotification() {
         int effectIndex = (i * numEffects) / NOTIFICATION_COUNT;
         if (effectIndex >= numEffects) effectIndex = numEffects - 1;
 
-        // Get the base color for this effect
-        CRGB baseColor = effectColors[effectIndex];
+        // Get the base color for this effect (the registry knows it without building the effect)
+        const EffectDescriptor* descriptor = registry.describe(partyEffectIds[effectIndex]);
+        CRGB baseColor = descriptor != nullptr ? CRGB(descriptor->color) : CRGB::White;
 
         // Apply breathing brightness
         baseColor.nscale8_video(brightness);
 
         // Set the LED
-        leds.getRing()[ringIndex] = baseColor;
+        target->getRing()[ringIndex] = baseColor;
     }
 }
\ No newline at end of file
@@ -4,68 +4,90 @@
 #define PARTY_CYCLE_EFFECT_H
 
 #include "Effect.h"
+#include "EffectRegistry.h"
+#include "../RenderWorker.h"
 #include <vector>
 #include "FastLED.h"
 
 class PartyCycleEffect : public Effect {
 public:
-    PartyCycleEffect(LEDController& ledController, const std::vector<Effect*>& partyEffects);
+    /**
+     * Constructor
+     * @param ledController Reference to the LED controller to use
+     * @param registry Registry that builds the party effects when the cycle reaches them
+     * @param partyEffectIds Registry ids of the effects to cycle through, in order
+     */
+    PartyCycleEffect(LEDController& ledController, EffectRegistry& registry, const std::vector<int>& partyEffectIds);
     ~PartyCycleEffect();
 
-    void update() override;
     void reset() override;
-    String getName() const override { return "Party Cycle Effect"; }
+    const char* getName() const override { return "Party Cycle Effect"; }
+
+    /**
+     * Pass the detail level on to every effect in the cycle
+     * During a transition two of them draw each frame, which is where
+     * lowering the quality helps most
+     * @param quality 1.0 = full detail, down to MIN_QUALITY
+     */
+    void setQuality(float quality) override;
+
+    /**
+     * The cycle draws each of its party effects
+     * @param effect Effect to look for
+     * @return True for the cycle itself and every built effect in it
+     */
+    bool containsEffect(const Effect* effect) const override;
+
+    /**
+     * Draw the incoming effect of a transition on another core
+     * @param worker Worker to use (nullptr = draw both effects here)
+     */
+    void setRenderWorker(RenderWorker* worker) { this->worker = worker; }
 
 private:
-    // LED state storage for transitions
-    struct LEDSnapshot {
-        CRGB core[LED_STRIP_CORE_COUNT];
-        CRGB inner[LED_STRIP_INNER_COUNT];
-        CRGB outer[LED_STRIP_OUTER_COUNT];
-        CRGB ring[LED_STRIP_RING_COUNT];
-    };
-
-    std::vector<Effect*> partyEffects;  // Copy of effects to cycle through
+    void render() override;
+
+    EffectRegistry& registry;           // Builds the party effects on first use
+    std::vector<int> partyEffectIds;    // Registry ids of the effects to cycle through
+    RenderWorker* worker;               // Draws the incoming effect in parallel (nullptr = none)
     int currentEffectIndex;             // Current effect being shown
     int nextEffectIndex;                // Next effect for transitions
     bool inTransition;                  // True when transitioning between effects
 
     unsigned long effectStartTime;     // When current effect started
     unsigned long transitionStartTime; // When current transition started
+    unsigned long transitionFrameCount; // Frames so far in the current transition
 
-    // LED state snapshots for blending
-    LEDSnapshot oldEffectLEDs;          // LEDs from the outgoing effect
-    LEDSnapshot newEffectLEDs;          // LEDs from the incoming effect
+    // During a transition each effect draws into its own target and the
+    // two are blended into ours, so neither effect overwrites the other
+    OffscreenTarget oldEffectFrame;     // Frames of the outgoing effect
+    OffscreenTarget newEffectFrame;     // Frames of the incoming effect
 
     static const unsigned long EFFECT_DURATION = 600000;   // 10 minutes per effect (600,000 ms)
     static const unsigned long TRANSITION_DURATION = 8000;  // 8 seconds transition
 
     /**
-     * Start transitioning to the next effect
+     * Get one of the party effects, building it if needed
+     * Not kept between frames - the registry may release effects we are not drawing
+     * @param index Position in the cycle
      */
-    void startTransition();
+    Effect* partyEffect(int index) { return registry.get(partyEffectIds[index]); }
 
     /**
-     * Update the transition between two effects
+     * Get the catalog name of one of the party effects (without building it)
+     * @param index Position in the cycle
      */
-    void updateTransition();
+    const char* partyEffectName(int index) const;
 
     /**
-     * Store current LED state before manipulation
-     */
-    void storeLEDState();
-
-    /**
-     * Capture current LED state into a snapshot
-     * @param snapshot The snapshot to store the current LED state in
+     * Start transitioning to the next effect
      */
-    void captureLEDState(LEDSnapshot& snapshot);
+    void startTransition();
 
     /**
-     * Blend two effect states together (optimized version)
-     * @param fadeProgress Progress of fade (0.0 = full old, 1.0 = full new)
+     * Update the transition between two effects
      */
-    void blendEffectsOptimized(float fadeProgress);
+    void updateTransition();
 
     /**
      * Add representative colors to the notification section of the ring
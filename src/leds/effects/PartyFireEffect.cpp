@@ -38,16 +38,17 @@ void PartyFireEffect::reset() {
     Serial.println("PartyFireEffect reset - all animations restarted");
 }
 
-void PartyFireEffect::update() {
-    // Handle fire effect timing separately from core/ring timing
-    unsigned long currentTime = millis();
-
-    // Update fire effect at its own pace (20ms intervals like base FireEffect)
-    if (currentTime - lastUpdateTime >= 20) {
-        lastUpdateTime = currentTime;
+void PartyFireEffect::render() {
+    // Every call is a frame (no cap) - measure the time step for the core and ring breathing
+    beginFrame(0, REFERENCE_FRAME_MS);
 
+    // Update fire effect at its own pace (20ms ticks like base FireEffect)
+    int fireTicks = frameTicks(FIRE_STEP_MS);
+    if (fireTicks > 0) {
         // Update the fire simulation (this is the core fire algorithm)
-        updateFireBase();
+        for (; fireTicks > 0; fireTicks--) {
+            updateFireBase();
+        }
 
         // Render the fire to inner and outer strips (but not show yet)
         renderFire();
@@ -56,9 +57,6 @@ void PartyFireEffect::update() {
     // Update core and ring at their own independent timing
     updateCoreGlow();
     updateRingBreathing();
-
-    // Show all the updated LEDs only once per frame
-    leds.showAll();
 }
 
 void PartyFireEffect::updateCoreGlow() {
@@ -66,7 +64,7 @@ void PartyFireEffect::updateCoreGlow() {
 
     // Always update breathing phase for core breathing effect
     static float coreBreathingPhase = 0.0f;
-    coreBreathingPhase += 0.01f; // Back to original breathing speed
+    coreBreathingPhase += 0.01f * frameStep; // Back to original breathing speed
 
     // Keep phase within 0 to 2*PI range
     if (coreBreathingPhase > 2.0f * PI) {
@@ -95,7 +93,7 @@ void PartyFireEffect::updateCoreGlow() {
         lastCoreUpdate = currentTime;
 
         // Minimal random variation to keep breathing obvious
-        float intensityVariation = (random(100) / 100.0f) * 0.03f - 0.015f; // ±1.5% variation
+        float intensityVariation = (rng.range(100) / 100.0f) * 0.03f - 0.015f; // ±1.5% variation
         coreGlowIntensity = breathingIntensity + intensityVariation;
 
         // Keep intensity within valid range
@@ -116,7 +114,7 @@ void PartyFireEffect::updateRingBreathing() {
     unsigned long currentTime = millis();
 
     // Always update the breathing phase for smooth animation
-    ringBreathingPhase += ringBreathingSpeed;
+    ringBreathingPhase += ringBreathingSpeed * frameStep;
 
     // Keep phase within 0 to 2*PI range
     if (ringBreathingPhase > 2.0f * PI) {
@@ -133,7 +131,7 @@ void PartyFireEffect::updateRingBreathing() {
     // Check if it's time to randomly change breathing speed (for unpredictability)
     if (currentTime >= nextSpeedChange) {
         ringBreathingSpeed = generateRandomBreathingSpeed();
-        nextSpeedChange = currentTime + SPEED_CHANGE_INTERVAL + random(1000); // Add 0-1 second randomness
+        nextSpeedChange = currentTime + SPEED_CHANGE_INTERVAL + rng.range(1000); // Add 0-1 second randomness
 
         Serial.print("Ring breathing speed changed to: ");
         Serial.println(ringBreathingSpeed, 4);
@@ -144,7 +142,7 @@ void PartyFireEffect::updateRingBreathing() {
         lastRingUpdate = currentTime;
 
         // Apply some random flicker for fire unpredictability
-        float flicker = (random(100) / 100.0f) * 0.15f - 0.075f; // ±7.5% flicker
+        float flicker = (rng.range(100) / 100.0f) * 0.15f - 0.075f; // ±7.5% flicker
         ringIntensity += flicker;
 
         // Keep intensity within valid range
@@ -182,15 +180,8 @@ void PartyFireEffect::applyCoreGradient(float intensity) {
             // Apply overall breathing intensity
             float finalIntensity = gradientIntensity * intensity;
 
-            // Convert deep red color to RGB components
-            CRGB baseColor = leds.neoColorToCRGB(CORE_DEEP_RED);
-
-            // Apply intensity to create the final color
-            CRGB finalColor = CRGB(
-                baseColor.r * finalIntensity,
-                baseColor.g * finalIntensity,
-                baseColor.b * finalIntensity
-            );
+            // Apply intensity to the deep red to create the final color
+            CRGB finalColor = Colors::scaled(Colors::fromHex(CORE_DEEP_RED), finalIntensity);
 
             // Get physical LED position (handles segment flipping automatically)
             int physicalPos = mapLEDPosition(0, i, segment); // 0 = core strip type
@@ -199,7 +190,7 @@ void PartyFireEffect::applyCoreGradient(float intensity) {
             int actualLEDIndex = (segment * segmentLength) + physicalPos;
 
             if (actualLEDIndex >= 0 && actualLEDIndex < LED_STRIP_CORE_COUNT) {
-                leds.getCore()[actualLEDIndex] = finalColor;
+                target->getCore()[actualLEDIndex] = finalColor;
             }
         }
     }
@@ -210,31 +201,19 @@ void PartyFireEffect::applyRingGlow(float intensity) {
     // Use breathing intensity to blend between the two red colors
 
     // Color 1: Primary red (0xEE1100) - brighter red
-    CRGB color1 = leds.neoColorToCRGB(RING_RED_PRIMARY);
-
     // Color 2: Deeper red (0xCC0000) - darker red
-    CRGB color2 = leds.neoColorToCRGB(RING_RED_SECONDARY);
-
     // Use intensity to blend between colors (0.0 = color2, 1.0 = color1)
     // This creates a color fade as the ring breathes
     float blendRatio = intensity; // Higher intensity = brighter red, lower = deeper red
 
-    CRGB blendedColor = CRGB(
-        color2.r + ((color1.r - color2.r) * blendRatio),
-        color2.g + ((color1.g - color2.g) * blendRatio),
-        color2.b + ((color1.b - color2.b) * blendRatio)
-    );
+    CRGB blendedColor = Colors::mix(Colors::fromHex(RING_RED_SECONDARY), Colors::fromHex(RING_RED_PRIMARY), blendRatio);
 
     // Apply the overall intensity to the blended color for brightness breathing
-    CRGB finalColor = CRGB(
-        blendedColor.r * intensity,
-        blendedColor.g * intensity,
-        blendedColor.b * intensity
-    );
+    CRGB finalColor = Colors::scaled(blendedColor, intensity);
 
     // Set all ring LEDs to the final color
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        leds.getRing()[i] = finalColor;
+        target->getRing()[i] = finalColor;
     }
 }
 
@@ -247,7 +226,7 @@ float PartyFireEffect::generateRandomBreathingSpeed() {
     float maxSpeed = 0.04f;   // Fast breathing (about 1.5 seconds per cycle)
 
     // Generate random speed in this range
-    float randomSpeed = minSpeed + ((random(100) / 100.0f) * (maxSpeed - minSpeed));
+    float randomSpeed = minSpeed + ((rng.range(100) / 100.0f) * (maxSpeed - minSpeed));
 
     return randomSpeed;
 }
\ No newline at end of file
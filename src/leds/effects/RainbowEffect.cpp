@@ -1,4 +1,5 @@
 #include "RainbowEffect.h"
+#include "../HSVKernel.h"
 
 RainbowEffect::RainbowEffect(LEDController &ledController,
                            bool enableCore,
@@ -9,11 +10,13 @@ RainbowEffect::RainbowEffect(LEDController &ledController,
     cycle(0),
     animationSpeed(30.0f), // 30 cycles per second for smooth rainbow movement
     breathingPhase(0.0f),
-    breathingSpeed(0.004f), // Speed to complete 5 second breathing cycle (2*PI / 5000ms * 8ms)
+    breathingSpeed(0.5f),   // Radians per second - about a 12.5 second breathing cycle (same as 0.004 per 8ms frame)
     coreEnabled(enableCore),
     innerEnabled(enableInner),
     outerEnabled(enableOuter),
-    ringEnabled(enableRing)
+    ringEnabled(enableRing),
+    frameHue(0),
+    frameCoreScale(0)
 {
     // Constructor - no LED clearing as per instructions
 }
@@ -21,35 +24,28 @@ RainbowEffect::RainbowEffect(LEDController &ledController,
 void RainbowEffect::reset() {
     cycle = 0;
     breathingPhase = 0.0f;              // Reset breathing to start position
-    lastUpdateTime = millis();          // Reset timing when effect resets
+    lastUpdateTime = now();             // Reset timing when effect resets
+    resetBakedLoop();
 }
 
-void RainbowEffect::update() {
+void RainbowEffect::render() {
     // Target 120 FPS for ultra-smooth rainbow animation
-    if (!shouldUpdate(8)) {
+    if (!beginFrame(8, 8.0f)) {
         // 8ms = 125 FPS (close to 120)
         return;
     }
 
-    // Clear all LEDs first - this ensures disabled strips stay off
-    leds.clearAll();
-
-    // Calculate time delta manually since shouldUpdate() already updated lastUpdateTime
-    // Use a fixed 8ms delta since we're limiting to 125 FPS
-    float deltaTimeMs = 8.0f; // Fixed delta time in milliseconds
-    float deltaTimeSeconds = deltaTimeMs / 1000.0f; // Convert to seconds
-
-    // Update rainbow cycle based on elapsed time and desired animation speed
+    // Update rainbow cycle based on the real time since the last frame
     // animationSpeed is cycles per second
-    cycle += animationSpeed * deltaTimeSeconds;
+    cycle += animationSpeed * frameSeconds;
 
     // Keep cycle within reasonable bounds (0-255 range)
     if (cycle >= 256.0f) {
         cycle -= 256.0f;
     }
 
-    // Update breathing phase for core strip (5 second full cycle)
-    breathingPhase += breathingSpeed;
+    // Update breathing phase for core strip
+    breathingPhase += breathingSpeed * frameSeconds;
     if (breathingPhase > 2.0f * PI) {
         breathingPhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
     }
@@ -62,54 +58,57 @@ void RainbowEffect::update() {
     float coreBrightness = normalizedSine;
 
     // Convert float cycle to integer for hue calculations
-    uint16_t baseHue = (uint16_t) (cycle * 256);
-
-    // Core strip - gradient around the strip with breathing brightness and 2x speed
-    // Only update if core is enabled
-    if (coreEnabled) {
-        for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-            // Make core colors move twice as fast by multiplying baseHue by 2
-            int pixelHue = (baseHue * 2) + (i * 65536 / LED_STRIP_CORE_COUNT);
-
-            // Create the rainbow color at full brightness first
-            CHSV hsvColor(pixelHue >> 8, 255, 255);
-            CRGB rgbColor;
-            hsv2rgb_rainbow(hsvColor, rgbColor);
-
-            // Apply breathing brightness to the RGB color
-            rgbColor.nscale8_video((uint8_t)(coreBrightness * 255));
-
-            leds.getCore()[i] = rgbColor;
-        }
-    }
+    frameHue = (uint16_t) (cycle * 256);
+    frameCoreScale = (uint8_t)(coreBrightness * 255);
 
-    // Inner strip - normal rainbow gradient (no breathing)
-    // Only update if inner is enabled
-    if (innerEnabled) {
-        for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-            int pixelHue = baseHue + (i * 65536 / LED_STRIP_INNER_COUNT);
-            leds.getInner()[i] = CHSV(pixelHue >> 8, 255, 255);
-        }
-    }
-
-    // Outer strip - normal rainbow gradient (no breathing)
-    // Only update if outer is enabled
-    if (outerEnabled) {
-        for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-            int pixelHue = baseHue + (i * 65536 / LED_STRIP_OUTER_COUNT);
-            leds.getOuter()[i] = CHSV(pixelHue >> 8, 255, 255);
-        }
-    }
+    // Every strip is independent - draw them on both cores
+    renderStrips();
+}
 
-    // Ring strip - normal rainbow gradient (no breathing, unless skipped for button feedback)
-    // Only update if ring is enabled AND not skipped for button feedback
-    if (ringEnabled && !skipRing) {
-        for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-            int pixelHue = baseHue + (i * 65536 / LED_STRIP_RING_COUNT);
-            leds.getRing()[i] = CHSV(pixelHue >> 8, 255, 255);
-        }
+void RainbowEffect::renderStrip(StripJob strip) {
+    // Disabled strips are drawn black so they stay off
+    switch (strip) {
+        case STRIP_JOB_CORE:
+            // Core strip - gradient around the strip with breathing brightness and 2x speed
+            if (coreEnabled) {
+                // Make core colors move twice as fast by multiplying the hue by 2
+                HSVKernel::fillRainbow(target->getCore(), LED_STRIP_CORE_COUNT, frameHue * 2, 65536);
+
+                // Apply breathing brightness to the RGB colors
+                nscale8_video(target->getCore(), LED_STRIP_CORE_COUNT, frameCoreScale);
+            } else {
+                fill_solid(target->getCore(), LED_STRIP_CORE_COUNT, CRGB::Black);
+            }
+            break;
+
+        case STRIP_JOB_INNER:
+            // Inner strip - normal rainbow gradient (no breathing)
+            if (innerEnabled) {
+                HSVKernel::fillRainbow(target->getInner(), LED_STRIP_INNER_COUNT, frameHue, 65536);
+            } else {
+                fill_solid(target->getInner(), LED_STRIP_INNER_COUNT, CRGB::Black);
+            }
+            break;
+
+        case STRIP_JOB_OUTER:
+            // Outer strip - normal rainbow gradient (no breathing)
+            if (outerEnabled) {
+                HSVKernel::fillRainbow(target->getOuter(), LED_STRIP_OUTER_COUNT, frameHue, 65536);
+            } else {
+                fill_solid(target->getOuter(), LED_STRIP_OUTER_COUNT, CRGB::Black);
+            }
+            break;
+
+        case STRIP_JOB_RING:
+            // Ring strip - normal rainbow gradient (no breathing, unless skipped for button feedback)
+            if (ringEnabled && !skipRing) {
+                HSVKernel::fillRainbow(target->getRing(), LED_STRIP_RING_COUNT, frameHue, 65536);
+            } else {
+                fill_solid(target->getRing(), LED_STRIP_RING_COUNT, CRGB::Black);
+            }
+            break;
+
+        default:
+            break;
     }
-
-    // Show the LEDs
-    leds.showAll();
-}
\ No newline at end of file
+}
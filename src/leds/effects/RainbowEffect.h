@@ -27,12 +27,6 @@ public:
                   bool enableOuter = true,
                   bool enableRing = true);
 
-    /**
-     * Update the rainbow animation
-     * Uses frame rate independent timing for consistent speed
-     */
-    void update() override;
-
     /**
      * Reset the effect to starting position
      */
@@ -42,21 +36,46 @@ public:
      * Get the name of this effect
      * @return Effect name for display/debugging
      */
-    String getName() const override { return "Rainbow Effect"; }
+    const char* getName() const override { return "Rainbow Effect"; }
+
+    // Each strip is an independent rainbow span
+    bool hasStripJobs() const override { return true; }
+
+    /**
+     * Loop length for baking: three full hue cycles, which is also about
+     * two breathing cycles (the seam crossfade covers the difference)
+     */
+    unsigned long loopPeriodMs() const override { return (unsigned long)(3 * 256 * 1000.0f / animationSpeed); }
 
 private:
+    /**
+     * Update the rainbow animation
+     * Uses frame rate independent timing for consistent speed
+     */
+    void render() override;
+
+    /**
+     * Draw one strip of the frame set up by render()
+     * @param strip Which strip to draw
+     */
+    void renderStrip(StripJob strip) override;
+
     float cycle;            // Current position in rainbow cycle (0-255.99)
     float animationSpeed;   // Animation speed in cycles per second
 
     // Core breathing effect variables
     float breathingPhase;   // Current phase of breathing cycle (0.0 to 2*PI)
-    float breathingSpeed;   // Speed of breathing cycle (to complete 5 second cycle)
+    float breathingSpeed;   // Speed of breathing cycle in radians per second
 
     // Strip enable flags - control which strips show the rainbow effect
     bool coreEnabled;       // Whether core strip shows rainbow (with breathing)
     bool innerEnabled;      // Whether inner strips show rainbow
     bool outerEnabled;      // Whether outer strips show rainbow
     bool ringEnabled;       // Whether ring strip shows rainbow
+
+    // This frame, set up by render() for the strip jobs
+    uint16_t frameHue;       // Rainbow start hue of the inner, outer and ring strips
+    uint8_t frameCoreScale;  // Core breathing brightness (0-255)
 };
 
 #endif // RAINBOW_EFFECT_H
\ No newline at end of file
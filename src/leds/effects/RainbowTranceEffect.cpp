@@ -1,6 +1,7 @@
 // src/leds/effects/RainbowTranceEffect.cpp
 
 #include "RainbowTranceEffect.h"
+#include "../HSVKernel.h"
 
 RainbowTranceEffect::RainbowTranceEffect(LEDController& ledController) :
     Effect(ledController),
@@ -8,12 +9,15 @@ RainbowTranceEffect::RainbowTranceEffect(LEDController& ledController) :
     currentSize(0),
     leftPosition(0),
     rightPosition(0),
-    lastUpdateTime(0),
+    lastCoreStepTime(0),
     lastTrailCreateTime(0),
     breathingPhase(0.0f),
     breathingSpeed(0.02f),      // Slow breathing cycle
     minBrightness(0.4f),        // 40% minimum brightness
-    maxBrightness(1.0f)         // 100% maximum brightness
+    maxBrightness(1.0f),        // 100% maximum brightness
+    persistentTrails(false),
+    innerTrailBuffer(LED_STRIP_INNER_COUNT),
+    outerTrailBuffer(LED_STRIP_OUTER_COUNT)
 {
     // Initialize synchronized trails vector with larger capacity
     syncedTrails.reserve(MAX_TRAILS);
@@ -24,6 +28,11 @@ RainbowTranceEffect::RainbowTranceEffect(LEDController& ledController) :
     // Initialize the 3 continuous ring trails
     initializeRingTrails();
 
+    // Both strips share the same trail speeds, so they use the same decay factor
+    uint16_t trailDecay = DecayBuffer::decayForTrail(TYPICAL_TRAIL_SPEED, TRAIL_HALF_LIFE);
+    innerTrailBuffer.setDecay(trailDecay);
+    outerTrailBuffer.setDecay(trailDecay);
+
     Serial.println("RainbowTranceEffect created - random colored core + synchronized inner/outer trails + 3 RGB ring trails");
 }
 
@@ -32,8 +41,8 @@ void RainbowTranceEffect::reset() {
     currentSize = 0;
     leftPosition = 0;
     rightPosition = 0;
-    lastUpdateTime = millis();
-    lastTrailCreateTime = millis();
+    lastCoreStepTime = now();
+    lastTrailCreateTime = now();
 
     // Generate new random colors for core effect
     generateRandomCoreColor();
@@ -44,6 +53,19 @@ void RainbowTranceEffect::reset() {
     // Ring trails continue without reset - they're continuous
 
     Serial.println("RainbowTranceEffect reset to growing phase with new random colors (trails continue)");
+
+    // Fill the strips with trails in flight rather than starting empty
+    warmUp(warmUpMs());
+}
+
+void RainbowTranceEffect::setPersistentTrails(bool enabled) {
+    if (enabled == persistentTrails) return;
+
+    persistentTrails = enabled;
+
+    // Start from empty buffers so old tails don't flash in when switching modes
+    innerTrailBuffer.clear();
+    outerTrailBuffer.clear();
 }
 
 void RainbowTranceEffect::generateRandomCoreColor() {
@@ -78,7 +100,7 @@ void RainbowTranceEffect::generateRandomCoreColor() {
 
 void RainbowTranceEffect::generateRandomTrailColor(SyncedTrail& trail) {
     // Randomly choose red, green, or blue for each trail
-    int colorChoice = random(3); // 0, 1, or 2
+    int colorChoice = rng.range(3); // 0, 1, or 2
 
     switch (colorChoice) {
         case 0:
@@ -152,42 +174,66 @@ float RainbowTranceEffect::calculateRingBreathingBrightness() {
     return RING_MIN_BRIGHTNESS + (normalizedSine * (RING_MAX_BRIGHTNESS - RING_MIN_BRIGHTNESS));
 }
 
-void RainbowTranceEffect::update() {
-    // Clear all strips first
-    leds.clearAll();
-
-    // Update breathing phase for trails (synchronized)
-    breathingPhase += breathingSpeed;
-    if (breathingPhase > 2.0f * PI) {
-        breathingPhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
+void RainbowTranceEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, REFERENCE_FRAME_MS);
+    updateSyncedTrails();
+    if (persistentTrails) {
+        stampWarmUpTrails();
     }
+    spawnSyncedTrails(now());
+}
 
-    unsigned long currentTime = millis();
+void RainbowTranceEffect::stampWarmUpTrails() {
+    innerTrailBuffer.fade(frameStep);
+    outerTrailBuffer.fade(frameStep);
 
-    // Update and draw synchronized trails first (so core effect can overlap)
-    updateSyncedTrails();
-    drawSyncedTrails();
+    // A step moves a head several LEDs - stamp every LED it passed, faded
+    // by how long ago it was there, so the tail looks like the live one
+    for (const auto& trail : syncedTrails) {
+        if (!trail.active || trail.speed <= 0.0f) continue;
 
-    // Update continuous ring trails
-    updateRingTrails();
+        int stripLength = (trail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
+        int numSegments = (trail.stripType == 1) ? NUM_INNER_STRIPS : NUM_OUTER_STRIPS;
+        float travelled = trail.speed * frameStep;
+        float start = trail.direction ? trail.position - travelled : trail.position + travelled;
+        int from = (int)min(start, trail.position);
+        int to = (int)max(start, trail.position);
+        CRGB color = HSVKernel::hsv(trail.hue, trail.saturation, trail.brightness);
+
+        for (int headPos = max(from, 0); headPos <= min(to, stripLength - 1); headPos++) {
+            float framesAgo = fabsf(trail.position - headPos) / trail.speed;
+            for (int segment = 0; segment < numSegments; segment++) {
+                int physicalPos = leds.mapPositionToPhysical(trail.stripType, headPos, segment);
+                if (trail.stripType == 1) {
+                    innerTrailBuffer.stampFaded(physicalPos + segment * INNER_LEDS_PER_STRIP, color, framesAgo);
+                } else {
+                    outerTrailBuffer.stampFaded(physicalPos + segment * OUTER_LEDS_PER_STRIP, color, framesAgo);
+                }
+            }
+        }
+    }
+}
 
-    // Create new synchronized trails with more aggressive creation
+void RainbowTranceEffect::spawnSyncedTrails(unsigned long currentTime) {
     int activeTrails = 0;
     for (const auto& trail : syncedTrails) {
         if (trail.active) activeTrails++;
     }
 
     // Calculate dynamic interval with randomness to prevent synchronized waves
-    int createInterval = TRAIL_CREATE_INTERVAL + random(-TRAIL_STAGGER_VARIANCE, TRAIL_STAGGER_VARIANCE);
+    int createInterval = TRAIL_CREATE_INTERVAL + rng.range(-TRAIL_STAGGER_VARIANCE, TRAIL_STAGGER_VARIANCE);
+
+    // Fewer trails at reduced quality - the ones already running still finish
+    int targetTrails = qualityBudget(TARGET_TRAILS);
 
     // Always try to maintain target trails with frequent creation
-    if (activeTrails < TARGET_TRAILS && (currentTime - lastTrailCreateTime >= createInterval)) {
+    if (activeTrails < targetTrails && (currentTime - lastTrailCreateTime >= createInterval)) {
         createNewSyncedTrail();
         lastTrailCreateTime = currentTime;
     }
 
     // More aggressive creation if we're well below target
-    if (activeTrails < TARGET_TRAILS * 0.7) {
+    if (activeTrails < targetTrails * 0.7) {
         // Create multiple trails rapidly when low
         for (int i = 0; i < 2; i++) {
             createNewSyncedTrail();
@@ -196,18 +242,48 @@ void RainbowTranceEffect::update() {
     }
 
     // Emergency creation if we're very low
-    if (activeTrails < TARGET_TRAILS * 0.4) {
+    if (activeTrails < targetTrails * 0.4) {
         // Create even more trails when very low
         for (int i = 0; i < 3; i++) {
             createNewSyncedTrail();
         }
         lastTrailCreateTime = currentTime - createInterval; // Reset timer to allow immediate next creation
     }
+}
+
+void RainbowTranceEffect::render() {
+    // No frame rate cap - just measure the time step so motion speed does not depend on it
+    beginFrame(0, REFERENCE_FRAME_MS);
+
+    // Clear all strips first
+    target->clearAll();
+
+    // Update breathing phase for trails (synchronized)
+    breathingPhase += breathingSpeed * frameStep;
+    if (breathingPhase > 2.0f * PI) {
+        breathingPhase -= 2.0f * PI;  // Keep phase in 0 to 2*PI range
+    }
+
+    unsigned long currentTime = now();
+
+    // Update and draw synchronized trails first (so core effect can overlap)
+    updateSyncedTrails();
+    if (persistentTrails) {
+        drawSyncedTrailsPersistent();
+    } else {
+        drawSyncedTrails();
+    }
+
+    // Update continuous ring trails
+    updateRingTrails();
+
+    // Create new synchronized trails with more aggressive creation
+    spawnSyncedTrails(currentTime);
 
     // Core effect logic with random colors
     if (currentPhase == GROWING) {
         // GROWING PHASE: Grow from 1 to 17 LEDs with current random color
-        if (currentTime - lastUpdateTime >= GROW_INTERVAL) {
+        if (currentTime - lastCoreStepTime >= GROW_INTERVAL) {
             currentSize++;
 
             // When we reach full size, switch to moving phase
@@ -222,7 +298,7 @@ void RainbowTranceEffect::update() {
 
                 Serial.println("Switching to moving phase - random colored patterns will move in both directions");
             } else {
-                lastUpdateTime = currentTime;
+                lastCoreStepTime = currentTime;
             }
         }
 
@@ -238,12 +314,12 @@ void RainbowTranceEffect::update() {
 
     } else if (currentPhase == MOVING) {
         // MOVING PHASE: Two full patterns moving in opposite directions
-        if (currentTime - lastUpdateTime >= MOVE_INTERVAL) {
+        if (currentTime - lastCoreStepTime >= MOVE_INTERVAL) {
             // Move both patterns
             leftPosition--;   // Move left pattern toward start of segment
             rightPosition++;  // Move right pattern toward end of segment
 
-            lastUpdateTime = currentTime;
+            lastCoreStepTime = currentTime;
 
             // Check if both patterns are completely off the strip
             int coreSegmentLength = LED_STRIP_CORE_COUNT / 3;
@@ -259,7 +335,7 @@ void RainbowTranceEffect::update() {
                 currentSize = 0;
                 leftPosition = 0;
                 rightPosition = 0;
-                lastUpdateTime = currentTime;
+                lastCoreStepTime = currentTime;
 
                 return;
             }
@@ -284,9 +360,6 @@ void RainbowTranceEffect::update() {
             drawPattern(segment, segmentRightPos);
         }
     }
-
-    // Show the LEDs
-    leds.showAll();
 }
 
 void RainbowTranceEffect::updateRingTrails() {
@@ -298,7 +371,7 @@ void RainbowTranceEffect::updateRingTrails() {
     // Update positions of all 3 continuous trails
     for (int i = 0; i < NUM_RING_TRAILS; i++) {
         // Move the trail around the ring
-        ringTrails[i].position += ringTrails[i].speed;
+        ringTrails[i].position += ringTrails[i].speed * frameStep;
 
         // Wrap around when we reach the end
         if (ringTrails[i].position >= LED_STRIP_RING_COUNT) {
@@ -313,7 +386,7 @@ void RainbowTranceEffect::updateRingTrails() {
 void RainbowTranceEffect::drawRingTrails() {
     // Clear the ring first
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        leds.getRing()[i] = CRGB::Black;
+        target->getRing()[i] = CRGB::Black;
     }
 
     // Calculate the current breathing brightness multiplier for all ring trails
@@ -324,9 +397,7 @@ void RainbowTranceEffect::drawRingTrails() {
         const auto& trail = ringTrails[t];
 
         // Convert trail's fixed hue to RGB at full saturation and brightness
-        CHSV baseHSV(trail.hue, 255, 255);
-        CRGB baseRGB;
-        hsv2rgb_rainbow(baseHSV, baseRGB);
+        CRGB baseRGB = HSVKernel::rainbow(trail.hue);
 
         // Draw the trail
         for (int i = 0; i < trail.length; i++) {
@@ -351,7 +422,7 @@ void RainbowTranceEffect::drawRingTrails() {
             );
 
             // Add the color to the existing pixel (allows overlapping trails to blend)
-            leds.getRing()[pixelPos] += color;
+            target->getRing()[pixelPos] += color;
         }
     }
 }
@@ -365,13 +436,13 @@ void RainbowTranceEffect::createNewSyncedTrail() {
     SyncedTrail newTrail;
 
     // Randomly choose inner (1) or outer (2) strips
-    newTrail.stripType = random(1, 3);
+    newTrail.stripType = rng.range(1, 3);
 
     // Get strip length
     int stripLength = (newTrail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
 
     // Randomly choose direction for both inner and outer strips
-    newTrail.direction = random(2) == 1; // true = upward, false = downward
+    newTrail.direction = rng.range(2) == 1; // true = upward, false = downward
 
     // Set starting position based on direction (start trails completely off the strip)
     if (newTrail.direction) {
@@ -383,8 +454,8 @@ void RainbowTranceEffect::createNewSyncedTrail() {
     }
 
     // More varied speeds for interesting interactions when trails overlap
-    float baseSpeed = 0.10f + (random(100) / 100.0f) * 0.25f; // Wider speed range: 0.10 to 0.35
-    float speedVariance = (random(100) / 100.0f) * 0.05f - 0.025f; // ±0.025 variance
+    float baseSpeed = 0.10f + (rng.range(100) / 100.0f) * 0.25f; // Wider speed range: 0.10 to 0.35
+    float speedVariance = (rng.range(100) / 100.0f) * 0.05f - 0.025f; // ±0.025 variance
     newTrail.speed = baseSpeed + speedVariance;
     newTrail.active = true;
 
@@ -403,10 +474,10 @@ void RainbowTranceEffect::updateSyncedTrails() {
         // Move the trail
         if (trail.direction) {
             // Moving upward
-            trail.position += trail.speed;
+            trail.position += trail.speed * frameStep;
         } else {
             // Moving downward
-            trail.position -= trail.speed;
+            trail.position -= trail.speed * frameStep;
         }
 
         // Get strip length
@@ -482,22 +553,20 @@ void RainbowTranceEffect::drawSyncedTrails() {
                 }
 
                 // Use the trail's RGB color throughout the entire trail
-                CHSV hsvColor(trail.hue, trail.saturation, trail.brightness * brightness);
-                CRGB color;
-                hsv2rgb_rainbow(hsvColor, color);
+                CRGB color = HSVKernel::hsv(trail.hue, trail.saturation, trail.brightness * brightness);
 
                 // Add the color to blend with existing colors when trails overlap
                 if (trail.stripType == 1) {
                     // Inner strips
                     if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
                         // Use additive blending for color mixing
-                        leds.getInner()[physicalPos] += color;
+                        target->getInner()[physicalPos] += color;
                     }
                 } else {
                     // Outer strips
                     if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
                         // Use additive blending for color mixing
-                        leds.getOuter()[physicalPos] += color;
+                        target->getOuter()[physicalPos] += color;
                     }
                 }
             }
@@ -505,9 +574,50 @@ void RainbowTranceEffect::drawSyncedTrails() {
     }
 
     // Second pass: Apply brightness limiting to prevent oversaturation
+    limitTrailBrightness();
+}
+
+void RainbowTranceEffect::drawSyncedTrailsPersistent() {
+    // Fade the old head positions - this is what draws the tails
+    innerTrailBuffer.fade(frameStep);
+    outerTrailBuffer.fade(frameStep);
+
+    for (const auto& trail : syncedTrails) {
+        if (!trail.active) continue;
+
+        // Only the head is stamped; skip it while it is off the strip
+        int stripLength = (trail.stripType == 1) ? INNER_LEDS_PER_STRIP : OUTER_LEDS_PER_STRIP;
+        int headPos = (int)trail.position;
+        if (headPos < 0 || headPos >= stripLength) continue;
+
+        // Head color at full trail brightness (breathing is applied on output)
+        CRGB color = HSVKernel::hsv(trail.hue, trail.saturation, trail.brightness);
+
+        // Stamp the head on ALL segments of this strip type
+        int numSegments = (trail.stripType == 1) ? NUM_INNER_STRIPS : NUM_OUTER_STRIPS;
+        for (int segment = 0; segment < numSegments; segment++) {
+            int physicalPos = leds.mapPositionToPhysical(trail.stripType, headPos, segment);
+
+            if (trail.stripType == 1) {
+                innerTrailBuffer.stamp(physicalPos + segment * INNER_LEDS_PER_STRIP, color);
+            } else {
+                outerTrailBuffer.stamp(physicalPos + segment * OUTER_LEDS_PER_STRIP, color);
+            }
+        }
+    }
+
+    // Same breathing and 70% mixing headroom as the classic trails, applied once per LED
+    uint8_t outputScale = (uint8_t)(calculateBreathingBrightness() * 0.7f * 255.0f);
+    innerTrailBuffer.render(target->getInner(), outputScale);
+    outerTrailBuffer.render(target->getOuter(), outputScale);
+
+    limitTrailBrightness();
+}
+
+void RainbowTranceEffect::limitTrailBrightness() {
     // This ensures overlapping trails create nice color blends without becoming pure white
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        CRGB& pixel = leds.getInner()[i];
+        CRGB& pixel = target->getInner()[i];
         // Limit maximum brightness while preserving color ratios
         uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
         if (maxComponent > 200) {
@@ -519,7 +629,7 @@ void RainbowTranceEffect::drawSyncedTrails() {
     }
 
     for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        CRGB& pixel = leds.getOuter()[i];
+        CRGB& pixel = target->getOuter()[i];
         // Limit maximum brightness while preserving color ratios
         uint8_t maxComponent = max(max(pixel.r, pixel.g), pixel.b);
         if (maxComponent > 200) {
@@ -545,14 +655,12 @@ void RainbowTranceEffect::drawPattern(int segment, int centerPos) {
     int segmentEnd = segmentStart + coreSegmentLength - 1;
 
     // Convert core HSV color to RGB for drawing
-    CHSV coreHSV(coreHue, coreSaturation, coreBrightness);
-    CRGB coreRGB;
-    hsv2rgb_rainbow(coreHSV, coreRGB);
+    CRGB coreRGB = HSVKernel::hsv(coreHue, coreSaturation, coreBrightness);
 
     // Draw center LED in current random color at 100% brightness
     if (centerPos >= segmentStart && centerPos <= segmentEnd) {
-        CRGB currentColor = leds.getCore()[centerPos];
-        leds.getCore()[centerPos] = CRGB(
+        CRGB currentColor = target->getCore()[centerPos];
+        target->getCore()[centerPos] = CRGB(
             max(currentColor.r, coreRGB.r),
             max(currentColor.g, coreRGB.g),
             max(currentColor.b, coreRGB.b)
@@ -575,8 +683,8 @@ void RainbowTranceEffect::drawPattern(int segment, int centerPos) {
         // Left side LED
         int leftPos = centerPos - offset;
         if (leftPos >= segmentStart && leftPos <= segmentEnd) {
-            CRGB currentColor = leds.getCore()[leftPos];
-            leds.getCore()[leftPos] = CRGB(
+            CRGB currentColor = target->getCore()[leftPos];
+            target->getCore()[leftPos] = CRGB(
                 max(currentColor.r, fadedColor.r),
                 max(currentColor.g, fadedColor.g),
                 max(currentColor.b, fadedColor.b)
@@ -586,8 +694,8 @@ void RainbowTranceEffect::drawPattern(int segment, int centerPos) {
         // Right side LED
         int rightPos = centerPos + offset;
         if (rightPos >= segmentStart && rightPos <= segmentEnd) {
-            CRGB currentColor = leds.getCore()[rightPos];
-            leds.getCore()[rightPos] = CRGB(
+            CRGB currentColor = target->getCore()[rightPos];
+            target->getCore()[rightPos] = CRGB(
                 max(currentColor.r, fadedColor.r),
                 max(currentColor.g, fadedColor.g),
                 max(currentColor.b, fadedColor.b)
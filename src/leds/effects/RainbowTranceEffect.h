@@ -4,13 +4,14 @@
 #define RAINBOW_TRANCE_EFFECT_H
 
 #include "Effect.h"
+#include "../DecayBuffer.h"
 #include <vector>
 
 // Structure to represent a synchronized trail set for inner or outer strips
 struct SyncedTrail {
     int stripType;      // 1 = inner, 2 = outer
     float position;     // Current head position (float for smooth movement)
-    float speed;        // Movement speed (pixels per frame)
+    float speed;        // Movement speed (pixels per reference frame)
     bool active;        // Whether this trail is active
     bool direction;     // true = upward, false = downward
     uint8_t hue;        // Color hue for this trail (0-255)
@@ -21,7 +22,7 @@ struct SyncedTrail {
 // Structure to represent a continuous ring trail
 struct ContinuousRingTrail {
     float position;     // Current head position around the ring (0 to LED_STRIP_RING_COUNT)
-    float speed;        // Movement speed (pixels per frame)
+    float speed;        // Movement speed (pixels per reference frame)
     int length;         // Length of the trail
     uint8_t hue;        // Fixed color hue for this trail (0=red, 85=green, 160=blue)
     bool clockwise;     // Direction (always true for all 3 trails)
@@ -39,6 +40,11 @@ struct ContinuousRingTrail {
  * - Multiple trails can exist on the same strip and colors blend when overlapping
  * - Trails: Breathing effect that fades from 40% to 100% brightness
  * - Ring: 3 continuous trails (red, green, blue) circling clockwise, equally spaced
+ *
+ * Inner/outer trails can be drawn two ways:
+ * - Classic: every LED of every trail is redrawn each frame
+ * - Persistent: a per-strip DecayBuffer is faded each frame and only the trail
+ *   heads are stamped in, so the cost scales with the number of heads
  */
 class RainbowTranceEffect : public Effect {
 public:
@@ -49,21 +55,37 @@ public:
     RainbowTranceEffect(LEDController& ledController);
 
     /**
-     * Update the animation
+     * Reset the effect to initial state
      */
-    void update() override;
+    void reset() override;
 
     /**
-     * Reset the effect to initial state
+     * Long enough for the trails to spread along the strips
      */
-    void reset() override;
+    unsigned long warmUpMs() const override { return TRAIL_WARM_UP_MS; }
 
     /**
      * Get the name of this effect
      */
-    String getName() const override { return "Rainbow Trance Effect"; }
+    const char* getName() const override { return "Rainbow Trance Effect"; }
+
+    /**
+     * Switch between classic and persistent (decay buffer) trail rendering
+     * @param enabled True to stamp trail heads into decay buffers instead of redrawing full trails
+     */
+    void setPersistentTrails(bool enabled);
 
 private:
+    /**
+     * Update the animation
+     */
+    void render() override;
+
+    /**
+     * Create and move the synchronized trails for a warm-up step, without drawing
+     */
+    void simulate(unsigned long stepMs) override;
+
     // Animation phases for core effect
     enum Phase {
         GROWING = 0,    // Growing from 1 to 17 LEDs
@@ -74,7 +96,7 @@ private:
     int currentSize;                    // Current size during growing phase (0 to 8)
     int leftPosition;                   // Center position of left-moving pattern
     int rightPosition;                  // Center position of right-moving pattern
-    unsigned long lastUpdateTime;       // Last time we updated the animation
+    unsigned long lastCoreStepTime;     // Last time the core pattern grew or moved
 
     // Core effect random colors - these change each cycle
     uint8_t coreHue;                    // Current hue for core effect (0-255)
@@ -83,11 +105,12 @@ private:
 
     // Breathing effect variables for trails (synchronized)
     float breathingPhase;               // Current phase of breathing cycle (0.0 to 2*PI)
-    float breathingSpeed;               // Speed of breathing cycle
+    float breathingSpeed;               // Speed of breathing cycle (radians per reference frame)
     float minBrightness;                // Minimum brightness (40%)
     float maxBrightness;                // Maximum brightness (100%)
 
     // Timing constants for core effect
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;  // Frame length the per-frame speeds are tuned for
     static const int MAX_SIZE = 12;         // Maximum LEDs on each side of center (total 25 = 12+1+12)
     static const int GROW_INTERVAL = 100;   // Milliseconds between each growth step (slower for smoother appearance)
     static const int MOVE_INTERVAL = 50;    // Milliseconds between each movement step (faster for smoother movement)
@@ -101,10 +124,20 @@ private:
     unsigned long lastTrailCreateTime;       // Last time we created a trail
     static const int TRAIL_CREATE_INTERVAL = 40;   // Create a new trail every 40ms (decreased from 80ms)
     static const int TRAIL_STAGGER_VARIANCE = 20;  // Add random variance to prevent waves (decreased from 40)
+    static const unsigned long TRAIL_WARM_UP_MS = 6000; // Trails start a full length off the strip - about 4s before they show
 
     // Trail management - now using synchronized trails
     std::vector<SyncedTrail> syncedTrails;  // Collection of synchronized trail sets
 
+    // Persistent trail rendering
+    bool persistentTrails;                  // True = decay buffer mode, false = classic full redraw
+    DecayBuffer innerTrailBuffer;           // Persistence buffer for the inner strips
+    DecayBuffer outerTrailBuffer;           // Persistence buffer for the outer strips
+
+    // Decay tuning - squared falloff (1 - i/104)^2 is at 50% about 30 LEDs behind the head
+    static constexpr float TRAIL_HALF_LIFE = 30.5f;      // LEDs behind head where the tail is at 50%
+    static constexpr float TYPICAL_TRAIL_SPEED = 0.225f; // Middle of the 0.10 to 0.35 speed range
+
     // Ring trail constants - 3 continuous trails
     static const int NUM_RING_TRAILS = 3;        // Exactly 3 trails (red, green, blue)
     static const int RING_TRAIL_LENGTH = 12;     // Length of each ring trail in LEDs
@@ -164,6 +197,12 @@ private:
      */
     void createNewSyncedTrail();
 
+    /**
+     * Create new synchronized trails, more of them the further below target we are
+     * @param currentTime Animation time (now())
+     */
+    void spawnSyncedTrails(unsigned long currentTime);
+
     /**
      * Update all active synchronized trails
      */
@@ -174,6 +213,24 @@ private:
      */
     void drawSyncedTrails();
 
+    /**
+     * Draw synchronized trails using the decay buffers
+     * Fades the buffers, stamps only the trail heads, then writes the result to the strips
+     */
+    void drawSyncedTrailsPersistent();
+
+    /**
+     * Warm-up version of the persistent trails: fade the decay buffers by the
+     * step and stamp the LEDs each head passed during it (nothing is drawn)
+     */
+    void stampWarmUpTrails();
+
+    /**
+     * Limit trail brightness on inner and outer strips to prevent oversaturation
+     * Preserves color ratios so overlapping trails blend instead of going white
+     */
+    void limitTrailBrightness();
+
     /**
      * Calculate brightness based on distance from center
      * @param offset Distance from center (0 = center, higher = further out)
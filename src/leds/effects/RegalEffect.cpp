@@ -53,7 +53,7 @@ void RegalEffect::reset() {
     Serial.println("TechnoOrangeEffect reset - all animations restarted");
 }
 
-void RegalEffect::update() {
+void RegalEffect::render() {
     // Update the animations for inner, core, and outer strips
     updateInnerAnimation();
     updateCoreAnimation();
@@ -61,9 +61,6 @@ void RegalEffect::update() {
 
     // Update ring breathing animation (opposite to outer strips)
     updateRingAnimation();
-
-    // Show all the colors on the LED strips
-    leds.showAll();
 }
 
 void RegalEffect::updateInnerAnimation() {
@@ -96,7 +93,7 @@ void RegalEffect::updateInnerAnimation() {
 
                     if (led < precisePosition - fadeLength) {
                         // LEDs below the fade zone: fully lit (bluish-purple color)
-                        leds.getInner()[ledIndex] = leds.neoColorToCRGB(INNER_COLOR);
+                        target->getInner()[ledIndex] = Colors::fromHex(INNER_COLOR);
                     } else if (led <= precisePosition) {
                         // LEDs in the fade zone: gradually fade from full brightness to off
                         float distanceFromEdge = precisePosition - led; // Distance from the leading edge
@@ -107,17 +104,10 @@ void RegalEffect::updateInnerAnimation() {
                         fadeProgress = sqrt(fadeProgress); // Square root for gentler fade curve
 
                         // Calculate faded color
-                        CRGB baseColor = leds.neoColorToCRGB(INNER_COLOR);
-                        CRGB fadedColor = CRGB(
-                            baseColor.r * fadeProgress,
-                            baseColor.g * fadeProgress,
-                            baseColor.b * fadeProgress
-                        );
-
-                        leds.getInner()[ledIndex] = fadedColor;
+                        target->getInner()[ledIndex] = Colors::scaled(Colors::fromHex(INNER_COLOR), fadeProgress);
                     } else {
                         // LEDs above the fade zone: completely off (black)
-                        leds.getInner()[ledIndex] = CRGB::Black;
+                        target->getInner()[ledIndex] = CRGB::Black;
                     }
                 }
             }
@@ -143,7 +133,7 @@ void RegalEffect::updateInnerAnimation() {
 
         case HOLDING:
             // Keep all LEDs fully lit during hold phase
-            applyColorToStrip(leds.getInner(), LED_STRIP_INNER_COUNT, INNER_COLOR);
+            applyColorToStrip(target->getInner(), LED_STRIP_INNER_COUNT, Colors::fromHex(INNER_COLOR));
 
             // Check if hold time is complete
             if (elapsedTime >= INNER_HOLD_TIME) {
@@ -160,15 +150,10 @@ void RegalEffect::updateInnerAnimation() {
             fadeProgress = max(0.0f, fadeProgress); // Don't go below 0
 
             // Apply faded color to all inner strips
-            CRGB baseColor = leds.neoColorToCRGB(INNER_COLOR);
-            CRGB fadedColor = CRGB(
-                baseColor.r * fadeProgress,
-                baseColor.g * fadeProgress,
-                baseColor.b * fadeProgress
-            );
+            CRGB fadedColor = Colors::scaled(Colors::fromHex(INNER_COLOR), fadeProgress);
 
             for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-                leds.getInner()[i] = fadedColor;
+                target->getInner()[i] = fadedColor;
             }
 
             // Trigger core to start fading at the same time
@@ -206,14 +191,14 @@ void RegalEffect::updateCoreShimmer() {
     // Update shimmer values for each LED
     for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
         // Higher chance for each LED to shimmer (50% instead of 30%)
-        if (random(100) < 50) {  // 50% chance per frame for each LED to change
+        if (rng.chance(50, 100)) {  // 50% chance per frame for each LED to change
             // Create more dramatic shimmer effect with values between 0.4 and 1.6
             // This creates a ±60% brightness variation (much more noticeable)
-            coreShimmerValues[i] = 0.4f + (random(120) / 100.0f);  // 0.4 to 1.6
+            coreShimmerValues[i] = 0.4f + (rng.range(120) / 100.0f);  // 0.4 to 1.6
 
             // Occasionally create super bright flashes (10% chance)
-            if (random(100) < 10) {
-                coreShimmerValues[i] = 1.8f + (random(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
+            if (rng.chance(10, 100)) {
+                coreShimmerValues[i] = 1.8f + (rng.range(40) / 100.0f);  // 1.8 to 2.2 for bright flashes
             }
         } else {
             // Faster return to normal brightness for more active shimmering
@@ -242,7 +227,7 @@ void RegalEffect::updateCoreAnimation() {
         case CORE_WAITING:
             // Core stays off while waiting for inner strips to reach top
             for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-                leds.getCore()[i] = CRGB::Black;
+                target->getCore()[i] = CRGB::Black;
             }
             break;
 
@@ -263,20 +248,14 @@ void RegalEffect::updateCoreAnimation() {
             float smoothProgress = fadeInProgress * fadeInProgress * (3.0f - 2.0f * fadeInProgress);
 
             // Apply the fade-in to all core LEDs simultaneously
-            CRGB baseColor = leds.neoColorToCRGB(CORE_PURPLE_COLOR);
+            const CRGB baseColor = Colors::fromHex(CORE_PURPLE_COLOR);
 
             for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
                 // Apply shimmer multiplier to create dazzling effect
                 float shimmerMultiplier = coreShimmerValues[i];
 
                 // Calculate color with fade-in progress, 45% max brightness, and shimmer
-                CRGB fadedColor = CRGB(
-                    baseColor.r * smoothProgress * 0.45f * shimmerMultiplier,
-                    baseColor.g * smoothProgress * 0.45f * shimmerMultiplier,
-                    baseColor.b * smoothProgress * 0.45f * shimmerMultiplier
-                );
-
-                leds.getCore()[i] = fadedColor;
+                target->getCore()[i] = Colors::scaled(baseColor, smoothProgress * 0.45f * shimmerMultiplier);
             }
 
             // Core filling doesn't complete on its own - it gets interrupted by fade
@@ -295,19 +274,13 @@ void RegalEffect::updateCoreAnimation() {
             fadeProgress = max(0.0f, fadeProgress); // Don't go below 0
 
             // Apply faded purple color to all core LEDs at 45% brightness with shimmer
-            CRGB baseColor = leds.neoColorToCRGB(CORE_PURPLE_COLOR);
+            const CRGB baseColor = Colors::fromHex(CORE_PURPLE_COLOR);
 
             for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
                 // Apply shimmer during fade for continued dazzle effect
                 float shimmerMultiplier = coreShimmerValues[i];
 
-                CRGB fadedColor = CRGB(
-                    baseColor.r * fadeProgress * 0.45f * shimmerMultiplier,
-                    baseColor.g * fadeProgress * 0.45f * shimmerMultiplier,
-                    baseColor.b * fadeProgress * 0.45f * shimmerMultiplier
-                );
-
-                leds.getCore()[i] = fadedColor;
+                target->getCore()[i] = Colors::scaled(baseColor, fadeProgress * 0.45f * shimmerMultiplier);
             }
             break;
         }
@@ -331,7 +304,7 @@ void RegalEffect::updateOuterAnimation() {
                              (normalizedSine * (OUTER_MAX_BRIGHTNESS - OUTER_MIN_BRIGHTNESS));
 
     // Apply gradient with breathing brightness to outer strips
-    applyGradientToStrip(leds.getOuter(), LED_STRIP_OUTER_COUNT, OUTER_COLOR, currentBrightness);
+    applyGradientToStrip(target->getOuter(), LED_STRIP_OUTER_COUNT, Colors::fromHex(OUTER_COLOR), currentBrightness);
 }
 
 void RegalEffect::updateRingAnimation() {
@@ -360,13 +333,10 @@ void RegalEffect::updateRingAnimation() {
                           (normalizedSine * (RING_MAX_BRIGHTNESS - RING_MIN_BRIGHTNESS));
 
     // Apply solid red-orange color with breathing brightness to ring
-    applyColorToStripWithBrightness(leds.getRing(), LED_STRIP_RING_COUNT, RING_COLOR, ringBrightness);
+    applyColorToStripWithBrightness(target->getRing(), LED_STRIP_RING_COUNT, Colors::fromHex(RING_COLOR), ringBrightness);
 }
 
-void RegalEffect::applyGradientToStrip(CRGB* strip, int count, uint32_t baseColor, float brightness) {
-    // Convert base color to CRGB
-    CRGB rgbColor = leds.neoColorToCRGB(baseColor);
-
+void RegalEffect::applyGradientToStrip(CRGB* strip, int count, const CRGB& baseColor, float brightness) {
     // Apply gradient for each outer strip segment
     for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
         for (int led = 0; led < OUTER_LEDS_PER_STRIP; led++) {
@@ -378,41 +348,17 @@ void RegalEffect::applyGradientToStrip(CRGB* strip, int count, uint32_t baseColo
             // Apply both gradient and breathing brightness
             float finalBrightness = gradientFactor * brightness;
 
-            // Calculate final color
-            CRGB finalColor = CRGB(
-                rgbColor.r * finalBrightness,
-                rgbColor.g * finalBrightness,
-                rgbColor.b * finalBrightness
-            );
-
-            strip[ledIndex] = finalColor;
+            strip[ledIndex] = Colors::scaled(baseColor, finalBrightness);
         }
     }
 }
 
-void RegalEffect::applyColorToStrip(CRGB* strip, int count, uint32_t color) {
-    // Convert the 32-bit color value to CRGB format
-    CRGB rgbColor = leds.neoColorToCRGB(color);
-
+void RegalEffect::applyColorToStrip(CRGB* strip, int count, const CRGB& color) {
     // Set every LED in the strip to this color
-    for (int i = 0; i < count; i++) {
-        strip[i] = rgbColor;
-    }
+    fill_solid(strip, count, color);
 }
 
-void RegalEffect::applyColorToStripWithBrightness(CRGB* strip, int count, uint32_t color, float brightness) {
-    // Convert the 32-bit color value to CRGB format
-    CRGB rgbColor = leds.neoColorToCRGB(color);
-
-    // Apply brightness to the color
-    CRGB finalColor = CRGB(
-        rgbColor.r * brightness,
-        rgbColor.g * brightness,
-        rgbColor.b * brightness
-    );
-
+void RegalEffect::applyColorToStripWithBrightness(CRGB* strip, int count, const CRGB& color, float brightness) {
     // Set every LED in the strip to this color with brightness applied
-    for (int i = 0; i < count; i++) {
-        strip[i] = finalColor;
-    }
+    fill_solid(strip, count, Colors::scaled(color, brightness));
 }
\ No newline at end of file
@@ -32,12 +32,6 @@ public:
      */
     ~RegalEffect();
 
-    /**
-     * Update the effect - applies the colors to all strips
-     * Called every frame but colors don't change
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * For this effect, there's nothing to reset since it's static
@@ -48,13 +42,19 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Techno Orange Effect"; }
+    const char* getName() const override { return "Techno Orange Effect"; }
 
 private:
+    /**
+     * Update the effect - applies the colors to all strips
+     * Called every frame but colors don't change
+     */
+    void render() override;
+
     // Color definitions for each strip
-    static const uint32_t INNER_COLOR = 0x250da3;  // More vibrant blue with slight purple tint (Royal Blue)
-    static const uint32_t OUTER_COLOR = 0xFF4500;  // Fiery orange (orange red)
-    static const uint32_t CORE_COLOR = 0x9314FF;   // Hot pink (deep pink) - not used anymore
+    static constexpr uint32_t INNER_COLOR = 0x250da3;  // More vibrant blue with slight purple tint (Royal Blue)
+    static constexpr uint32_t OUTER_COLOR = 0xFF4500;  // Fiery orange (orange red)
+    static constexpr uint32_t CORE_COLOR = 0x9314FF;   // Hot pink (deep pink) - not used anymore
 
     // Animation states for inner strips
     enum InnerAnimationState {
@@ -146,24 +146,24 @@ private:
      * @param baseColor The starting color (bottom of strip)
      * @param brightness Overall brightness multiplier (0.0 to 1.0)
      */
-    void applyGradientToStrip(CRGB* strip, int count, uint32_t baseColor, float brightness);
+    void applyGradientToStrip(CRGB* strip, int count, const CRGB& baseColor, float brightness);
 
     /**
      * Apply a solid color to an entire LED strip
      * @param strip Pointer to the LED strip array
      * @param count Number of LEDs in the strip
-     * @param color The color to apply (as 32-bit RGB value)
+     * @param color The color to apply
      */
-    void applyColorToStrip(CRGB* strip, int count, uint32_t color);
+    void applyColorToStrip(CRGB* strip, int count, const CRGB& color);
 
     /**
      * Apply a solid color to an entire LED strip with brightness control
      * @param strip Pointer to the LED strip array
      * @param count Number of LEDs in the strip
-     * @param color The color to apply (as 32-bit RGB value)
+     * @param color The color to apply
      * @param brightness Brightness multiplier (0.0 to 1.0)
      */
-    void applyColorToStripWithBrightness(CRGB* strip, int count, uint32_t color, float brightness);
+    void applyColorToStripWithBrightness(CRGB* strip, int count, const CRGB& color, float brightness);
 };
 
 #endif // TECHNO_ORANGE_EFFECT_H
\ No newline at end of file
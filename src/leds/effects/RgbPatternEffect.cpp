@@ -7,7 +7,6 @@ RgbPatternEffect::RgbPatternEffect(LEDController& ledController) :
     scrollPosition(0.0f),
     ringScrollPosition(0.0f),
     sizePhase(0.0f),
-    lastUpdateTime(0),
     outerBreathingPhase(0.0f),
     innerBreathingPhase(0.0f)  // NEW: Initialize inner breathing phase
 {
@@ -27,29 +26,26 @@ void RgbPatternEffect::reset() {
     Serial.println("RgbPatternEffect reset - all patterns restarting");
 }
 
-void RgbPatternEffect::update() {
+void RgbPatternEffect::render() {
     // Target 60 FPS for smooth animation
-    if (!shouldUpdate(16)) {  // 16ms = ~60 FPS
+    if (!beginFrame(16, REFERENCE_FRAME_MS)) {  // 16ms = ~60 FPS
         return;
     }
 
-    // Clear all strips first
-    leds.clearAll();
-
     // Update scroll position for UPWARD movement (CHANGED: was DOWNWARD)
-    scrollPosition -= SCROLL_SPEED;
+    scrollPosition -= SCROLL_SPEED * frameStep;
     if (scrollPosition < 0) {
         scrollPosition += PATTERN_LENGTH;
     }
 
     // Update ring scroll position for continuous rotation
-    ringScrollPosition += RING_SCROLL_SPEED;
+    ringScrollPosition += RING_SCROLL_SPEED * frameStep;
     if (ringScrollPosition >= PATTERN_LENGTH) {
         ringScrollPosition -= PATTERN_LENGTH;
     }
 
     // Update size phase for smooth size transitions
-    sizePhase += SIZE_SPEED;
+    sizePhase += SIZE_SPEED * frameStep;
     if (sizePhase > 2.0f * PI) {
         sizePhase -= 2.0f * PI;
     }
@@ -58,31 +54,47 @@ void RgbPatternEffect::update() {
     outerBreathingPhase = sizePhase;  // Keep in sync with dot size
 
     // Update inner breathing phase
-    innerBreathingPhase += INNER_BREATHING_SPEED;
+    innerBreathingPhase += INNER_BREATHING_SPEED * frameStep;
     if (innerBreathingPhase > 6.0f * PI) {  // 3 complete cycles for R-G-B
         innerBreathingPhase -= 6.0f * PI;
     }
 
-    // Draw effects on each strip type
+    // Draw effects on each strip type - every strip covers all of its LEDs,
+    // so there is nothing to clear first and the strips can go to both cores
+    renderStrips();
+}
 
-    // Core: UPWARD moving RGB dots (CHANGED: was DOWNWARD)
-    for (int segment = 0; segment < 3; segment++) {
-        drawCoreSegment(segment);
-    }
+void RgbPatternEffect::renderStrip(StripJob strip) {
+    switch (strip) {
+        case STRIP_JOB_CORE:
+            // Core: UPWARD moving RGB dots (CHANGED: was DOWNWARD)
+            for (int segment = 0; segment < 3; segment++) {
+                drawCoreSegment(segment);
+            }
+            break;
 
-    // Inner: NEW breathing RGB cycle
-    updateInnerBreathing();
+        case STRIP_JOB_INNER:
+            // Inner: NEW breathing RGB cycle
+            updateInnerBreathing();
+            break;
 
-    // Ring: rotating RGB pattern
-    if (!skipRing) {
-        drawRing();
-    }
+        case STRIP_JOB_OUTER:
+            // Outer: breathing RGB waves
+            updateOuterWaves();
+            break;
 
-    // Outer: breathing RGB waves
-    updateOuterWaves();
+        case STRIP_JOB_RING:
+            // Ring: rotating RGB pattern (kept dark while button feedback is showing)
+            if (!skipRing) {
+                drawRing();
+            } else {
+                fill_solid(target->getRing(), LED_STRIP_RING_COUNT, CRGB::Black);
+            }
+            break;
 
-    // Show all changes
-    leds.showAll();
+        default:
+            break;
+    }
 }
 
 int RgbPatternEffect::getCurrentDotSize() {
@@ -133,11 +145,13 @@ void RgbPatternEffect::drawCoreSegment(int segment) {
     // Get current dot size
     int currentDotSize = getCurrentDotSize();
 
-    // Draw pattern on this segment
-    CRGB* segmentStart = leds.getCore() + (segment * CORE_LEDS_PER_SEGMENT);
+    // Draw pattern on this segment - the last one runs to the end of the strip
+    int segmentFirst = segment * CORE_LEDS_PER_SEGMENT;
+    int segmentLength = (segment == 2) ? LED_STRIP_CORE_COUNT - segmentFirst : CORE_LEDS_PER_SEGMENT;
+    CRGB* segmentStart = target->getCore() + segmentFirst;
 
     // For proper alignment, all segments need to show the same pattern at the same height
-    for (int i = 0; i < CORE_LEDS_PER_SEGMENT; i++) {
+    for (int i = 0; i < segmentLength; i++) {
         // Calculate pattern position with segment-specific adjustments
         float patternPos;
 
@@ -148,13 +162,13 @@ void RgbPatternEffect::drawCoreSegment(int segment) {
                 break;
 
             case 1:
-                // Middle segment - flipped and needs -5 offset (for upward movement)
-                patternPos = (CORE_LEDS_PER_SEGMENT - 1 - i) + scrollPosition - 5;
+                // Middle segment - flipped and needs +1 offset (for upward movement)
+                patternPos = (CORE_LEDS_PER_SEGMENT - 1 - i) + scrollPosition + 1;
                 break;
 
             case 2:
-                // Third segment - needs +4 offset to catch up (for upward movement)
-                patternPos = i + scrollPosition + 4;
+                // Third segment - needs -2 offset to line up (for upward movement)
+                patternPos = i + scrollPosition - 2;
                 break;
         }
 
@@ -198,7 +212,7 @@ void RgbPatternEffect::updateInnerBreathing() {
 
     // Apply the same color to all inner strip LEDs
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        leds.getInner()[i] = currentColor;
+        target->getInner()[i] = currentColor;
     }
 }
 
@@ -222,7 +236,7 @@ void RgbPatternEffect::drawRing() {
         CRGB color = getColorAtPosition(patternPosition, currentDotSize);
 
         // Set the LED color
-        leds.getRing()[i] = color;
+        target->getRing()[i] = color;
     }
 }
 
@@ -240,7 +254,7 @@ void RgbPatternEffect::updateOuterWaves() {
 
     // Set each segment to a different color, rotating over time
     for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        CRGB* segmentStart = leds.getOuter() + (segment * OUTER_LEDS_PER_STRIP);
+        CRGB* segmentStart = target->getOuter() + (segment * OUTER_LEDS_PER_STRIP);
 
         // Calculate which color this segment gets (with rotation)
         int colorIndex = (segment + colorOffset) % 3;
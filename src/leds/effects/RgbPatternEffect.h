@@ -24,11 +24,6 @@ public:
      */
     RgbPatternEffect(LEDController& ledController);
 
-    /**
-     * Update the animation
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      */
@@ -37,9 +32,23 @@ public:
     /**
      * Get the name of this effect
      */
-    String getName() const override { return "RGB Pattern Effect"; }
+    const char* getName() const override { return "RGB Pattern Effect"; }
+
+    // Every strip reads the same phases but draws on its own
+    bool hasStripJobs() const override { return true; }
 
 private:
+    /**
+     * Update the animation
+     */
+    void render() override;
+
+    /**
+     * Draw one strip of the frame set up by render()
+     * @param strip Which strip to draw
+     */
+    void renderStrip(StripJob strip) override;
+
     // Pattern constants
     static const int BASE_DOT_SIZE = 2;      // Minimum dot size
     static const int MAX_DOT_SIZE = 8;       // Maximum dot size
@@ -49,8 +58,8 @@ private:
     static const int PATTERN_SPACING = MAX_DOT_SIZE + GAP_SIZE;  // Space for one color + gap (14)
     static const int PATTERN_LENGTH = PATTERN_SPACING * 3;       // Total pattern length (42)
 
-    // Core strip properties
-    static const int CORE_LEDS_PER_SEGMENT = 50;
+    // Core strip properties - the core is 3 segments (the last one takes any leftover LED)
+    static const int CORE_LEDS_PER_SEGMENT = LED_STRIP_CORE_COUNT / 3;
 
     // Note: The following are defined in Config.h:
     // INNER_LEDS_PER_STRIP = 75
@@ -59,7 +68,8 @@ private:
     // NUM_OUTER_STRIPS = 3
     // LED_STRIP_RING_COUNT (for ring)
 
-    // Animation speeds (REDUCED for slower animation)
+    // Animation speeds (REDUCED for slower animation) - per 16ms frame, scaled by frameStep
+    static constexpr float REFERENCE_FRAME_MS = 16.0f;
     static constexpr float SCROLL_SPEED = 0.3f;       // Core upward scroll speed (was 0.8f)
     static constexpr float RING_SCROLL_SPEED = 0.3f;  // Ring rotation speed (reduced by 25% from 0.4f)
     static constexpr float SIZE_SPEED = 0.008f;       // Dot size change speed (was 0.015f)
@@ -73,7 +83,6 @@ private:
     float scrollPosition;          // Current scroll position for core/inner
     float ringScrollPosition;      // Current scroll position for ring
     float sizePhase;              // Phase for dot size animation
-    unsigned long lastUpdateTime;  // Last update timestamp
     float outerBreathingPhase;    // Phase for outer strip breathing
 
     // NEW: Inner strip breathing state
@@ -4,10 +4,10 @@
 
 // Constructor for single color (all strips same color)
 SolidColorEffect::SolidColorEffect(LEDController &ledController, uint32_t color) : Effect(ledController),
-    coreColor(color),
-    innerColor(color),
-    outerColor(color),
-    ringColor(color) {
+    coreColor(toStripColor(color)),
+    innerColor(toStripColor(color)),
+    outerColor(toStripColor(color)),
+    ringColor(toStripColor(color)) {
     // No initialization needed beyond initializer list
 }
 
@@ -17,68 +17,66 @@ SolidColorEffect::SolidColorEffect(LEDController &ledController,
                                    uint32_t innerColor,
                                    uint32_t outerColor,
                                    uint32_t ringColor) : Effect(ledController),
-                                                         coreColor(coreColor),
-                                                         innerColor(innerColor),
-                                                         outerColor(outerColor),
-                                                         ringColor(ringColor) {
+                                                         coreColor(toStripColor(coreColor)),
+                                                         innerColor(toStripColor(innerColor)),
+                                                         outerColor(toStripColor(outerColor)),
+                                                         ringColor(toStripColor(ringColor)) {
     // No initialization needed beyond initializer list
 }
 
 void SolidColorEffect::reset() {
-    // Nothing to reset in this effect
+    // Nothing to reset in this effect - just draw the frame again
+    invalidate();
 }
 
-void SolidColorEffect::update() {
-    // Apply colors to each strip (or turn off if COLOR_NONE)
-    applyColor(leds.getCore(), LED_STRIP_CORE_COUNT, coreColor);
-    applyColor(leds.getInner(), LED_STRIP_INNER_COUNT, innerColor);
-    applyColor(leds.getOuter(), LED_STRIP_OUTER_COUNT, outerColor);
+void SolidColorEffect::render() {
+    // Apply colors to each strip (strips set to COLOR_NONE hold black)
+    fill_solid(target->getCore(), LED_STRIP_CORE_COUNT, coreColor);
+    fill_solid(target->getInner(), LED_STRIP_INNER_COUNT, innerColor);
+    fill_solid(target->getOuter(), LED_STRIP_OUTER_COUNT, outerColor);
     if (!skipRing)
-        applyColor(leds.getRing(), LED_STRIP_RING_COUNT, ringColor);
-
-    // Show all changes
-    leds.showAll();
+        fill_solid(target->getRing(), LED_STRIP_RING_COUNT, ringColor);
 }
 
 void SolidColorEffect::setCoreColor(uint32_t color) {
-    coreColor = color;
+    coreColor = toStripColor(color);
+    invalidate();
 }
 
 void SolidColorEffect::setInnerColor(uint32_t color) {
-    innerColor = color;
+    innerColor = toStripColor(color);
+    invalidate();
 }
 
 void SolidColorEffect::setOuterColor(uint32_t color) {
-    outerColor = color;
+    outerColor = toStripColor(color);
+    invalidate();
 }
 
 void SolidColorEffect::setRingColor(uint32_t color) {
-    ringColor = color;
+    ringColor = toStripColor(color);
+    invalidate();
 }
 
 void SolidColorEffect::setAllColors(uint32_t color) {
-    coreColor = color;
-    innerColor = color;
-    outerColor = color;
-    ringColor = color;
+    CRGB stripColor = toStripColor(color);
+    coreColor = stripColor;
+    innerColor = stripColor;
+    outerColor = stripColor;
+    ringColor = stripColor;
+    invalidate();
 }
 
-String SolidColorEffect::getName() const {
+const char* SolidColorEffect::getName() const {
     return "Solid Color Effect";
 }
 
-bool SolidColorEffect::isValidColor(uint32_t color) const {
+bool SolidColorEffect::isValidColor(uint32_t color) {
     // Check if color is valid (not COLOR_NONE)
     return color != COLOR_NONE;
 }
 
-void SolidColorEffect::applyColor(CRGB *strip, int count, uint32_t color) {
-    if (isValidColor(color)) {
-        // Convert color and apply to strip
-        CRGB rgbColor = leds.neoColorToCRGB(color);
-        fill_solid(strip, count, rgbColor);
-    } else {
-        // Turn off this strip
-        fill_solid(strip, count, CRGB::Black);
-    }
+CRGB SolidColorEffect::toStripColor(uint32_t color) {
+    // Unpack the color once here instead of every frame, turning COLOR_NONE into "off"
+    return isValidColor(color) ? Colors::fromHex(color) : CRGB(CRGB::Black);
 }
@@ -18,9 +18,11 @@ public:
                      uint32_t outerColor,
                      uint32_t ringColor);
 
-    void update() override;
     void reset() override;
 
+    // Solid colors only change when a setter is called
+    bool isStatic() const override { return true; }
+
     // Setters for individual strip colors
     void setCoreColor(uint32_t color);
     void setInnerColor(uint32_t color);
@@ -30,27 +32,30 @@ public:
     // Setter for all strips at once
     void setAllColors(uint32_t color);
 
-    String getName() const override;
+    const char* getName() const override;
 
     // Special color value to indicate a strip should be turned off
-    static const uint32_t COLOR_NONE = 0xFF000000;
+    static constexpr uint32_t COLOR_NONE = 0xFF000000;
     // Predefined white color temperatures
-    static const uint32_t COLD_WHITE = 0xF0F8FF;     // RGB(240, 248, 255) - Slight blue tint
-    static const uint32_t NATURAL_WHITE = 0xFFDD99;  // RGB(255, 255, 255) - Pure white
-    static const uint32_t WARM_WHITE = 0xFFAA33;     // RGB(255, 232, 192) - Slight yellow/orange tint
-    static const uint32_t Cyan = 0x0FE0D9;     // RGB(255, 232, 192) - Slight yellow/orange tint
+    static constexpr uint32_t COLD_WHITE = 0xF0F8FF;     // RGB(240, 248, 255) - Slight blue tint
+    static constexpr uint32_t NATURAL_WHITE = 0xFFDD99;  // RGB(255, 255, 255) - Pure white
+    static constexpr uint32_t WARM_WHITE = 0xFFAA33;     // RGB(255, 232, 192) - Slight yellow/orange tint
+    static constexpr uint32_t Cyan = 0x0FE0D9;     // RGB(255, 232, 192) - Slight yellow/orange tint
 
 private:
+    void render() override;
+
 
-    // Colors for each strip
-    uint32_t coreColor;
-    uint32_t innerColor;
-    uint32_t outerColor;
-    uint32_t ringColor;
+    // Colors for each strip, unpacked once when they are set
+    // (a strip set to COLOR_NONE is stored as black)
+    CRGB coreColor;
+    CRGB innerColor;
+    CRGB outerColor;
+    CRGB ringColor;
 
     // Helper methods
-    bool isValidColor(uint32_t color) const;
-    void applyColor(CRGB* strip, int count, uint32_t color);
+    static bool isValidColor(uint32_t color);
+    static CRGB toStripColor(uint32_t color);
 };
 
 #endif // SOLID_COLOR_EFFECT_H
\ No newline at end of file
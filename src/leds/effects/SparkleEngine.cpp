@@ -0,0 +1,188 @@
+// src/leds/effects/SparkleEngine.cpp
+
+#include "SparkleEngine.h"
+
+SparkleEngine::SparkleEngine(int maxSparkles) :
+    sparkles(nullptr),
+    maxSparkles(maxSparkles),
+    activeCount(0),
+    numLayers(0),
+    scheduled(false),
+    lastUpdateTime(0)
+{
+    sparkles = new Sparkle[maxSparkles];
+}
+
+SparkleEngine::~SparkleEngine() {
+    delete[] sparkles;
+}
+
+int SparkleEngine::addLayer(int numLeds, float sparklesPerLedPerSecond, float minSpeed, float maxSpeed,
+                            const CRGB& color, const CRGB& altColor, uint8_t altColorChance) {
+    if (numLayers >= MAX_LAYERS) {
+        Serial.println("ERROR: SparkleEngine has no room for another layer");
+        return -1;
+    }
+
+    Layer& layer = layers[numLayers];
+    layer.numLeds = numLeds;
+    layer.birthsPerMs = numLeds * sparklesPerLedPerSecond / 1000.0f;
+    layer.minSpeed = minSpeed;
+    layer.maxSpeed = maxSpeed;
+    layer.color = color;
+    layer.altColor = altColor;
+    layer.altColorChance = altColorChance;
+
+    // A new layer needs its own entry in the queue
+    scheduled = false;
+
+    return numLayers++;
+}
+
+void SparkleEngine::clear() {
+    activeCount = 0;
+    scheduled = false;
+}
+
+void SparkleEngine::schedule(unsigned long currentTime, FastRandom& rng) {
+    for (int i = 0; i < numLayers; i++) {
+        queue[i].time = currentTime + nextGap(layers[i], rng);
+        queue[i].layer = i;
+    }
+
+    // Build the heap from the bottom up
+    for (int i = numLayers / 2 - 1; i >= 0; i--) {
+        siftDown(i);
+    }
+
+    scheduled = true;
+    lastUpdateTime = currentTime;
+}
+
+unsigned long SparkleEngine::nextGap(const Layer& layer, FastRandom& rng) const {
+    if (layer.birthsPerMs <= 0.0f) {
+        return NEVER_MS;
+    }
+
+    // Time between events of a Poisson process is exponentially distributed:
+    // gap = -ln(1 - u) / rate, with u uniform in [0, 1)
+    float gap = -logf(1.0f - rng.unit()) / layer.birthsPerMs;
+    if (gap >= (float)NEVER_MS) {
+        return NEVER_MS;  // A very low rate - don't overflow the conversion
+    }
+
+    // Round to whole milliseconds, but always move forward
+    return max(1UL, (unsigned long)(gap + 0.5f));
+}
+
+void SparkleEngine::update(unsigned long currentTime, FastRandom& rng) {
+    if (numLayers == 0) {
+        return;
+    }
+
+    // First update, or the effect was paused for a while - start fresh
+    if (!scheduled || currentTime - lastUpdateTime > MAX_CATCH_UP_MS) {
+        schedule(currentTime, rng);
+        return;
+    }
+
+    float elapsed = currentTime - lastUpdateTime;
+    lastUpdateTime = currentTime;
+
+    // Advance every lit sparkle and drop the ones that have finished
+    for (int i = 0; i < activeCount; ) {
+        sparkles[i].phase += sparkles[i].speed * elapsed;
+
+        if (sparkles[i].phase > PI) {
+            // Fill the gap with the last sparkle so the pool stays packed
+            sparkles[i] = sparkles[--activeCount];
+        } else {
+            i++;
+        }
+    }
+
+    // Start every sparkle that is due - the earliest one is always on top of the queue
+    while ((long)(currentTime - queue[0].time) >= 0) {
+        int layer = queue[0].layer;
+        if (layers[layer].birthsPerMs > 0.0f) {  // A "never" layer only comes due after weeks of running
+            spawn(layer, currentTime - queue[0].time, rng);
+        }
+
+        queue[0].time += nextGap(layers[layer], rng);
+        siftDown(0);
+    }
+}
+
+void SparkleEngine::spawn(int layerIndex, unsigned long age, FastRandom& rng) {
+    const Layer& layer = layers[layerIndex];
+    uint16_t led = rng.range(layer.numLeds);
+
+    // An LED that is already sparkling cannot start another sparkle
+    for (int i = 0; i < activeCount; i++) {
+        if (sparkles[i].led == led && sparkles[i].layer == layerIndex) {
+            return;
+        }
+    }
+
+    if (activeCount >= maxSparkles) {
+        return;  // Pool is full, skip this one
+    }
+
+    Sparkle& sparkle = sparkles[activeCount++];
+    sparkle.led = led;
+    sparkle.layer = layerIndex;
+    sparkle.speed = layer.minSpeed + rng.unit() * (layer.maxSpeed - layer.minSpeed);
+    sparkle.peak = 51 + rng.range(204);  // 20% to 100% brightness
+    sparkle.useAltColor = rng.chance(layer.altColorChance, 100);
+
+    // Catch up on the time since it was due, so start times stay exact
+    sparkle.phase = sparkle.speed * age;
+}
+
+void SparkleEngine::render(int layer, CRGB* target) const {
+    if (layer < 0 || layer >= numLayers) {
+        return;
+    }
+
+    const Layer& settings = layers[layer];
+
+    for (int i = 0; i < activeCount; i++) {
+        const Sparkle& sparkle = sparkles[i];
+        if (sparkle.layer != layer) {
+            continue;
+        }
+
+        // sin^2 gives a soft fade in and out
+        float baseSine = sin(sparkle.phase);
+        uint8_t brightness = (uint8_t)(sparkle.peak * baseSine * baseSine);
+
+        CRGB sparkleColor = sparkle.useAltColor ? settings.altColor : settings.color;
+        sparkleColor.nscale8(brightness);
+
+        // Blend with existing color (additive)
+        target[sparkle.led] += sparkleColor;
+    }
+}
+
+void SparkleEngine::siftDown(int index) {
+    while (true) {
+        int smallest = index;
+        int left = index * 2 + 1;
+        int right = left + 1;
+
+        if (left < numLayers && (long)(queue[left].time - queue[smallest].time) < 0) {
+            smallest = left;
+        }
+        if (right < numLayers && (long)(queue[right].time - queue[smallest].time) < 0) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            return;
+        }
+
+        Birth temp = queue[index];
+        queue[index] = queue[smallest];
+        queue[smallest] = temp;
+        index = smallest;
+    }
+}
@@ -0,0 +1,156 @@
+// src/leds/effects/SparkleEngine.h
+
+#ifndef SPARKLE_ENGINE_H
+#define SPARKLE_ENGINE_H
+
+#include <Arduino.h>
+#include <limits.h>
+#include <FastLED.h>
+#include "FastRandom.h"
+
+/**
+ * SparkleEngine - Event-scheduled twinkles that only cost work while they are lit
+ *
+ * The old way to twinkle was to roll a small chance on every LED every frame
+ * and keep brightness/color/speed arrays for every LED, even though only a
+ * handful are ever sparkling. This engine turns that around:
+ *
+ * - Sparkles on a layer start as a Poisson process. Instead of rolling dice
+ *   for every LED, the engine draws the time until the next sparkle anywhere
+ *   on the layer (an exponential random gap) and waits for it.
+ * - The next start time of every layer sits in a small priority queue, so
+ *   each update only looks at the layer whose sparkle is due first.
+ * - Only lit sparkles are stored, in one fixed pool. A sparkle fades in and
+ *   out along a sin^2 curve and frees its slot when it finishes.
+ *
+ * A sparkle that lands on an LED which is already sparkling is dropped, which
+ * gives exactly the same start rate per idle LED as the per-LED dice rolls.
+ *
+ * Update and render cost scales with the number of lit sparkles, not the
+ * number of LEDs.
+ */
+class SparkleEngine {
+public:
+    /**
+     * Constructor
+     * @param maxSparkles Largest number of sparkles lit at once (across all layers)
+     */
+    SparkleEngine(int maxSparkles);
+
+    /**
+     * Destructor - free the sparkle pool
+     */
+    ~SparkleEngine();
+
+    /**
+     * Add a group of LEDs that sparkles on its own (for example one strip type)
+     * @param numLeds Number of LEDs in the layer
+     * @param sparklesPerLedPerSecond How often an idle LED starts a sparkle
+     * @param minSpeed Slowest fade speed in radians per millisecond (full sparkle = PI radians)
+     * @param maxSpeed Fastest fade speed in radians per millisecond
+     * @param color Main sparkle color at full brightness
+     * @param altColor Second sparkle color at full brightness
+     * @param altColorChance Chance in percent (0-100) that a sparkle uses altColor
+     * @return Layer index to pass to render(), or -1 if no more layers fit
+     */
+    int addLayer(int numLeds, float sparklesPerLedPerSecond, float minSpeed, float maxSpeed,
+                 const CRGB& color, const CRGB& altColor, uint8_t altColorChance);
+
+    /**
+     * Remove all lit sparkles and restart the schedule on the next update
+     */
+    void clear();
+
+    /**
+     * Advance all sparkles to the current time and start any that are due
+     * @param currentTime Current time in milliseconds
+     * @param rng Random number generator of the effect that owns the sparkles
+     */
+    void update(unsigned long currentTime, FastRandom& rng);
+
+    /**
+     * Add the lit sparkles of one layer on top of an LED array
+     * @param layer Layer index returned by addLayer()
+     * @param target LED array of that layer (must hold the layer's numLeds LEDs)
+     */
+    void render(int layer, CRGB* target) const;
+
+    /**
+     * Get the number of sparkles currently lit
+     */
+    int getActiveCount() const { return activeCount; }
+
+private:
+    // One lit sparkle
+    struct Sparkle {
+        float phase;       // Progress through the fade (0 to PI radians)
+        float speed;       // Radians per millisecond
+        uint16_t led;      // LED index within its layer
+        uint8_t layer;     // Layer this sparkle belongs to
+        uint8_t peak;      // Brightness at the top of the fade (0-255)
+        bool useAltColor;  // True = altColor, false = color
+    };
+
+    // Settings for one group of LEDs
+    struct Layer {
+        int numLeds;
+        float birthsPerMs;   // Starts per millisecond over the whole layer
+        float minSpeed;      // Radians per millisecond
+        float maxSpeed;      // Radians per millisecond
+        CRGB color;
+        CRGB altColor;
+        uint8_t altColorChance;
+    };
+
+    // Queue entry: when the next sparkle on a layer is due
+    struct Birth {
+        unsigned long time;
+        uint8_t layer;
+    };
+
+    static const int MAX_LAYERS = 4;
+
+    // After a longer pause than this, restart the schedule instead of
+    // replaying every missed sparkle at once
+    static const unsigned long MAX_CATCH_UP_MS = 250;
+
+    // Gap for a layer that never sparkles (rate 0) - as far ahead as the
+    // wrap-safe time comparisons can see
+    static const unsigned long NEVER_MS = ULONG_MAX / 2;
+
+    Sparkle* sparkles;    // Pool of lit sparkles (first activeCount are in use)
+    int maxSparkles;
+    int activeCount;
+
+    Layer layers[MAX_LAYERS];
+    int numLayers;
+
+    Birth queue[MAX_LAYERS];  // Min-heap ordered by time, one entry per layer
+    bool scheduled;           // False until the queue has been filled
+    unsigned long lastUpdateTime;
+
+    /**
+     * Fill the queue with a first start time for every layer
+     */
+    void schedule(unsigned long currentTime, FastRandom& rng);
+
+    /**
+     * Random gap until the next sparkle on a layer (exponential distribution)
+     * A layer with no sparkles per second gets NEVER_MS
+     */
+    unsigned long nextGap(const Layer& layer, FastRandom& rng) const;
+
+    /**
+     * Start a sparkle on a random LED of a layer, unless that LED is already lit
+     * @param layerIndex Layer to sparkle on
+     * @param age Milliseconds since the sparkle was due
+     */
+    void spawn(int layerIndex, unsigned long age, FastRandom& rng);
+
+    /**
+     * Move the queue's first entry down until the heap is in order again
+     */
+    void siftDown(int index);
+};
+
+#endif // SPARKLE_ENGINE_H
@@ -5,7 +5,9 @@
 #include "../../Config.h"
 
 SuspendedFireEffect::SuspendedFireEffect(LEDController& ledController)
-    : Effect(ledController), intensity(80) {  // Default intensity set to 80%
+    : Effect(ledController),
+      intensity(100),                     // Full intensity keeps the original fire colors
+      heatPalette(FirePalette::get(100)) {
 
     // Allocate memory for heat simulation arrays
     // These track the "heat" at each LED position for realistic fire simulation
@@ -18,6 +20,10 @@ SuspendedFireEffect::SuspendedFireEffect(LEDController& ledController)
     memset(heatInner, 0, LED_STRIP_INNER_COUNT);
     memset(heatOuter, 0, LED_STRIP_OUTER_COUNT);
 
+    // Cooling ranges only depend on strip geometry, so build them once
+    buildCoolingTable(innerCoolRange, INNER_LEDS_PER_STRIP);
+    buildCoolingTable(outerCoolRange, OUTER_LEDS_PER_STRIP);
+
     // Initialize flame height arrays
     for (int i = 0; i < NUM_INNER_STRIPS; i++) {
         innerFlameHeights[i] = 0.8f;   // Start at 80% height (inner strips higher)
@@ -31,8 +37,9 @@ SuspendedFireEffect::SuspendedFireEffect(LEDController& ledController)
     lastUpdateTime = millis();
     lastHeightUpdate = millis();
 
-    // Call reset to set up initial suspended fire state
-    reset();
+    // Starting heat only - update() warms the fire up on the first frame,
+    // after SmartLantern has seeded and set up the new effect
+    initHeat();
 }
 
 SuspendedFireEffect::~SuspendedFireEffect() {
@@ -43,6 +50,13 @@ SuspendedFireEffect::~SuspendedFireEffect() {
 }
 
 void SuspendedFireEffect::reset() {
+    initHeat();
+
+    // Skip the first moments, so the fire is already burning when it appears
+    warmUp(warmUpMs());
+}
+
+void SuspendedFireEffect::initHeat() {
     Serial.println("SuspendedFireEffect: Initializing suspended fire effect");
 
     // Initialize heat values for suspended fire (flames hang from top)
@@ -63,11 +77,11 @@ void SuspendedFireEffect::reset() {
             // Heat decreases as we go down from the top
             if (percentFromTop < 0.2) {
                 // Very hot base at the top
-                heatInner[index] = random(220, 255);
+                heatInner[index] = rng.range(220, 255);
             }
             else if (percentFromTop < 0.4) {
                 // Hot zone below the base
-                heatInner[index] = random(180, 220);
+                heatInner[index] = rng.range(180, 220);
             }
             else if (percentFromTop < 0.7) {
                 // Medium flame zone
@@ -91,11 +105,11 @@ void SuspendedFireEffect::reset() {
             // Heat decreases as we go down from the top
             if (percentFromTop < 0.2) {
                 // Very hot base at the top with white-hot elements
-                heatOuter[index] = random(240, 255);
+                heatOuter[index] = rng.range(240, 255);
             }
             else if (percentFromTop < 0.4) {
                 // Hot zone below the base
-                heatOuter[index] = random(210, 240);
+                heatOuter[index] = rng.range(210, 240);
             }
             else if (percentFromTop < 0.7) {
                 // Medium flame zone
@@ -111,186 +125,66 @@ void SuspendedFireEffect::reset() {
     lastUpdateTime = millis();
 }
 
-void SuspendedFireEffect::update() {
+void SuspendedFireEffect::render() {
     // Target 50 FPS for smooth suspended fire animation
-    if (!shouldUpdate(20)) {
+    if (!beginFrame(20, FIRE_STEP_MS)) {
         return;
     }
 
-    // Update dynamic flame heights every 100ms for natural variation
-    updateFlameHeights();
+    // One simulation tick per 20ms that passed, so the flames move at the same speed at any frame rate
+    for (int ticks = frameTicks(FIRE_STEP_MS); ticks > 0; ticks--) {
+        // Update dynamic flame heights every 100ms for natural variation
+        updateFlameHeights();
 
-    // Update the suspended fire simulation
-    updateSuspendedFireBase();
+        // Update the suspended fire simulation
+        updateSuspendedFireBase();
+    }
 
     // Render the suspended fire
     renderSuspendedFire();
-
-    // Show the changes
-    leds.showAll();
 }
 
-void SuspendedFireEffect::updateSuspendedFireBase() {
-    // Fire simulation parameters (same as FireEffect)
-    int cooling = 12;   // Heat loss rate
-    int sparking = 110; // Spark generation chance
-
-    // ====== INNER STRIPS ======
-    // Process each inner strip segment separately
-    for (int segment = 0; segment < NUM_INNER_STRIPS; segment++) {
-        int segmentStart = segment * INNER_LEDS_PER_STRIP;
-
-        // Create temporary array for this segment
-        byte tempHeat[INNER_LEDS_PER_STRIP];
-        memset(tempHeat, 0, INNER_LEDS_PER_STRIP);
-
-        // Copy current data
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            tempHeat[i] = heatInner[segmentStart + i];
-        }
-
-        // Cool down every cell (same cooling logic as FireEffect)
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            int coolAmount;
-            if (i > INNER_LEDS_PER_STRIP * 0.6) {  // Top 40% (hot base area)
-                coolAmount = random(0, cooling / 6);
-            } else if (i > INNER_LEDS_PER_STRIP * 0.2) {  // Middle area
-                coolAmount = random(0, cooling / 4);
-            } else {  // Bottom area (cool flames)
-                coolAmount = random(0, cooling / 3);
-            }
-
-            if (tempHeat[i] > coolAmount) {
-                tempHeat[i] = tempHeat[i] - coolAmount;
-            } else {
-                tempHeat[i] = 0;
-            }
-        }
-
-        // Heat flows DOWNWARD from top (inverted from FireEffect)
-        // High index to low index (top to bottom)
-        for (int i = 0; i <= INNER_LEDS_PER_STRIP - 3; i++) {
-            tempHeat[i] = (tempHeat[i] * 1 + tempHeat[i+1] * 4 + tempHeat[i+2] * 3) / 8;
-        }
-
-        // Randomly ignite new sparks at the TOP (inverted from FireEffect)
-        if (random8() < sparking) {
-            int y = INNER_LEDS_PER_STRIP - 1 - random8(7);  // Top 7 LEDs can spark
-            tempHeat[y] = tempHeat[y] + random8(80, 160);
-
-            // More frequent white-hot sparks at the top
-            if (random8() < 40) {
-                tempHeat[y] = min(255, tempHeat[y] + random8(40, 80));
-            }
-        }
-
-        // Copy back to main array
-        for (int i = 0; i < INNER_LEDS_PER_STRIP; i++) {
-            heatInner[segmentStart + i] = tempHeat[i];
-        }
-
-        // Apply dynamic flame height cutoff for this segment
-        applyFlameHeightCutoff(segment, true); // true = inner strip
+void SuspendedFireEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, FIRE_STEP_MS);
+    for (int ticks = frameTicks(FIRE_STEP_MS); ticks > 0; ticks--) {
+        updateFlameHeights();
+        updateSuspendedFireBase();
     }
+}
 
-    // ====== OUTER STRIPS ======
-    // Process each outer strip segment separately (same logic as inner)
-    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        int segmentStart = segment * OUTER_LEDS_PER_STRIP;
-
-        // Create temporary array for this segment
-        byte tempHeat[OUTER_LEDS_PER_STRIP];
-        memset(tempHeat, 0, OUTER_LEDS_PER_STRIP);
-
-        // Copy current data
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            tempHeat[i] = heatOuter[segmentStart + i];
-        }
-
-        // Cool down every cell (same cooling logic)
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            int coolAmount;
-            if (i > OUTER_LEDS_PER_STRIP * 0.6) {  // Top 40% (hot base area)
-                coolAmount = random(0, cooling / 6);
-            } else if (i > OUTER_LEDS_PER_STRIP * 0.2) {  // Middle area
-                coolAmount = random(0, cooling / 4);
-            } else {  // Bottom area (cool flames)
-                coolAmount = random(0, cooling / 3);
-            }
-
-            if (tempHeat[i] > coolAmount) {
-                tempHeat[i] = tempHeat[i] - coolAmount;
-            } else {
-                tempHeat[i] = 0;
-            }
-        }
-
-        // Heat flows DOWNWARD from top (inverted from FireEffect)
-        for (int i = 0; i <= OUTER_LEDS_PER_STRIP - 3; i++) {
-            tempHeat[i] = (tempHeat[i] * 1 + tempHeat[i+1] * 4 + tempHeat[i+2] * 3) / 8;
-        }
-
-        // Randomly ignite new sparks at the TOP (inverted from FireEffect)
-        if (random8() < sparking) {
-            int y = OUTER_LEDS_PER_STRIP - 1 - random8(7);  // Top 7 LEDs can spark
-            tempHeat[y] = tempHeat[y] + random8(80, 160);
-
-            // More frequent white-hot sparks at the top
-            if (random8() < 40) {
-                tempHeat[y] = min(255, tempHeat[y] + random8(40, 80));
-            }
-        }
-
-        // Copy back to main array
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            heatOuter[segmentStart + i] = tempHeat[i];
+void SuspendedFireEffect::buildCoolingTable(uint8_t* table, int segmentLength) {
+    // Same cooling levels as FireEffect, mirrored so the hot base is at the top
+    for (int i = 0; i < segmentLength; i++) {
+        if (i > segmentLength * 0.6) {          // Top 40% (hot base area)
+            table[i] = FIRE_COOLING / 6;
+        } else if (i > segmentLength * 0.2) {   // Middle area
+            table[i] = FIRE_COOLING / 4;
+        } else {                                // Bottom area (cool flames)
+            table[i] = FIRE_COOLING / 3;
         }
-
-        // Apply dynamic flame height cutoff for this segment
-        applyFlameHeightCutoff(segment, false); // false = outer strip
     }
 }
 
-uint32_t SuspendedFireEffect::heatToColor(unsigned char heat) {
-    // Convert heat value to fire colors (same as FireEffect)
-    // white-yellow-orange-red color gradient based on heat intensity
-    CRGB color;
-
-    if (heat <= 0) {
-        // No heat = black
-        color = CRGB(0, 0, 0);
-    }
-    else if (heat < 70) {
-        // Low heat = dark red
-        uint8_t red = map(heat, 0, 70, 0, 160);
-        color = CRGB(red, 0, 0);
-    }
-    else if (heat < 140) {
-        // Medium heat = red
-        uint8_t red = map(heat, 70, 140, 160, 255);
-        uint8_t green = map(heat, 70, 140, 0, 40);
-        color = CRGB(red, green, 0);
-    }
-    else if (heat < 210) {
-        // High heat = orange-yellow
-        uint8_t red = 255;
-        uint8_t green = map(heat, 140, 210, 40, 120);
-        color = CRGB(red, green, 0);
+void SuspendedFireEffect::updateSuspendedFireBase() {
+    // Cool, flow DOWNWARD and spark at the TOP for all segments in one kernel pass
+    FireField fields[] = {
+        { heatInner, NUM_INNER_STRIPS, INNER_LEDS_PER_STRIP, innerCoolRange },
+        { heatOuter, NUM_OUTER_STRIPS, OUTER_LEDS_PER_STRIP, outerCoolRange }
+    };
+    FireKernel::step(fields, 2, FireKernel::FLOW_DOWN, FIRE_SPARKING, rng);
+
+    // Apply dynamic flame height cutoff to each segment
+    for (int segment = 0; segment < NUM_INNER_STRIPS; segment++) {
+        applyFlameHeightCutoff(segment, true); // true = inner strip
     }
-    else {
-        // Very high heat = white-hot core
-        uint8_t red = 255;
-        uint8_t green = map(heat, 210, 255, 120, 255);
-        uint8_t blue = map(heat, 210, 255, 0, 220);
-        color = CRGB(red, green, blue);
+    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
+        applyFlameHeightCutoff(segment, false); // false = outer strip
     }
-
-    return (uint32_t)color.r << 16 | (uint32_t)color.g << 8 | color.b;
 }
 
 void SuspendedFireEffect::renderSuspendedFire() {
     // Clear all strips first
-    leds.clearAll();
+    target->clearAll();
 
     // Core strip remains off intentionally (same as FireEffect)
 
@@ -307,34 +201,8 @@ void SuspendedFireEffect::renderSuspendedFire() {
 
                 // Make sure we're in bounds
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-                    // Set the LED color based on heat
-                    uint32_t colorVal = heatToColor(heatInner[idx]);
-                    CRGB color = leds.neoColorToCRGB(colorVal);
-
-                    // Apply BLACK GRADIENT OVERLAY (unchanged from FireEffect)
-                    // This creates the fade to black at the TOP regardless of flame direction
-                    float fadeStartPosition = INNER_LEDS_PER_STRIP * 0.45f;
-
-                    if (i >= fadeStartPosition) {
-                        // Calculate fade factor with aggressive fading
-                        float fadeProgress = (float(i) - fadeStartPosition) / (INNER_LEDS_PER_STRIP - fadeStartPosition);
-                        fadeProgress = fadeProgress * fadeProgress * fadeProgress; // Cube for dramatic fade
-                        float fadeFactor = 1.0f - fadeProgress;
-
-                        // Apply fade by reducing all color components
-                        color.r = color.r * fadeFactor;
-                        color.g = color.g * fadeFactor;
-                        color.b = color.b * fadeFactor;
-
-                        // Force top 10% to be completely black
-                        if (i >= INNER_LEDS_PER_STRIP * 0.90f) {
-                            color.r = 0;
-                            color.g = 0;
-                            color.b = 0;
-                        }
-                    }
-
-                    leds.getInner()[physicalPos] = color;
+                    // Set the LED color based on heat (the top fade is applied below)
+                    target->getInner()[physicalPos] = heatPalette[heatInner[idx]];
                 }
             }
         }
@@ -353,38 +221,17 @@ void SuspendedFireEffect::renderSuspendedFire() {
 
                 // Make sure we're in bounds
                 if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-                    // Set the LED color based on heat
-                    uint32_t colorVal = heatToColor(heatOuter[idx]);
-                    CRGB color = leds.neoColorToCRGB(colorVal);
-
-                    // Apply BLACK GRADIENT OVERLAY (unchanged from FireEffect)
-                    // This creates the fade to black at the TOP regardless of flame direction
-                    float fadeStartPosition = OUTER_LEDS_PER_STRIP * 0.45f;
-
-                    if (i >= fadeStartPosition) {
-                        // Calculate fade factor with aggressive fading
-                        float fadeProgress = (float(i) - fadeStartPosition) / (OUTER_LEDS_PER_STRIP - fadeStartPosition);
-                        fadeProgress = fadeProgress * fadeProgress * fadeProgress; // Cube for dramatic fade
-                        float fadeFactor = 1.0f - fadeProgress;
-
-                        // Apply fade by reducing all color components
-                        color.r = color.r * fadeFactor;
-                        color.g = color.g * fadeFactor;
-                        color.b = color.b * fadeFactor;
-
-                        // Force top 10% to be completely black
-                        if (i >= OUTER_LEDS_PER_STRIP * 0.90f) {
-                            color.r = 0;
-                            color.g = 0;
-                            color.b = 0;
-                        }
-                    }
-
-                    leds.getOuter()[physicalPos] = color;
+                    // Set the LED color based on heat (the top fade is applied below)
+                    target->getOuter()[physicalPos] = heatPalette[heatOuter[idx]];
                 }
             }
         }
     }
+
+    // BLACK GRADIENT OVERLAY (same as FireEffect): fades to black at the TOP
+    // regardless of flame direction
+    leds.applyMask(target->getInner(), LEDController::MASK_INNER_FIRE_FADE);
+    leds.applyMask(target->getOuter(), LEDController::MASK_OUTER_FIRE_FADE);
 }
 
 int SuspendedFireEffect::mapLEDPosition(int stripType, int position, int subStrip) {
@@ -395,10 +242,13 @@ int SuspendedFireEffect::mapLEDPosition(int stripType, int position, int subStri
 void SuspendedFireEffect::setIntensity(byte newIntensity) {
     // Clamp intensity to valid range (0-100)
     intensity = constrain(newIntensity, 0, 100);
+
+    // Switch to the pre-scaled palette for this intensity
+    heatPalette = FirePalette::get(intensity);
 }
 
 void SuspendedFireEffect::updateFlameHeights() {
-    unsigned long currentTime = millis();
+    unsigned long currentTime = now();
 
     // Update flame height targets every 100-300ms for natural variation
     if (currentTime - lastHeightUpdate >= 150) {
@@ -409,7 +259,7 @@ void SuspendedFireEffect::updateFlameHeights() {
             // Generate new random target height between 60% and 100% (inner strips go higher)
             float minHeight = 0.60f;
             float maxHeight = 1.0f;
-            innerHeightTargets[i] = minHeight + (random(0, 100) / 100.0f) * (maxHeight - minHeight);
+            innerHeightTargets[i] = minHeight + (rng.range(0, 100) / 100.0f) * (maxHeight - minHeight);
         }
 
         // Update outer strip flame heights with individual variation
@@ -417,12 +267,12 @@ void SuspendedFireEffect::updateFlameHeights() {
             // Generate new random target height between 55% and 95% (outer strips are shorter)
             float minHeight = 0.55f;
             float maxHeight = 0.95f;
-            outerHeightTargets[i] = minHeight + (random(0, 100) / 100.0f) * (maxHeight - minHeight);
+            outerHeightTargets[i] = minHeight + (rng.range(0, 100) / 100.0f) * (maxHeight - minHeight);
         }
     }
 
     // Smoothly interpolate current heights toward targets
-    float lerpSpeed = 0.05f; // Adjust this for faster/slower height changes
+    float lerpSpeed = 0.05f; // Share of the gap closed per simulation tick - adjust for faster/slower height changes
 
     for (int i = 0; i < NUM_INNER_STRIPS; i++) {
         innerFlameHeights[i] += (innerHeightTargets[i] - innerFlameHeights[i]) * lerpSpeed;
@@ -4,6 +4,8 @@
 #define SUSPENDED_FIRE_EFFECT_H
 
 #include "Effect.h"
+#include "FireKernel.h"
+#include "FirePalette.h"
 #include <Arduino.h>
 
 /**
@@ -30,12 +32,6 @@ public:
      */
     ~SuspendedFireEffect();
 
-    /**
-     * Update the suspended fire effect animation
-     * Called on each animation frame
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      */
@@ -47,20 +43,46 @@ public:
      */
     void setIntensity(unsigned char intensity);
 
-    String getName() const override { return "Suspended Fire Effect"; }
+    /**
+     * The flames need a moment to reach down out of the starting heat pattern
+     */
+    unsigned long warmUpMs() const override { return FIRE_WARM_UP_MS; }
+
+    const char* getName() const override { return "Suspended Fire Effect"; }
 
 protected:
+    /**
+     * Update the suspended fire effect animation
+     * Called on each animation frame
+     */
+    void render() override;
+
+    /**
+     * Run the heat and flame height simulation for a warm-up step, without drawing
+     */
+    void simulate(unsigned long stepMs) override;
+
+    /**
+     * Set up the starting heat pattern - the constructor and reset() share it
+     * Only reset() warms up from it; a new effect warms up on its first update()
+     */
+    void initHeat();
+
     // Heat simulation arrays for each strip (same as FireEffect)
     unsigned char* heatCore;
     unsigned char* heatInner;
     unsigned char* heatOuter;
 
-    // Animation timing
-    unsigned long lastUpdateTime;
+    // The heat simulation always runs in fixed 20ms ticks (50 per second), whatever the frame rate
+    static constexpr float FIRE_STEP_MS = 20.0f;
+    static const unsigned long FIRE_WARM_UP_MS = 1500;  // Long enough for sparks to reach the bottom
 
     // Fire intensity (0-100)
     unsigned char intensity;
 
+    // Heat-to-color table for the current intensity (shared, owned by FirePalette)
+    const CRGB* heatPalette;
+
     // Dynamic flame height control for each strip segment
     float innerFlameHeights[NUM_INNER_STRIPS];     // Current flame height for each inner strip (0.0 to 1.0)
     float outerFlameHeights[NUM_OUTER_STRIPS];     // Current flame height for each outer strip (0.0 to 1.0)
@@ -68,12 +90,20 @@ protected:
     float outerHeightTargets[NUM_OUTER_STRIPS];    // Target height for smooth transitions
     unsigned long lastHeightUpdate;                // Last time we updated height targets
 
+    // Per-height cooling ranges for the fire kernel (each cell cools by 0..range-1)
+    uint8_t innerCoolRange[INNER_LEDS_PER_STRIP];
+    uint8_t outerCoolRange[OUTER_LEDS_PER_STRIP];
+
+    // Fire simulation parameters (same as FireEffect)
+    static const int FIRE_COOLING = 12;   // Heat loss rate
+    static const int FIRE_SPARKING = 110; // Spark chance per segment per step (out of 255)
+
     // Helper methods
+    void buildCoolingTable(uint8_t* table, int segmentLength);
     void updateSuspendedFireBase();  // Modified fire simulation for downward flames
     void updateFlameHeights();       // Update dynamic flame heights for realistic variation
     void applyFlameHeightCutoff(int segment, bool isInnerStrip); // Apply individual flame height limits
     void renderSuspendedFire();      // Modified rendering for inverted flames
-    uint32_t heatToColor(unsigned char heat);  // Same color mapping as FireEffect
     int mapLEDPosition(int stripType, int position, int subStrip = 0);  // LED position mapping
 };
 
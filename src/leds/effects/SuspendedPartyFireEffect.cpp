@@ -45,19 +45,20 @@ void SuspendedPartyFireEffect::reset() {
     Serial.println("SuspendedPartyFireEffect reset - core and slower, brighter ring restarted");
 }
 
-void SuspendedPartyFireEffect::update() {
-    // Handle suspended fire effect timing separately from core/ring timing
-    unsigned long currentTime = millis();
-
-    // Update suspended fire effect at its own pace (20ms intervals like base SuspendedFireEffect)
-    if (currentTime - lastUpdateTime >= 20) {
-        lastUpdateTime = currentTime;
-
-        // Update dynamic flame heights for natural variation
-        updateFlameHeights();
-
-        // Update the suspended fire simulation
-        updateSuspendedFireBase();
+void SuspendedPartyFireEffect::render() {
+    // Every call is a frame (no cap) - measure the time step for the core and ring breathing
+    beginFrame(0, REFERENCE_FRAME_MS);
+
+    // Update suspended fire effect at its own pace (20ms ticks like base SuspendedFireEffect)
+    int fireTicks = frameTicks(FIRE_STEP_MS);
+    if (fireTicks > 0) {
+        for (; fireTicks > 0; fireTicks--) {
+            // Update dynamic flame heights for natural variation
+            updateFlameHeights();
+
+            // Update the suspended fire simulation
+            updateSuspendedFireBase();
+        }
 
         // Render the suspended fire to inner and outer strips (but not show yet)
         renderSuspendedFire();
@@ -66,9 +67,6 @@ void SuspendedPartyFireEffect::update() {
     // Update core and ring at their own independent timing
     updateCoreGlow();
     updateRingBreathing();
-
-    // Show all the updated LEDs only once per frame
-    leds.showAll();
 }
 
 void SuspendedPartyFireEffect::updateCoreGlow() {
@@ -76,7 +74,7 @@ void SuspendedPartyFireEffect::updateCoreGlow() {
 
     // Always update breathing phase for core breathing effect
     static float coreBreathingPhase = 0.0f;
-    coreBreathingPhase += 0.005f; // Half speed: was 0.01f, now 0.005f
+    coreBreathingPhase += 0.005f * frameStep; // Half speed: was 0.01f, now 0.005f
 
     // Keep phase within 0 to 2*PI range
     if (coreBreathingPhase > 2.0f * PI) {
@@ -105,7 +103,7 @@ void SuspendedPartyFireEffect::updateCoreGlow() {
         lastCoreUpdate = currentTime;
 
         // Minimal random variation to keep breathing obvious
-        float intensityVariation = (random(100) / 100.0f) * 0.03f - 0.015f; // ±1.5% variation
+        float intensityVariation = (rng.range(100) / 100.0f) * 0.03f - 0.015f; // ±1.5% variation
         coreGlowIntensity = breathingIntensity + intensityVariation;
 
         // Keep intensity within valid range
@@ -128,17 +126,17 @@ void SuspendedPartyFireEffect::updateRingBreathing() {
     // Check if it's time to randomly change breathing speed (every 3-6 seconds)
     if (currentTime >= nextSpeedChange) {
         // Generate new random breathing speed (slower range for more relaxed breathing)
-        currentBreathingSpeed = 0.002f + (random(100) / 10000.0f); // 0.002 to 0.012 (slower)
+        currentBreathingSpeed = 0.002f + (rng.range(100) / 10000.0f); // 0.002 to 0.012 (slower)
 
         // Set next speed change time with random interval (3-6 seconds)
-        nextSpeedChange = currentTime + 3000 + random(3000);
+        nextSpeedChange = currentTime + 3000 + rng.range(3000);
 
         Serial.print("Ring breathing speed changed to: ");
         Serial.println(currentBreathingSpeed, 4);
     }
 
     // Always update the breathing phase for smooth animation
-    ringBreathingPhase += currentBreathingSpeed;
+    ringBreathingPhase += currentBreathingSpeed * frameStep;
 
     // Keep phase within 0 to 2*PI range
     if (ringBreathingPhase > 2.0f * PI) {
@@ -153,8 +151,8 @@ void SuspendedPartyFireEffect::updateRingBreathing() {
     float smoothedSine = normalizedSine * normalizedSine * (3.0f - 2.0f * normalizedSine); // Smoothstep
 
     // Create random peak heights (every few breathing cycles, change the peak intensity)
-    if (currentTime - lastPeakChange > 4000 + random(3000)) { // Every 4-7 seconds
-        peakIntensity = 0.75f + (random(25) / 100.0f); // Random peak between 75% and 100% (higher minimum)
+    if (currentTime - lastPeakChange > 4000 + rng.range(3000)) { // Every 4-7 seconds
+        peakIntensity = 0.75f + (rng.range(25) / 100.0f); // Random peak between 75% and 100% (higher minimum)
         lastPeakChange = currentTime;
     }
 
@@ -166,7 +164,7 @@ void SuspendedPartyFireEffect::updateRingBreathing() {
         lastRingUpdate = currentTime;
 
         // Apply gentle random variation for organic fire feeling
-        float flicker = (random(100) / 100.0f) * 0.08f - 0.04f; // ±4% flicker (reduced from ±7.5%)
+        float flicker = (rng.range(100) / 100.0f) * 0.08f - 0.04f; // ±4% flicker (reduced from ±7.5%)
         ringIntensity += flicker;
 
         // Keep intensity within valid range
@@ -207,7 +205,7 @@ void SuspendedPartyFireEffect::applyCoreGradientFlipped(float intensity) {
             float finalIntensity = gradientIntensity * intensity;
 
             // Convert deep red color to RGB components and add orange tint
-            CRGB baseColor = leds.neoColorToCRGB(CORE_DEEP_RED);
+            CRGB baseColor = Colors::fromHex(CORE_DEEP_RED);
 
             // Create red-orange color (more red, less orange)
             CRGB redOrangeColor = CRGB(
@@ -217,11 +215,7 @@ void SuspendedPartyFireEffect::applyCoreGradientFlipped(float intensity) {
             );
 
             // Apply intensity to create the final red-orange color
-            CRGB finalColor = CRGB(
-                redOrangeColor.r * finalIntensity,
-                redOrangeColor.g * finalIntensity,
-                redOrangeColor.b * finalIntensity
-            );
+            CRGB finalColor = Colors::scaled(redOrangeColor, finalIntensity);
 
             // Get physical LED position (handles segment flipping automatically)
             int physicalPos = mapLEDPosition(0, i, segment); // 0 = core strip type
@@ -230,7 +224,7 @@ void SuspendedPartyFireEffect::applyCoreGradientFlipped(float intensity) {
             int actualLEDIndex = (segment * segmentLength) + physicalPos;
 
             if (actualLEDIndex >= 0 && actualLEDIndex < LED_STRIP_CORE_COUNT) {
-                leds.getCore()[actualLEDIndex] = finalColor;
+                target->getCore()[actualLEDIndex] = finalColor;
             }
         }
     }
@@ -240,19 +234,14 @@ void SuspendedPartyFireEffect::applyRingGlow(float intensity) {
     // Apply simple solid breathing glow to ring strip (no complex blending)
 
     // Use the primary red color and just scale by intensity
-    CRGB primaryColor = leds.neoColorToCRGB(RING_RED_PRIMARY);
-    CRGB finalColor = CRGB(
-        primaryColor.r * intensity,
-        primaryColor.g * intensity,
-        primaryColor.b * intensity
-    );
+    CRGB finalColor = Colors::scaled(Colors::fromHex(RING_RED_PRIMARY), intensity);
 
     // Fill entire ring with the simple breathing color
-    fill_solid(leds.getRing(), LED_STRIP_RING_COUNT, finalColor);
+    fill_solid(target->getRing(), LED_STRIP_RING_COUNT, finalColor);
 }
 
 float SuspendedPartyFireEffect::generateRandomBreathingSpeed() {
     // Generate random breathing speed between 0.005 and 0.035 (same as PartyFireEffect)
     // This creates variety in the breathing pattern for natural fire effects
-    return 0.005f + (random(300) / 10000.0f); // 0.005 to 0.035
+    return 0.005f + (rng.range(300) / 10000.0f); // 0.005 to 0.035
 }
\ No newline at end of file
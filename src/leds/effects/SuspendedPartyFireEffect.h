@@ -27,12 +27,6 @@ public:
      */
     SuspendedPartyFireEffect(LEDController& ledController);
 
-    /**
-     * Update the effect - calls base suspended fire update then adds core and ring effects
-     * Called every frame to animate the fire
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Resets both base suspended fire effect and party-specific animations
@@ -43,9 +37,15 @@ public:
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Suspended Party Fire Effect"; }
+    const char* getName() const override { return "Suspended Party Fire Effect"; }
 
 private:
+    /**
+     * Update the effect - calls base suspended fire update then adds core and ring effects
+     * Called every frame to animate the fire
+     */
+    void render() override;
+
     // Core glow animation variables
     float coreGlowIntensity;        // Current intensity of core glow (0.0 to 1.0)
     unsigned long lastCoreUpdate;   // Last time core glow was updated
@@ -69,6 +69,7 @@ private:
     static constexpr uint32_t RING_RED_SECONDARY = 0xCC0000; // Deeper red for transitions
 
     // Animation timing constants
+    static constexpr float REFERENCE_FRAME_MS = 8.0f;          // Frame length the breathing speeds (radians per frame) are tuned for
     static const unsigned long CORE_UPDATE_INTERVAL = 50;      // Update core every 50ms (20 FPS)
     static const unsigned long RING_UPDATE_INTERVAL = 30;      // Update ring every 30ms (33 FPS)
     static const unsigned long SPEED_CHANGE_INTERVAL = 2000;   // Change breathing speed every 2 seconds
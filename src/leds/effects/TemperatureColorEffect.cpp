@@ -13,8 +13,7 @@ TemperatureColorEffect::TemperatureColorEffect(LEDController& ledController,
     coreEnabled(enableCore),
     innerEnabled(enableInner),
     outerEnabled(enableOuter),
-    ringEnabled(enableRing),
-    needsUpdate(true)  // Need to update on first frame
+    ringEnabled(enableRing)
 {
     // Calculate the RGB color from temperature
     calculatedColor = kelvinToRGB(temperature);
@@ -27,42 +26,32 @@ TemperatureColorEffect::TemperatureColorEffect(LEDController& ledController,
 
 void TemperatureColorEffect::reset() {
     // For static effect, just mark that we need to update
-    needsUpdate = true;
+    invalidate();
 }
 
-void TemperatureColorEffect::update() {
-    if (!shouldUpdate(500)) {
-        return;
-    }
-
+void TemperatureColorEffect::render() {
     // Clear all LEDs first
-    leds.clearAll();
+    target->clearAll();
 
     // Apply color to core strip if enabled
     if (coreEnabled) {
-        applySolidColor(leds.getCore(), LED_STRIP_CORE_COUNT, calculatedColor);
+        applySolidColor(target->getCore(), LED_STRIP_CORE_COUNT, calculatedColor);
     }
 
     // Apply color to inner strips if enabled
     if (innerEnabled) {
-        applySolidColor(leds.getInner(), LED_STRIP_INNER_COUNT, calculatedColor);
+        applySolidColor(target->getInner(), LED_STRIP_INNER_COUNT, calculatedColor);
     }
 
     // Apply color with fade to outer strips if enabled
     if (outerEnabled) {
-        applyFadeToOuter(leds.getOuter(), LED_STRIP_OUTER_COUNT, calculatedColor);
+        applyFadeToOuter(target->getOuter(), LED_STRIP_OUTER_COUNT, calculatedColor);
     }
 
     // Apply color to ring strip if enabled (unless skipped for button feedback)
     if (ringEnabled && !skipRing) {
-        applySolidColor(leds.getRing(), LED_STRIP_RING_COUNT, calculatedColor);
+        applySolidColor(target->getRing(), LED_STRIP_RING_COUNT, calculatedColor);
     }
-
-    // Show the LEDs
-    leds.showAll();
-
-    // Mark update as complete
-    needsUpdate = false;
 }
 
 void TemperatureColorEffect::setTemperature(uint16_t temperatureK) {
@@ -70,7 +59,7 @@ void TemperatureColorEffect::setTemperature(uint16_t temperatureK) {
     if (temperature != temperatureK) {
         temperature = temperatureK;
         calculatedColor = kelvinToRGB(temperature);
-        needsUpdate = true;
+        invalidate();
 
         Serial.print("Temperature changed to: ");
         Serial.print(temperature);
@@ -78,9 +67,9 @@ void TemperatureColorEffect::setTemperature(uint16_t temperatureK) {
     }
 }
 
-String TemperatureColorEffect::getName() const {
-    // Include temperature in the name for debugging
-    return "Temperature Color (" + String(temperature) + "K)";
+const char* TemperatureColorEffect::getName() const {
+    // The catalog entry names the temperature ("Incandescent", "Daylight")
+    return "Temperature Color";
 }
 
 CRGB TemperatureColorEffect::kelvinToRGB(uint16_t kelvin) {
@@ -134,45 +123,8 @@ void TemperatureColorEffect::applySolidColor(CRGB* strip, int count, CRGB color)
 }
 
 void TemperatureColorEffect::applyFadeToOuter(CRGB* strip, int count, CRGB color) {
-    // Apply fade to each of the 3 outer strip segments independently
-    for (int segment = 0; segment < NUM_OUTER_STRIPS; segment++) {
-        int segmentStart = segment * OUTER_LEDS_PER_STRIP;
-
-        // Apply fade within this segment
-        for (int i = 0; i < OUTER_LEDS_PER_STRIP; i++) {
-            int ledIndex = segmentStart + i;
-
-            // Calculate position ratio (0.0 at bottom, 1.0 at top)
-            float positionRatio = (float)i / (OUTER_LEDS_PER_STRIP - 1);
-
-            // Linear fade from bottom to top
-            // Bottom (i=0) = full brightness (1.0)
-            // Top (i=max) = no brightness (0.0)
-            float brightness = 1.0f - positionRatio;
-
-            // Optional: Apply a curve to make the fade more dramatic
-            // Uncomment one of these for different fade curves:
-
-            // Square curve - faster fade at the top
-            // brightness = brightness * brightness;
-
-            // Square root curve - faster fade at the bottom
-            // brightness = sqrt(brightness);
-
-            // S-curve - slow at edges, fast in middle
-            // brightness = brightness * brightness * (3.0f - 2.0f * brightness);
-
-            // Apply brightness to the color
-            CRGB fadedColor = CRGB(
-                (uint8_t)(color.r * brightness),
-                (uint8_t)(color.g * brightness),
-                (uint8_t)(color.b * brightness)
-            );
-
-            // Set the LED
-            if (ledIndex < count) {
-                strip[ledIndex] = fadedColor;
-            }
-        }
-    }
+    // Fill with the base color, then fade each of the 3 outer segments from
+    // full brightness at the bottom to black at the top with the shared mask
+    fill_solid(strip, count, color);
+    leds.applyMask(strip, LEDController::MASK_OUTER_LINEAR_FADE);
 }
\ No newline at end of file
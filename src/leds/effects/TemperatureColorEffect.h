@@ -41,10 +41,10 @@ public:
                           bool enableRing = true);
 
     /**
-     * Update the effect - applies the color temperature to enabled strips
-     * Since this is a static effect, it only needs to set colors once
+     * The color only changes when the temperature or a strip setting changes
+     * @return Always true
      */
-    void update() override;
+    bool isStatic() const override { return true; }
 
     /**
      * Reset the effect - for static effect, just reapplies the color
@@ -55,7 +55,7 @@ public:
      * Get the name of this effect
      * @return Effect name for display/debugging
      */
-    String getName() const override;
+    const char* getName() const override;
 
     /**
      * Set a new color temperature
@@ -72,12 +72,18 @@ public:
     /**
      * Enable or disable individual strips
      */
-    void setCoreEnabled(bool enabled) { coreEnabled = enabled; needsUpdate = true; }
-    void setInnerEnabled(bool enabled) { innerEnabled = enabled; needsUpdate = true; }
-    void setOuterEnabled(bool enabled) { outerEnabled = enabled; needsUpdate = true; }
-    void setRingEnabled(bool enabled) { ringEnabled = enabled; needsUpdate = true; }
+    void setCoreEnabled(bool enabled) { coreEnabled = enabled; invalidate(); }
+    void setInnerEnabled(bool enabled) { innerEnabled = enabled; invalidate(); }
+    void setOuterEnabled(bool enabled) { outerEnabled = enabled; invalidate(); }
+    void setRingEnabled(bool enabled) { ringEnabled = enabled; invalidate(); }
 
 private:
+    /**
+     * Update the effect - applies the color temperature to enabled strips
+     * Since this is a static effect, it only needs to set colors once
+     */
+    void render() override;
+
     // Current color temperature in Kelvin
     uint16_t temperature;
 
@@ -90,9 +96,6 @@ private:
     bool outerEnabled;      // Whether outer strips show color (with fade)
     bool ringEnabled;       // Whether ring strip shows color
 
-    // Flag to track if we need to update the LEDs
-    bool needsUpdate;
-
     // Fade parameters for outer strips
     static constexpr float FADE_START_POSITION = 0.9f;  // Start fading at 30% up the strip
     static constexpr float MIN_BRIGHTNESS = 0.0f;       // Fade to complete black at top
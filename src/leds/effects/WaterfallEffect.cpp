@@ -29,29 +29,27 @@ void WaterfallEffect::reset() {
         drop.isActive = false;
         drop.hasSplashed = false;
     }
+
+    // Start with the waterfall already flowing instead of an empty strip
+    warmUp(warmUpMs());
 }
 
 // Main update function - called every frame
-void WaterfallEffect::update() {
+void WaterfallEffect::render() {
     // Smoother frame rate for fluid transitions
-    if (!shouldUpdate(33)) {  // 33ms = 30 FPS (smoother than 20 FPS)
+    if (!beginFrame(33, REFERENCE_FRAME_MS)) {  // 33ms = 30 FPS (smoother than 20 FPS)
         return;
     }
 
     // Step 1: Fill background with subtle water color
     fillBackgroundWater();
 
-    // Step 2: More frequent drop creation (25% increase in trail amount)
-    if (random(100) < 19) {  // Increased from 15 to 19 (25% more: 15 * 1.25 = 18.75, rounded to 19)
-        createNewDrop();
-    }
+    // Step 2: Create and move the drops
+    stepDrops();
 
-    // Step 3: Update and draw all active drops
-    for (auto& drop : waterDrops) {
+    // Step 3: Draw all active drops
+    for (const auto& drop : waterDrops) {
         if (drop.isActive) {
-            // Update the drop's position and properties
-            updateDrop(drop);
-
             // Draw the drop (or its splash) on the LEDs
             if (drop.hasSplashed) {
                 drawSplash(drop);
@@ -60,9 +58,27 @@ void WaterfallEffect::update() {
             }
         }
     }
+}
 
-    // Step 4: Show all the changes on the LED strips
-    leds.showAll();
+// Warm-up step - the drops move, nothing is drawn
+void WaterfallEffect::simulate(unsigned long stepMs) {
+    setTimeStep(stepMs, REFERENCE_FRAME_MS);
+    stepDrops();
+}
+
+// Create and move drops - shared by frames and warm-up steps
+void WaterfallEffect::stepDrops() {
+    // More frequent drop creation (25% increase in trail amount)
+    if (frameChance(19 / 100.0f)) {  // Increased from 15 to 19 (25% more: 15 * 1.25 = 18.75, rounded to 19)
+        createNewDrop();
+    }
+
+    // Update each drop's position and properties
+    for (auto& drop : waterDrops) {
+        if (drop.isActive) {
+            updateDrop(drop);
+        }
+    }
 }
 
 // Fill all LEDs with subtle background water color
@@ -73,82 +89,91 @@ void WaterfallEffect::fillBackgroundWater() {
 
     // Fill all inner strips with background water
     for (int i = 0; i < LED_STRIP_INNER_COUNT; i++) {
-        leds.getInner()[i] = backgroundWater;
+        target->getInner()[i] = backgroundWater;
     }
 
     // Fill all outer strips with background water
     for (int i = 0; i < LED_STRIP_OUTER_COUNT; i++) {
-        leds.getOuter()[i] = backgroundWater;
+        target->getOuter()[i] = backgroundWater;
     }
 
     // Clear core and ring strips (focus attention on waterfall)
     for (int i = 0; i < LED_STRIP_CORE_COUNT; i++) {
-        leds.getCore()[i] = CRGB::Black;
+        target->getCore()[i] = CRGB::Black;
     }
 
     for (int i = 0; i < LED_STRIP_RING_COUNT; i++) {
-        leds.getRing()[i] = CRGB::Black;
+        target->getRing()[i] = CRGB::Black;
     }
 }
 
 // Create a new water drop with random properties
 void WaterfallEffect::createNewDrop() {
+    // Fewer drops at reduced quality - the ones already falling still finish
+    int activeDrops = 0;
+    for (const auto& drop : waterDrops) {
+        if (drop.isActive) activeDrops++;
+    }
+    if (activeDrops >= qualityBudget(MAX_DROPS)) {
+        return;
+    }
+
     // Find an inactive drop slot to reuse
     for (auto& drop : waterDrops) {
         if (!drop.isActive) {
             // Initialize this drop with random properties
 
             // Choose which strip type (inner or outer only)
-            drop.stripType = random(1, 3);  // 1 or 2 (inner or outer)
+            drop.stripType = rng.range(1, 3);  // 1 or 2 (inner or outer)
 
             // Choose which segment of that strip type (0, 1, or 2)
-            drop.subStrip = random(3);
+            drop.subStrip = rng.range(3);
 
             // Start the drop below the strip so trail enters gradually
             drop.position = 0 - drop.trailLength;
 
             // ENHANCED: More varied trail lengths with some very long trails
-            int dropType = random(100);
+            int dropType = rng.range(100);
             if (dropType < 35) {
                 // 35% chance: Medium drops (15-35 pixels)
-                drop.trailLength = 15 + random(21);
+                drop.trailLength = 15 + rng.range(21);
             } else if (dropType < 60) {
                 // 25% chance: Large streams (40-70 pixels)
-                drop.trailLength = 40 + random(31);
+                drop.trailLength = 40 + rng.range(31);
             } else if (dropType < 85) {
                 // 25% chance: Very long waterfalls (75-120 pixels)
-                drop.trailLength = 75 + random(46);
+                drop.trailLength = 75 + rng.range(46);
             } else {
                 // 15% chance: Massive cascading waterfalls (125-180 pixels!)
-                drop.trailLength = 125 + random(56);
+                drop.trailLength = 125 + rng.range(56);
             }
 
             // 6x faster initial speeds and size bonus (50% faster than 4x)
             float sizeSpeedBonus = (drop.trailLength - 15) * 0.01728f;  // 50% faster: 0.01152f -> 0.01728f
             drop.speed = 0.06912f + sizeSpeedBonus +
-                        (random(100) / 100.0f) * (0.27648f - 0.06912f);  // 50% faster: 0.04608f-0.18432f -> 0.06912f-0.27648f
+                        (rng.range(100) / 100.0f) * (0.27648f - 0.06912f);  // 50% faster: 0.04608f-0.18432f -> 0.06912f-0.27648f
 
             // 6x stronger gravity (50% faster than 4x)
             drop.acceleration = 0.010368f;  // 50% stronger: 0.006912f -> 0.010368f
 
             // Water drops are blue-ish with some variation
-            drop.hue = 140 + random(40);  // Blue range (140-180)
+            drop.hue = 140 + rng.range(40);  // Blue range (140-180)
 
             // Longer trails get slightly brighter for visual impact
             int brightnessBonus = min(50, drop.trailLength / 3);
-            drop.maxBrightness = 160 + random(70) + brightnessBonus;
+            drop.maxBrightness = 160 + rng.range(70) + brightnessBonus;
 
             // Start with zero brightness - will fade in gradually
             drop.brightness = 0;
 
             // Longer trails take more time to fade in for smoother appearance
             drop.fadeInFrames = 12 + min(18, drop.trailLength / 6);  // 12-30 frames for smoother fade-in
-            drop.currentFrame = 0;
+            drop.currentFrame = 0.0f;
 
             // Mark as active and not splashed yet
             drop.isActive = true;
             drop.hasSplashed = false;
-            drop.splashFrame = 0;
+            drop.splashFrame = 0.0f;
 
             // Only create one drop per function call
             return;
@@ -161,7 +186,7 @@ void WaterfallEffect::createNewDrop() {
 void WaterfallEffect::updateDrop(WaterDrop& drop) {
     // If drop is splashing, just update splash animation
     if (drop.hasSplashed) {
-        drop.splashFrame++;
+        drop.splashFrame += frameStep;
 
         // Remove drop when splash animation is complete
         if (drop.splashFrame >= SPLASH_FRAMES) {
@@ -172,10 +197,10 @@ void WaterfallEffect::updateDrop(WaterDrop& drop) {
 
     // Update fade-in effect for new drops
     if (drop.currentFrame < drop.fadeInFrames) {
-        drop.currentFrame++;
+        drop.currentFrame = min((float)drop.fadeInFrames, drop.currentFrame + frameStep);
 
         // Calculate fade-in progress (0.0 to 1.0)
-        float fadeProgress = (float)drop.currentFrame / drop.fadeInFrames;
+        float fadeProgress = drop.currentFrame / drop.fadeInFrames;
 
         // Apply smooth cubic easing for gentler fade-in
         fadeProgress = fadeProgress * fadeProgress * (3.0f - 2.0f * fadeProgress);  // Smoothstep
@@ -188,8 +213,8 @@ void WaterfallEffect::updateDrop(WaterDrop& drop) {
     }
 
     // Update position (physics simulation)
-    drop.position += drop.speed;
-    drop.speed += drop.acceleration;  // Gravity effect
+    drop.position += drop.speed * frameStep;
+    drop.speed += drop.acceleration * frameStep;  // Gravity effect
 
     // Cap maximum speed 6x higher (50% faster than 4x)
     if (drop.speed > 0.6912f) {  // 50% higher maximum speed: 0.4608f -> 0.6912f
@@ -200,7 +225,7 @@ void WaterfallEffect::updateDrop(WaterDrop& drop) {
     int stripLength = getStripLength(drop.stripType);
     if (drop.position >= stripLength + drop.trailLength) {
         drop.hasSplashed = true;
-        drop.splashFrame = 0;
+        drop.splashFrame = 0.0f;
     }
 }
 
@@ -261,11 +286,11 @@ void WaterfallEffect::drawDrop(const WaterDrop& drop) {
         // Add color to the LED (additive blending for overlapping drops)
         if (drop.stripType == 1) {  // Inner
             if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-                leds.getInner()[physicalPos] += dropColor;
+                target->getInner()[physicalPos] += dropColor;
             }
         } else if (drop.stripType == 2) {  // Outer
             if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-                leds.getOuter()[physicalPos] += dropColor;
+                target->getOuter()[physicalPos] += dropColor;
             }
         }
     }
@@ -274,7 +299,7 @@ void WaterfallEffect::drawDrop(const WaterDrop& drop) {
 // Draw splash effect when drop hits the top
 void WaterfallEffect::drawSplash(const WaterDrop& drop) {
     // Calculate splash brightness (fades out over time)
-    float fadeRatio = 1.0f - ((float)drop.splashFrame / SPLASH_FRAMES);
+    float fadeRatio = 1.0f - (drop.splashFrame / SPLASH_FRAMES);
     uint8_t splashBrightness = drop.brightness * fadeRatio * 0.6f;
 
     // Get splash color
@@ -294,11 +319,11 @@ void WaterfallEffect::drawSplash(const WaterDrop& drop) {
     // Add splash color to the LED
     if (drop.stripType == 1) {  // Inner
         if (physicalPos >= 0 && physicalPos < LED_STRIP_INNER_COUNT) {
-            leds.getInner()[physicalPos] += splashColor;
+            target->getInner()[physicalPos] += splashColor;
         }
     } else if (drop.stripType == 2) {  // Outer
         if (physicalPos >= 0 && physicalPos < LED_STRIP_OUTER_COUNT) {
-            leds.getOuter()[physicalPos] += splashColor;
+            target->getOuter()[physicalPos] += splashColor;
         }
     }
 }
@@ -12,17 +12,17 @@
  */
 struct WaterDrop {
     float position;         // Current position on the strip (float for smooth movement)
-    float speed;           // How fast the drop is falling (pixels per frame)
-    float acceleration;    // How much speed increases each frame (gravity effect)
+    float speed;           // How fast the drop is falling (pixels per 33ms frame)
+    float acceleration;    // How much speed increases each 33ms frame (gravity effect)
     uint8_t brightness;    // Current brightness of the drop (0-255)
     uint8_t maxBrightness; // Maximum brightness this drop will reach when fully formed
     uint8_t hue;          // Color hue of the drop (0-255 for FastLED)
     uint8_t trailLength;  // How long the fading trail behind this drop is (12-90 pixels, no small dots)
     uint8_t fadeInFrames; // How many frames it takes for this drop to fade in
-    uint8_t currentFrame; // Current frame since drop was created (for fade-in)
+    float currentFrame;   // Frames since drop was created (for fade-in, counts partial frames)
     bool isActive;        // Whether this drop is currently falling
     bool hasSplashed;     // Whether this drop has hit the bottom and splashed
-    int splashFrame;      // Which frame of the splash animation we're on
+    float splashFrame;    // How far into the splash animation we are, in frames
     int stripType;        // Which strip this drop is on (1=inner, 2=outer)
     int subStrip;         // Which segment of the strip (0-2)
 };
@@ -52,32 +52,44 @@ public:
      */
     ~WaterfallEffect();
 
-    /**
-     * Update the waterfall animation each frame
-     * Handles drop physics, creation, and splash effects
-     */
-    void update() override;
-
     /**
      * Reset the effect to initial state
      * Clears all active drops and splash effects
      */
     void reset() override;
 
+    /**
+     * Long enough for the first drops to fall all the way and splash
+     */
+    unsigned long warmUpMs() const override { return WARM_UP_MS; }
+
     /**
      * Get the name of this effect for debugging/display
      * @return The effect name as a string
      */
-    String getName() const override { return "Waterfall Effect"; }
+    const char* getName() const override { return "Waterfall Effect"; }
 
 private:
+    /**
+     * Update the waterfall animation each frame
+     * Handles drop physics, creation, and splash effects
+     */
+    void render() override;
+
+    /**
+     * Let drops fall for a warm-up step, without drawing
+     */
+    void simulate(unsigned long stepMs) override;
+
     // Collection of all water drops (both active and inactive)
     std::vector<WaterDrop> waterDrops;
 
     // Effect parameters - these control how the waterfall looks and behaves
+    static constexpr float REFERENCE_FRAME_MS = 33.0f;  // Frame length all per-frame values are tuned for
     static const int MAX_DROPS = 25;           // More drops for denser waterfall
     static const int DROP_CREATE_CHANCE = 15;  // Higher chance per frame to create new drop (out of 100)
     static const int SPLASH_FRAMES = 12;       // Longer splash duration
+    static const unsigned long WARM_UP_MS = 3000;  // Time for the slow long trails to reach the bottom
 
     // Physics parameters for realistic water movement (NOT USED - see .cpp file for actual values)
     static constexpr float MIN_START_SPEED = 0.02f;   // Placeholder - actual values in createNewDrop()
@@ -91,6 +103,11 @@ private:
      */
     void fillBackgroundWater();
 
+    /**
+     * Maybe start a new drop, then move every active drop by the current time step
+     */
+    void stepDrops();
+
     /**
      * Create a new water drop at the top of a random strip
      * Finds an inactive drop slot and initializes it with random properties
@@ -0,0 +1,438 @@
+// tools/animation/anim_tool.cpp
+//
+// Host tool for the lantern's pre-rendered animations (src/leds/AnimationCodec.h)
+// and recorded frame streams (src/leds/FrameCodec.h)
+//
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -Iinclude -Isrc/leds -o anim_tool
+//       tools/animation/anim_tool.cpp src/leds/AnimationCodec.cpp src/leds/FrameCodec.cpp
+//
+// Making an animation:
+//   1. Set CAPTURE_SHOW_FRAMES to 1 in Config.h, flash, and run the effect to record
+//   2. Save the serial output to a file, for example:
+//        pio device monitor --raw --quiet > capture.bin
+//   3. Encode it:
+//        ./anim_tool encode capture.bin show.anim --frame-ms 20 --key 50
+//   4. Write it to the "anim" partition (offset from partitions.csv):
+//        esptool.py --chip esp32s3 write_flash 0x290000 show.anim
+//   5. Set CAPTURE_SHOW_FRAMES back to 0, flash, and select "Flash Animation"
+//      (the last effect in Animated mode - it is only listed while the
+//      partition holds a valid animation, checked at boot)
+//
+// Commands:
+//   encode <capture> <out.anim> [--frame-ms N] [--key N] [--once]
+//       Turn a capture into an animation. Frames are resampled to a fixed
+//       interval (the lantern only shows frames when something changed),
+//       key frames are written every N frames (0 = only the first), and
+//       --once holds the last frame instead of looping. The result is
+//       decoded again and compared with the input before it is written.
+//   decode <in.anim> <out.rgb>
+//       Write every frame as raw RGB (core, inner, outer, ring), for tests
+//       and for viewing the animation on the host.
+//   info <in.anim>
+//       Print the header and how the frames were coded.
+//   bench <capture or .anim>
+//       Code the frames with FrameCodec (several settings) and the animation
+//       format, and print bytes per frame and encode/decode frames per second.
+//       Every setting is checked by comparing the decoded frames.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Config.h"
+#include "AnimationCodec.h"
+#include "FrameCodec.h"
+
+using namespace AnimationCodec;
+
+static const int STRIP_COUNTS[] = {
+    LED_STRIP_CORE_COUNT, LED_STRIP_INNER_COUNT, LED_STRIP_OUTER_COUNT, LED_STRIP_RING_COUNT
+};
+static const int FRAME_LEDS = LED_STRIP_CORE_COUNT + LED_STRIP_INNER_COUNT +
+                              LED_STRIP_OUTER_COUNT + LED_STRIP_RING_COUNT;
+static const size_t FRAME_BYTES = FRAME_LEDS * 3;
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if (f == nullptr) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    uint8_t buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        out.insert(out.end(), buffer, buffer + n);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool writeFile(const char* path, const std::vector<uint8_t>& data) {
+    FILE* f = fopen(path, "wb");
+    if (f == nullptr || fwrite(data.data(), 1, data.size(), f) != data.size()) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        if (f != nullptr) fclose(f);
+        return false;
+    }
+    fclose(f);
+    return true;
+}
+
+// Point one span at each strip of a frame buffer
+static void frameSpans(uint8_t* frame, Span spans[4]) {
+    for (int s = 0; s < 4; s++) {
+        spans[s] = {frame, STRIP_COUNTS[s]};
+        frame += STRIP_COUNTS[s] * 3;
+    }
+}
+
+// Decode every frame of a file into frames (FRAME_BYTES each), through the
+// same strip-by-strip spans the lantern uses
+static bool decodeAll(const std::vector<uint8_t>& file, Header& header, std::vector<uint8_t>& frames) {
+    if (!readHeader(file.data(), file.size(), header)) {
+        fprintf(stderr, "Not a valid animation file\n");
+        return false;
+    }
+    if (header.ledCount != FRAME_LEDS) {
+        fprintf(stderr, "Animation has %d LEDs per frame, the lantern has %d\n", header.ledCount, FRAME_LEDS);
+        return false;
+    }
+
+    std::vector<uint8_t> frame(FRAME_BYTES, 0);
+    frames.clear();
+    for (uint32_t i = 0; i < header.frameCount; i++) {
+        Span spans[4];
+        frameSpans(frame.data(), spans);
+
+        size_t recordSize;
+        const uint8_t* record = frameRecord(file.data(), header, i, recordSize);
+        if (!decodeFrame(record, recordSize, spans, 4)) {
+            fprintf(stderr, "Frame %u is damaged\n", i);
+            return false;
+        }
+        frames.insert(frames.end(), frame.begin(), frame.end());
+    }
+    return true;
+}
+
+// Read a capture (CAPTURE_SHOW_FRAMES): records of "LFRZ", time (ms),
+// sequence number, coded size and one FrameCodec frame. Anything between
+// records is log text. Frames are decoded in order; after a lost or damaged
+// record each strip waits for its next key before frames are used again.
+static bool readCapture(const char* path, std::vector<uint32_t>& times, std::vector<uint8_t>& frames,
+                        size_t& skipped) {
+    std::vector<uint8_t> capture;
+    if (!readFile(path, capture)) return false;
+
+    std::vector<uint8_t> frame(FRAME_BYTES, 0);
+    Span spans[4];
+    frameSpans(frame.data(), spans);
+
+    uint8_t valid = 0;  // Strips that hold the right colors (bit per strip)
+    uint16_t expected = 0;
+    bool first = true;
+    for (size_t pos = 0; pos + 12 <= capture.size();) {
+        const uint8_t* r = capture.data() + pos;
+        size_t size = r[10] | (r[11] << 8);
+        if (memcmp(r, "LFRZ", 4) != 0 || pos + 12 + size > capture.size()) {
+            pos++;
+            continue;
+        }
+        uint32_t time = r[4] | (r[5] << 8) | (r[6] << 16) | ((uint32_t)r[7] << 24);
+        uint16_t sequence = r[8] | (r[9] << 8);
+
+        if (!times.empty() && time < times.back()) {
+            fprintf(stderr, "Capture goes back in time at %zu - was the lantern restarted? Stopping there.\n", pos);
+            break;
+        }
+        if (!first && sequence != expected) {
+            valid = 0;  // Records went missing - the deltas no longer line up
+        }
+        first = false;
+        expected = sequence + 1;
+
+        uint8_t keyed = 0;
+        if (FrameCodec::decode(r + 12, size, spans, 4, &keyed)) {
+            valid |= keyed;
+            pos += 12 + size;
+        } else {
+            valid = 0;
+            pos++;  // Probably not a real record - keep looking
+        }
+
+        if (valid == 0x0F) {
+            times.push_back(time);
+            frames.insert(frames.end(), frame.begin(), frame.end());
+        } else {
+            skipped++;
+        }
+    }
+
+    if (times.empty()) {
+        fprintf(stderr, "No frames in %s (was CAPTURE_SHOW_FRAMES on?)\n", path);
+        return false;
+    }
+    return true;
+}
+
+static int encode(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "encode <capture> <out.anim> [--frame-ms N] [--key N] [--once]\n");
+        return 1;
+    }
+    int frameMs = 20;
+    int keyInterval = 50;
+    uint16_t flags = FLAG_LOOP;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--frame-ms") && i + 1 < argc) frameMs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--key") && i + 1 < argc) keyInterval = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--once")) flags &= ~FLAG_LOOP;
+        else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (frameMs < 1 || frameMs > 65535 || keyInterval < 0) {
+        fprintf(stderr, "Bad --frame-ms or --key\n");
+        return 1;
+    }
+
+    std::vector<uint32_t> times;
+    std::vector<uint8_t> shown;
+    size_t skipped = 0;
+    if (!readCapture(argv[0], times, shown, skipped)) return 1;
+    size_t shownCount = times.size();
+
+    // The lantern skips showing frames that did not change, so hold each
+    // captured frame until the next one to get a fixed frame interval
+    std::vector<uint8_t> frames;
+    size_t next = 0;
+    for (uint32_t tick = times.front(); tick <= times.back(); tick += frameMs) {
+        while (next + 1 < times.size() && times[next + 1] <= tick) next++;
+        frames.insert(frames.end(), shown.begin() + next * FRAME_BYTES, shown.begin() + (next + 1) * FRAME_BYTES);
+    }
+    uint32_t frameCount = frames.size() / FRAME_BYTES;
+
+    std::vector<uint8_t> file;
+    encodeFile(frames.data(), frameCount, FRAME_LEDS, (uint16_t)frameMs, flags, keyInterval, file);
+
+    // Make sure the lantern will see exactly what was captured
+    Header header;
+    std::vector<uint8_t> decoded;
+    if (!decodeAll(file, header, decoded) || decoded != frames) {
+        fprintf(stderr, "Decoded animation does not match the capture - not written\n");
+        return 1;
+    }
+    if (!writeFile(argv[1], file)) return 1;
+
+    if (skipped > 0) {
+        printf("%zu captured frames were lost or damaged and left out\n", skipped);
+    }
+    printf("%zu captured frames -> %u frames at %dms (%.1fs)\n",
+           shownCount, frameCount, frameMs, frameCount * frameMs / 1000.0);
+    printf("%zu bytes (%.1f per frame, %.1f%% of raw)\n", file.size(),
+           (double)file.size() / frameCount, 100.0 * file.size() / frames.size());
+    if (file.size() > 0x160000) {
+        printf("Warning: larger than the anim partition in partitions.csv\n");
+    }
+    return 0;
+}
+
+static int decode(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "decode <in.anim> <out.rgb>\n");
+        return 1;
+    }
+    std::vector<uint8_t> file, frames;
+    Header header;
+    if (!readFile(argv[0], file) || !decodeAll(file, header, frames) || !writeFile(argv[1], frames)) {
+        return 1;
+    }
+    printf("%u frames of %d LEDs written\n", header.frameCount, header.ledCount);
+    return 0;
+}
+
+static int info(int argc, char** argv) {
+    if (argc < 1) {
+        fprintf(stderr, "info <in.anim>\n");
+        return 1;
+    }
+    std::vector<uint8_t> file, frames;
+    Header header;
+    if (!readFile(argv[0], file) || !decodeAll(file, header, frames)) {
+        return 1;
+    }
+
+    uint32_t keyFrames = 0;
+    size_t keyBytes = 0, deltaBytes = 0, largest = 0;
+    for (uint32_t i = 0; i < header.frameCount; i++) {
+        size_t recordSize;
+        frameRecord(file.data(), header, i, recordSize);
+        if (isKeyFrame(file.data(), header, i)) {
+            keyFrames++;
+            keyBytes += recordSize;
+        } else {
+            deltaBytes += recordSize;
+        }
+        if (recordSize > largest) largest = recordSize;
+    }
+    uint32_t deltaFrames = header.frameCount - keyFrames;
+
+    printf("Frames:       %u at %ums (%.1fs), %s\n", header.frameCount, header.frameMs,
+           header.frameCount * header.frameMs / 1000.0, (header.flags & FLAG_LOOP) ? "looping" : "plays once");
+    printf("LEDs:         %u\n", header.ledCount);
+    printf("File:         %zu bytes (%.1f%% of raw)\n", file.size(), 100.0 * file.size() / frames.size());
+    printf("Key frames:   %u, %.1f bytes each\n", keyFrames, keyFrames ? (double)keyBytes / keyFrames : 0.0);
+    printf("Delta frames: %u, %.1f bytes each\n", deltaFrames, deltaFrames ? (double)deltaBytes / deltaFrames : 0.0);
+    printf("Largest:      %zu bytes\n", largest);
+    return 0;
+}
+
+// Seconds since an earlier time
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Code every frame with FrameCodec, time encoding and decoding, and check the result
+static bool benchFrameCodec(const char* label, const std::vector<uint8_t>& frames, const FrameCodec::Options& options) {
+    size_t frameCount = frames.size() / FRAME_BYTES;
+    std::vector<uint8_t> coded;
+    std::vector<size_t> sizes;
+
+    // Encode (repeated until the timing means something, from a fresh encoder each pass)
+    int passes = 0;
+    auto start = std::chrono::steady_clock::now();
+    do {
+        FrameCodec::Encoder encoder(STRIP_COUNTS, 4, options);
+        coded.clear();
+        sizes.clear();
+        for (size_t f = 0; f < frameCount; f++) {
+            sizes.push_back(encoder.encode(frames.data() + f * FRAME_BYTES, coded));
+        }
+        passes++;
+    } while (secondsSince(start) < 0.5);
+    double encodeRate = passes * frameCount / secondsSince(start);
+
+    // Decode in place into one frame buffer, the way the lantern would
+    std::vector<uint8_t> frame(FRAME_BYTES, 0);
+    Span spans[4];
+    frameSpans(frame.data(), spans);
+
+    bool matches = true;
+    passes = 0;
+    start = std::chrono::steady_clock::now();
+    do {
+        const uint8_t* p = coded.data();
+        for (size_t f = 0; f < frameCount; f++) {
+            if (!FrameCodec::decode(p, sizes[f], spans, 4) ||
+                (passes == 0 && memcmp(frame.data(), frames.data() + f * FRAME_BYTES, FRAME_BYTES) != 0)) {
+                matches = false;
+            }
+            p += sizes[f];
+        }
+        passes++;
+    } while (secondsSince(start) < 0.5);
+    double decodeRate = passes * frameCount / secondsSince(start);
+
+    size_t largest = 0;
+    for (size_t size : sizes) if (size > largest) largest = size;
+    printf("%-28s %8.1f %8zu %7.1f%% %12.0f %12.0f  %s\n", label,
+           (double)coded.size() / frameCount, largest, 100.0 * coded.size() / frames.size(),
+           encodeRate, decodeRate, matches ? "ok" : "MISMATCH");
+    return matches;
+}
+
+// The same for the animation file format, for comparison
+static bool benchAnimationCodec(const char* label, const std::vector<uint8_t>& frames, uint32_t keyInterval) {
+    uint32_t frameCount = frames.size() / FRAME_BYTES;
+    std::vector<uint8_t> file;
+
+    int passes = 0;
+    auto start = std::chrono::steady_clock::now();
+    do {
+        encodeFile(frames.data(), frameCount, FRAME_LEDS, 20, FLAG_LOOP, keyInterval, file);
+        passes++;
+    } while (secondsSince(start) < 0.5);
+    double encodeRate = passes * frameCount / secondsSince(start);
+
+    Header header;
+    readHeader(file.data(), file.size(), header);
+    std::vector<uint8_t> frame(FRAME_BYTES, 0);
+    Span spans[4];
+    frameSpans(frame.data(), spans);
+
+    bool matches = true;
+    size_t largest = 0;
+    passes = 0;
+    start = std::chrono::steady_clock::now();
+    do {
+        for (uint32_t f = 0; f < frameCount; f++) {
+            size_t recordSize;
+            const uint8_t* record = frameRecord(file.data(), header, f, recordSize);
+            if (!decodeFrame(record, recordSize, spans, 4) ||
+                (passes == 0 && memcmp(frame.data(), frames.data() + f * FRAME_BYTES, FRAME_BYTES) != 0)) {
+                matches = false;
+            }
+            if (recordSize > largest) largest = recordSize;
+        }
+        passes++;
+    } while (secondsSince(start) < 0.5);
+    double decodeRate = passes * frameCount / secondsSince(start);
+
+    printf("%-28s %8.1f %8zu %7.1f%% %12.0f %12.0f  %s\n", label,
+           (double)file.size() / frameCount, largest, 100.0 * file.size() / frames.size(),
+           encodeRate, decodeRate, matches ? "ok" : "MISMATCH");
+    return matches;
+}
+
+static int bench(int argc, char** argv) {
+    if (argc < 1) {
+        fprintf(stderr, "bench <capture or .anim>\n");
+        return 1;
+    }
+
+    // Animation files are benchmarked on their frames, captures on the frames as shown
+    std::vector<uint8_t> file, frames;
+    Header header;
+    if (!readFile(argv[0], file)) return 1;
+    if (readHeader(file.data(), file.size(), header)) {
+        if (!decodeAll(file, header, frames)) return 1;
+    } else {
+        std::vector<uint32_t> times;
+        size_t skipped = 0;
+        if (!readCapture(argv[0], times, frames, skipped)) return 1;
+    }
+    printf("%zu frames of %d LEDs (%zu bytes raw each)\n\n", frames.size() / FRAME_BYTES, FRAME_LEDS, FRAME_BYTES);
+
+    printf("%-28s %8s %8s %8s %12s %12s\n", "codec", "bytes/f", "largest", "of raw", "encode f/s", "decode f/s");
+    bool ok = true;
+    FrameCodec::Options options;
+    ok &= benchFrameCodec("frame: key 64, palette 256", frames, options);
+    options.paletteColors = 16;
+    ok &= benchFrameCodec("frame: key 64, palette 16", frames, options);
+    options.paletteColors = 0;
+    ok &= benchFrameCodec("frame: key 64, no palette", frames, options);
+    options.paletteColors = 256;
+    options.keyInterval = 16;
+    ok &= benchFrameCodec("frame: key 16, palette 256", frames, options);
+    options.keyInterval = 0;
+    ok &= benchFrameCodec("frame: first key only", frames, options);
+    ok &= benchAnimationCodec("animation: key 50", frames, 50);
+    ok &= benchAnimationCodec("animation: first key only", frames, 0);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2) {
+        std::string command = argv[1];
+        if (command == "encode") return encode(argc - 2, argv + 2);
+        if (command == "decode") return decode(argc - 2, argv + 2);
+        if (command == "info") return info(argc - 2, argv + 2);
+        if (command == "bench") return bench(argc - 2, argv + 2);
+    }
+    fprintf(stderr, "usage: anim_tool encode|decode|info|bench ...\n");
+    return 1;
+}
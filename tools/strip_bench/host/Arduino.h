@@ -0,0 +1,64 @@
+// tools/strip_bench/host/Arduino.h
+//
+// The parts of the Arduino core the strip jobs use, for building effects on
+// a PC. millis() is a clock the bench moves on by hand (hostAdvanceMillis),
+// so every update() draws a frame; micros() is the real clock, for timing.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define PI 3.14159265358979f
+#define TWO_PI 6.28318530717958f
+#define IRAM_ATTR
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+template<class T, class L, class H>
+auto constrain(T x, L low, H high) -> decltype(x + low + high) {
+    return x < low ? low : (x > high ? high : x);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+void* ps_malloc(size_t size);
+
+class String : public std::string {
+public:
+    String() {}
+    String(const char* text) : std::string(text) {}
+};
+
+// Serial output is dropped - some effects log every spawn, and the bench
+// prints its own table
+struct HardwareSerial {
+    template<class T> void print(const T& value) {}
+    template<class T> void print(const T& value, int digits) {}
+    template<class T> void println(const T& value) {}
+    template<class T> void println(const T& value, int digits) {}
+    void println() {}
+    size_t write(const uint8_t* data, size_t length) { return length; }
+    size_t write(uint8_t data) { return 1; }
+};
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,123 @@
+// tools/strip_bench/host/FastLED.h
+//
+// The FastLED types and 8-bit math the strip jobs use, for the host build.
+// The math follows FastLED's portable C versions so the per-LED work costs
+// about the same; hsv2rgb_rainbow is a plain HSV conversion, so colors are
+// close to the lantern's but not exact. Nothing is sent to any LEDs.
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+#include "Arduino.h"
+
+typedef uint8_t fract8;
+
+inline uint8_t scale8(uint8_t i, fract8 scale) { return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8; }
+inline uint8_t scale8_video(uint8_t i, fract8 scale) { return (((uint16_t)i * scale) >> 8) + ((i && scale) ? 1 : 0); }
+inline uint16_t scale16(uint16_t i, uint16_t scale) { return ((uint32_t)i * (1 + (uint32_t)scale)) >> 16; }
+inline uint8_t qadd8(uint8_t i, uint8_t j) { unsigned t = i + j; return t > 255 ? 255 : t; }
+inline uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    return b > a ? a + scale8(b - a, frac) : a - scale8(a - b, frac);
+}
+inline uint8_t dim8_raw(uint8_t x) { return scale8(x, x); }
+inline uint8_t dim8_video(uint8_t x) { return scale8_video(x, x); }
+inline uint8_t sin8(uint8_t theta) { return (uint8_t)(128.0f + 127.5f * sinf(theta * (TWO_PI / 256.0f))); }
+inline uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+inline int16_t sin16(uint16_t theta) { return (int16_t)(32767.0f * sinf(theta * (TWO_PI / 65536.0f))); }
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+inline uint8_t ease8InOutQuad(uint8_t i) {
+    uint8_t j = i & 0x80 ? 255 - i : i;
+    uint8_t jj = scale8(j, j);
+    uint8_t jj2 = jj << 1;
+    return i & 0x80 ? 255 - jj2 : jj2;
+}
+
+uint8_t random8();
+uint8_t random8(uint8_t lim);
+uint8_t random8(uint8_t min, uint8_t lim);
+uint16_t random16();
+uint16_t random16(uint16_t lim);
+uint16_t random16(uint16_t min, uint16_t lim);
+void random16_set_seed(uint16_t seed);
+void random16_add_entropy(uint16_t entropy);
+
+struct CHSV {
+    union {
+        struct { uint8_t h, s, v; };
+        struct { uint8_t hue, sat, val; };
+        uint8_t raw[3];
+    };
+    CHSV() {}
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+struct CRGB {
+    union {
+        struct { uint8_t r, g, b; };
+        struct { uint8_t red, green, blue; };
+        uint8_t raw[3];
+    };
+
+    CRGB() {}
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+    CRGB(const CHSV& hsv) { hsv2rgb_rainbow(hsv, *this); }
+
+    uint8_t& operator[](int i) { return raw[i]; }
+    const uint8_t& operator[](int i) const { return raw[i]; }
+    explicit operator bool() const { return r || g || b; }
+
+    CRGB& operator+=(const CRGB& rhs) { r = qadd8(r, rhs.r); g = qadd8(g, rhs.g); b = qadd8(b, rhs.b); return *this; }
+    CRGB& operator-=(const CRGB& rhs) { r = qsub8(r, rhs.r); g = qsub8(g, rhs.g); b = qsub8(b, rhs.b); return *this; }
+    CRGB& operator|=(const CRGB& rhs) { r = max(r, rhs.r); g = max(g, rhs.g); b = max(b, rhs.b); return *this; }
+    CRGB& operator*=(uint8_t d) { r = min(255, r * d); g = min(255, g * d); b = min(255, b * d); return *this; }
+    CRGB& operator/=(uint8_t d) { r /= d; g /= d; b /= d; return *this; }
+    CRGB& nscale8(uint8_t scale) { r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale); return *this; }
+    CRGB& nscale8(const CRGB& scale) { r = scale8(r, scale.r); g = scale8(g, scale.g); b = scale8(b, scale.b); return *this; }
+    CRGB& nscale8_video(uint8_t scale) { r = scale8_video(r, scale); g = scale8_video(g, scale); b = scale8_video(b, scale); return *this; }
+    CRGB& fadeToBlackBy(uint8_t fade) { return nscale8(255 - fade); }
+    CRGB& operator%=(uint8_t scale) { return nscale8_video(scale); }
+    uint8_t getLuma() const { return scale8(r, 54) + scale8(g, 183) + scale8(b, 18); }
+
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000,
+        Blue = 0x0000FF, Orange = 0xFFA500, Purple = 0x800080, Yellow = 0xFFFF00
+    };
+};
+
+inline bool operator==(const CRGB& a, const CRGB& b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+inline bool operator!=(const CRGB& a, const CRGB& b) { return !(a == b); }
+inline CRGB operator+(const CRGB& a, const CRGB& b) { CRGB t = a; t += b; return t; }
+inline CRGB operator*(const CRGB& a, uint8_t d) { CRGB t = a; t *= d; return t; }
+inline CRGB operator%(const CRGB& a, uint8_t scale) { CRGB t = a; t.nscale8_video(scale); return t; }
+
+inline CRGB blend(const CRGB& a, const CRGB& b, fract8 amount) {
+    return CRGB(lerp8by8(a.r, b.r, amount), lerp8by8(a.g, b.g, amount), lerp8by8(a.b, b.b, amount));
+}
+inline CRGB& nblend(CRGB& existing, const CRGB& overlay, fract8 amount) { existing = blend(existing, overlay, amount); return existing; }
+void blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amount);
+void hsv2rgb_rainbow(const CHSV* hsv, CRGB* rgb, int count);
+inline void hsv2rgb_spectrum(const CHSV& hsv, CRGB& rgb) { hsv2rgb_rainbow(hsv, rgb); }
+void fill_solid(CRGB* leds, int count, const CRGB& color);
+void fadeToBlackBy(CRGB* leds, uint16_t count, uint8_t fade);
+void nscale8(CRGB* leds, uint16_t count, uint8_t scale);
+void nscale8_video(CRGB* leds, uint16_t count, uint8_t scale);
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+template<int PIN> struct WS2812B {};
+
+struct CFastLED {
+    template<template<int> class CHIPSET, int PIN, EOrder ORDER>
+    void addLeds(CRGB* leds, int count) {}
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() { return brightness; }
+    void show() {}
+    void clear(bool writeData = false) {}
+    uint8_t brightness = 255;
+};
+extern CFastLED FastLED;
+
+#endif // HOST_FASTLED_H
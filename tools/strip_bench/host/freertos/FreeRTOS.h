@@ -0,0 +1,19 @@
+// tools/strip_bench/host/freertos/FreeRTOS.h
+//
+// FreeRTOS types for the host build - tasks are std::threads (see task.h)
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef struct HostTask* TaskHandle_t;
+
+#define pdPASS 1
+#define pdTRUE 1
+#define pdFALSE 0
+#define portMAX_DELAY 0xffffffffu
+#define pdMS_TO_TICKS(ms) (ms)
+
+#endif // HOST_FREERTOS_H
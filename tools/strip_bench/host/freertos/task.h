@@ -0,0 +1,17 @@
+// tools/strip_bench/host/freertos/task.h
+//
+// Pinned tasks and task notifications on top of std::thread. The core
+// number is ignored - the operating system decides where the thread runs.
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreatePinnedToCore(void (*function)(void*), const char* name, uint32_t stackBytes,
+                                   void* parameter, unsigned priority, TaskHandle_t* handle, int core);
+void xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+void vTaskDelay(TickType_t ticks);
+void taskYIELD();
+
+#endif // HOST_FREERTOS_TASK_H
@@ -0,0 +1,131 @@
+// tools/strip_bench/host/host_shim.cpp
+//
+// Bodies for the host Arduino, FastLED and FreeRTOS stand-ins
+#include "Arduino.h"
+#include "FastLED.h"
+#include "freertos/task.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+HardwareSerial Serial;
+CFastLED FastLED;
+
+// ===== Clocks =====
+
+static std::atomic<unsigned long> hostMillis(1000);  // Not 0 - effects use 0 as "not started"
+static const auto hostStart = std::chrono::steady_clock::now();
+
+unsigned long millis() { return hostMillis.load(); }
+void hostAdvanceMillis(unsigned long ms) { hostMillis += ms; }
+void delay(unsigned long ms) { hostAdvanceMillis(ms); }
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostStart).count();
+}
+
+// ===== Arduino =====
+
+long random(long howBig) { return howBig <= 0 ? 0 : rand() % howBig; }
+long random(long howSmall, long howBig) { return howBig <= howSmall ? howSmall : howSmall + rand() % (howBig - howSmall); }
+void randomSeed(unsigned long seed) { srand(seed); }
+uint32_t esp_random() { return ((uint32_t)rand() << 16) ^ (uint32_t)rand(); }
+long map(long x, long inMin, long inMax, long outMin, long outMax) { return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin; }
+void* ps_malloc(size_t size) { return malloc(size); }
+
+// ===== FastLED =====
+
+static uint16_t rand16seed = 1337;
+
+uint16_t random16() { rand16seed = rand16seed * 2053 + 13849; return rand16seed; }
+uint16_t random16(uint16_t lim) { return ((uint32_t)random16() * lim) >> 16; }
+uint16_t random16(uint16_t min, uint16_t lim) { return min + random16(lim - min); }
+uint8_t random8() { random16(); return (uint8_t)((rand16seed & 0xFF) + (rand16seed >> 8)); }
+uint8_t random8(uint8_t lim) { return (random8() * lim) >> 8; }
+uint8_t random8(uint8_t min, uint8_t lim) { return min + random8(lim - min); }
+void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+void random16_add_entropy(uint16_t entropy) { rand16seed += entropy; }
+
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    // Six 43-step sectors, all in 8-bit math like FastLED's own conversion
+    uint8_t sector = hsv.h / 43;
+    uint8_t remainder = (hsv.h - sector * 43) * 6;
+    uint8_t p = scale8(hsv.v, 255 - hsv.s);
+    uint8_t q = scale8(hsv.v, 255 - scale8(hsv.s, remainder));
+    uint8_t t = scale8(hsv.v, 255 - scale8(hsv.s, 255 - remainder));
+    switch (sector) {
+        case 0:  rgb = CRGB(hsv.v, t, p); break;
+        case 1:  rgb = CRGB(q, hsv.v, p); break;
+        case 2:  rgb = CRGB(p, hsv.v, t); break;
+        case 3:  rgb = CRGB(p, q, hsv.v); break;
+        case 4:  rgb = CRGB(t, p, hsv.v); break;
+        default: rgb = CRGB(hsv.v, p, q); break;
+    }
+}
+
+void hsv2rgb_rainbow(const CHSV* hsv, CRGB* rgb, int count) {
+    for (int i = 0; i < count; i++) hsv2rgb_rainbow(hsv[i], rgb[i]);
+}
+
+void blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amount) {
+    for (uint16_t i = 0; i < count; i++) dest[i] = blend(src1[i], src2[i], amount);
+}
+
+void fill_solid(CRGB* leds, int count, const CRGB& color) { for (int i = 0; i < count; i++) leds[i] = color; }
+void fadeToBlackBy(CRGB* leds, uint16_t count, uint8_t fade) { for (uint16_t i = 0; i < count; i++) leds[i].fadeToBlackBy(fade); }
+void nscale8(CRGB* leds, uint16_t count, uint8_t scale) { for (uint16_t i = 0; i < count; i++) leds[i].nscale8(scale); }
+void nscale8_video(CRGB* leds, uint16_t count, uint8_t scale) { for (uint16_t i = 0; i < count; i++) leds[i].nscale8_video(scale); }
+
+// ===== FreeRTOS =====
+
+// A task is a thread with a notification counter
+struct HostTask {
+    std::mutex mutex;
+    std::condition_variable wake;
+    uint32_t notifications = 0;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(void (*function)(void*), const char* name, uint32_t stackBytes,
+                                   void* parameter, unsigned priority, TaskHandle_t* handle, int core) {
+    HostTask* task = new HostTask();
+    if (handle != nullptr) {
+        *handle = task;
+    }
+    std::thread([task, function, parameter]() {
+        currentTask = task;
+        function(parameter);
+    }).detach();
+    return pdPASS;
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        task->notifications++;
+    }
+    task->wake.notify_one();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    HostTask* task = currentTask;
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->wake.wait(lock, [task]() { return task->notifications > 0; });
+    uint32_t count = task->notifications;
+    task->notifications = clearOnExit ? 0 : count - 1;
+    return count;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    if (ticks == 0) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+    }
+}
+
+void taskYIELD() { std::this_thread::yield(); }
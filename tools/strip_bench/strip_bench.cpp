@@ -0,0 +1,100 @@
+// tools/strip_bench/strip_bench.cpp
+//
+// Host benchmark for strip jobs (Effect::renderStrips): draws every effect
+// that splits its frame into strip jobs, once with all four strips on one
+// thread and once with the RenderWorker taking strips from the same queue,
+// and prints the time per frame for both.
+//
+// The effects are built from src/ unchanged, against small stand-ins for
+// Arduino, FastLED and FreeRTOS in host/ - the worker task is a std::thread.
+// The numbers show how well a frame splits between two workers; the ESP32's
+// own frame times are many times longer, so the handoff costs less there.
+// Run it on a machine with at least two cores - on one core the worker can
+// only take turns with the main thread.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -pthread -Itools/strip_bench/host -Iinclude -Isrc -Isrc/leds
+//       -o strip_bench tools/strip_bench/strip_bench.cpp tools/strip_bench/host/host_shim.cpp
+//       src/leds/LEDController.cpp src/leds/RenderTarget.cpp src/leds/RenderWorker.cpp
+//       src/leds/HSVKernel.cpp src/leds/BakedLoop.cpp src/leds/FrameCodec.cpp
+//       src/leds/AnimationCodec.cpp src/leds/effects/Effect.cpp
+//       src/leds/effects/AuraEffect.cpp src/leds/effects/LustEffect.cpp
+//       src/leds/effects/RainbowEffect.cpp src/leds/effects/RgbPatternEffect.cpp
+//
+// Usage:
+//   ./strip_bench [frames]      (default 5000 frames per effect and setting)
+
+#include <cstdio>
+#include <cstdlib>
+#include "Config.h"
+#include "LEDController.h"
+#include "RenderWorker.h"
+#include "effects/AuraEffect.h"
+#include "effects/LustEffect.h"
+#include "effects/RainbowEffect.h"
+#include "effects/RgbPatternEffect.h"
+
+// Far enough apart that every update() draws, whatever the effect's frame cap
+static const unsigned long FRAME_STEP_MS = 20;
+
+/**
+ * Draw a number of frames and time them
+ * @param effect Effect to draw
+ * @param target Where to draw it
+ * @param frames How many frames
+ * @return Microseconds per frame
+ */
+static double timeFrames(Effect* effect, RenderTarget& target, int frames) {
+    unsigned long start = micros();
+    for (int i = 0; i < frames; i++) {
+        hostAdvanceMillis(FRAME_STEP_MS);
+        effect->update(target);
+    }
+    return (double)(micros() - start) / frames;
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 5000;
+    if (frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    LEDController leds;
+    leds.begin();
+
+    RenderWorker worker;
+    if (!worker.begin()) {
+        return 1;
+    }
+
+    Effect* effects[] = {
+        new AuraEffect(leds),
+        new LustEffect(leds),
+        new RainbowEffect(leds),
+        new RgbPatternEffect(leds)
+    };
+
+    printf("\n%d frames per run\n", frames);
+    printf("%-20s %12s %12s %8s\n", "Effect", "one thread", "with worker", "speedup");
+
+    for (Effect* effect : effects) {
+        // First frame warms the effect up - keep it out of the timing
+        Effect::setStripWorker(nullptr);
+        hostAdvanceMillis(FRAME_STEP_MS);
+        effect->update(leds.getScreen());
+
+        double single = timeFrames(effect, leds.getScreen(), frames);
+
+        Effect::setStripWorker(&worker);
+        double shared = timeFrames(effect, leds.getScreen(), frames);
+
+        printf("%-20s %10.2fus %10.2fus %7.2fx\n", effect->getName(), single, shared, single / shared);
+    }
+
+    Effect::setStripWorker(nullptr);
+    for (Effect* effect : effects) {
+        delete effect;
+    }
+    return 0;
+}